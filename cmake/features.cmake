@@ -22,10 +22,14 @@ Supported values:\
  FIRST_INFERENCE - enable only first inference time counters" ALL
                ALLOWED_VALUES ALL FIRST_INFERENCE)
 
+ie_dependent_option (ENABLE_PROFILING_TRACE "Build with the built-in tracing of the ITT tasks. The tasks are recorded to per-thread ring buffers \
+and dumped in the Chrome trace format to the file set by the OPENVINO_TRACE_FILE environment variable at the process exit or on SIGUSR1." OFF "NOT ENABLE_PROFILING_ITT" OFF)
+
 ie_option (ENABLE_PROFILING_FIRST_INFERENCE "Build with ITT tracing of first inference time." ON)
 
 ie_option_enum(SELECTIVE_BUILD "Enable OpenVINO conditional compilation or statistics collection. \
 In case SELECTIVE_BUILD is enabled, the SELECTIVE_BUILD_STAT variable should contain the path to the collected InelSEAPI statistics. \
+In case of COLLECT, the statistics are also written to the file set by the OPENVINO_CC_PROFILE environment variable. \
 Usage: -DSELECTIVE_BUILD=ON -DSELECTIVE_BUILD_STAT=/path/*.csv" OFF
                ALLOWED_VALUES ON OFF COLLECT)
 
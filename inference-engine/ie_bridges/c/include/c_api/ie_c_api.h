@@ -53,6 +53,7 @@ typedef struct ie_network ie_network_t;
 typedef struct ie_executable ie_executable_network_t;
 typedef struct ie_infer_request ie_infer_request_t;
 typedef struct ie_blob ie_blob_t;
+typedef struct ie_completion_queue ie_completion_queue_t;
 
 /**
  * @struct ie_version
@@ -298,6 +299,26 @@ typedef struct ie_complete_call_back {
     void *args;
 } ie_complete_call_back_t;
 
+/**
+ * @struct ie_blob_release_call_back
+ * @brief Release callback definition about the function and args. The function is called with the pointer
+ * to the released memory.
+ */
+typedef struct ie_blob_release_call_back {
+    void (INFERENCE_ENGINE_C_API_CALLBACK *releaseCallBackFunc)(void *ptr, void *args);
+    void *args;
+} ie_blob_release_call_back_t;
+
+/**
+ * @struct ie_completion
+ * @brief Represents the completion of an infer request attached to the completion queue.
+ */
+typedef struct ie_completion {
+    ie_infer_request_t *infer_request;  //!< The completed infer request
+    void *user_data;                    //!< The user data given on the attach of the infer request
+    IEStatusCode status;                //!< The status of the inference: OK(0) for success
+} ie_completion_t;
+
 /**
  * @struct ie_available_devices
  * @brief Represent all available devices.
@@ -661,6 +682,78 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_batch(ie_
 
 /** @} */ // end of InferRequest
 
+// CompletionQueue
+
+/**
+ * @defgroup CompletionQueue CompletionQueue
+ * Set of functions collecting the completions of many asynchronous infer requests,
+ * so they are handled by one thread, e.g. by the event loop watching the queue file descriptor.
+ * @{
+ */
+
+/**
+ * @brief Constructs the completion queue. Use the ie_completion_queue_free() method to free memory.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to the newly created ie_completion_queue_t.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_create(ie_completion_queue_t **queue);
+
+/**
+ * @brief Releases memory occupied by the completion queue. The attached infer requests still running
+ * complete without a notification.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to the queue to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_completion_queue_free(ie_completion_queue_t **queue);
+
+/**
+ * @brief Attaches the infer request to the queue: every completion of the request is put to the queue.
+ * It replaces the callback set by ie_infer_set_completion_callback() and the previous queue of the request.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to ie_completion_queue_t instance.
+ * @param infer_request A pointer to ie_infer_request_t instance. It must not be freed while its completions
+ * are in the queue.
+ * @param user_data The data returned with the completions of the request.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_attach(ie_completion_queue_t *queue, ie_infer_request_t *infer_request, void *user_data);
+
+/**
+ * @brief Takes the earliest completion from the queue. Blocks until specified timeout elapses or a completion
+ * becomes available, whichever comes first.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to ie_completion_queue_t instance.
+ * @param timeout Maximum duration in milliseconds to block for: 0 immediately returns, -1 waits until a completion
+ * becomes available.
+ * @param completion A pointer to the completion taken from the queue.
+ * @return Status code of the operation: OK(0) for success, RESULT_NOT_READY if there is no completion.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_wait_any(ie_completion_queue_t *queue, const int64_t timeout, ie_completion_t *completion);
+
+/**
+ * @brief Takes up to the given number of the completions from the queue without blocking.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to ie_completion_queue_t instance.
+ * @param completions An array of the completions taken from the queue.
+ * @param max_count The size of the completions array.
+ * @param count A pointer to the number of the completions taken from the queue.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_poll_n(ie_completion_queue_t *queue, ie_completion_t *completions, const size_t max_count, size_t *count);
+
+/**
+ * @brief Gets the file descriptor which is readable while the queue has completions, so the queue can be watched
+ * by poll/epoll/kqueue. The descriptor is owned by the queue and must be neither read nor closed.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to ie_completion_queue_t instance.
+ * @param fd A pointer to the file descriptor.
+ * @return Status code of the operation: OK(0) for success, NOT_IMPLEMENTED on Windows.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_get_fd(const ie_completion_queue_t *queue, int *fd);
+
+/** @} */ // end of CompletionQueue
+
 // Network
 
 /**
@@ -930,6 +1023,22 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_blob_make_memory(const tens
  */
 INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_blob_make_memory_from_preallocated(const tensor_desc_t *tensorDesc, void *ptr, size_t size, ie_blob_t **blob);
 
+/**
+ * @brief Creates a blob with the given tensor descriptor which takes the ownership of the pre-allocated memory.
+ * The release callback is called when the blob and all its users, e.g. the infer requests it is set to,
+ * do not need the memory anymore, so the memory can be freed or reused. If the blob is not created,
+ * the ownership stays with the caller and the callback is not called.
+ * @ingroup Blob
+ * @param tensorDesc Tensor descriptor for Blob creation.
+ * @param ptr Pointer to the pre-allocated memory.
+ * @param size Length of the pre-allocated array.
+ * @param release The callback releasing the memory.
+ * @param blob A pointer to the newly created blob.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_blob_make_memory_from_preallocated_with_release(const tensor_desc_t *tensorDesc, void *ptr, size_t size,
+                                                    const ie_blob_release_call_back_t *release, ie_blob_t **blob);
+
 /**
  * @brief Creates a blob describing given roi_t instance based on the given blob with pre-allocated memory.
  * @ingroup Blob
@@ -13,11 +13,22 @@
 #include <chrono>
 #include <tuple>
 #include <memory>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
 #include <ie_extension.h>
 #include "inference_engine.hpp"
 #include "ie_compound_blob.h"
 #include "c_api/ie_c_api.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <sys/eventfd.h>
+#endif
+
 namespace IE = InferenceEngine;
 
 /**
@@ -60,6 +71,107 @@ struct ie_network {
     IE::CNNNetwork object;
 };
 
+/**
+ * @brief The completions shared by the queue and the callbacks of the attached infer requests,
+ * so the requests may complete after the queue is freed
+ */
+struct completion_queue_state {
+    std::mutex mutex;
+    std::condition_variable completed;
+    std::deque<ie_completion_t> completions;
+    // the read end is readable while there are completions, it's the same eventfd on Linux
+    int fds[2] = {-1, -1};
+
+    ~completion_queue_state() {
+#ifndef _WIN32
+        if (fds[0] >= 0)
+            close(fds[0]);
+        if (fds[1] >= 0 && fds[1] != fds[0])
+            close(fds[1]);
+#endif
+    }
+
+    void push(const ie_completion_t &completion) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            completions.push_back(completion);
+            if (completions.size() == 1)
+                signal();
+        }
+        completed.notify_one();
+    }
+
+    // must be called under the lock
+    ie_completion_t pop() {
+        ie_completion_t completion = completions.front();
+        completions.pop_front();
+        if (completions.empty())
+            reset();
+        return completion;
+    }
+
+private:
+    void signal() {
+#ifndef _WIN32
+        if (fds[1] >= 0) {
+            const uint64_t value = 1;
+            // the descriptor is not blocking and only one write is pending, so it never fails
+            ssize_t written = write(fds[1], &value, fds[0] == fds[1] ? sizeof(value) : 1);
+            (void)written;
+        }
+#endif
+    }
+
+    void reset() {
+#ifndef _WIN32
+        if (fds[0] >= 0) {
+            uint64_t value = 0;
+            ssize_t read_size = read(fds[0], &value, fds[0] == fds[1] ? sizeof(value) : 1);
+            (void)read_size;
+        }
+#endif
+    }
+};
+
+/**
+ * @struct ie_completion_queue
+ * @brief This struct represents the completions of the attached infer requests
+ */
+struct ie_completion_queue {
+    std::shared_ptr<completion_queue_state> object;
+};
+
+/**
+ * @brief The allocator returning the memory the blob takes the ownership of, the memory is released by the user
+ * callback when the blob is freed
+ */
+class preallocated_memory_allocator : public IE::IAllocator {
+public:
+    preallocated_memory_allocator(void *ptr, size_t byte_size, const ie_blob_release_call_back_t &release)
+        : _ptr(ptr), _byte_size(byte_size), _release(release) {}
+
+    void* lock(void* handle, IE::LockOp = IE::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        return size <= _byte_size ? _ptr : nullptr;
+    }
+
+    bool free(void* handle) noexcept override {
+        if (handle == _ptr && _release.releaseCallBackFunc)
+            _release.releaseCallBackFunc(_ptr, _release.args);
+        return true;
+    }
+
+private:
+    void *_ptr;
+    size_t _byte_size;
+    ie_blob_release_call_back_t _release;
+};
+
 std::map<IE::StatusCode, IEStatusCode> status_map = {{IE::StatusCode::GENERAL_ERROR, IEStatusCode::GENERAL_ERROR},
                                                         {IE::StatusCode::INFER_NOT_STARTED, IEStatusCode::INFER_NOT_STARTED},
                                                         {IE::StatusCode::NETWORK_NOT_LOADED,  IEStatusCode::NETWORK_NOT_LOADED},
@@ -1243,6 +1355,118 @@ IEStatusCode ie_infer_request_set_batch(ie_infer_request_t *infer_request, const
     return status;
 }
 
+IEStatusCode ie_completion_queue_create(ie_completion_queue_t **queue) {
+    if (queue == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    IEStatusCode status = IEStatusCode::OK;
+    try {
+        std::unique_ptr<ie_completion_queue_t> tmp(new ie_completion_queue_t);
+        tmp->object = std::make_shared<completion_queue_state>();
+#ifdef __linux__
+        const int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (fd < 0) {
+            return IEStatusCode::GENERAL_ERROR;
+        }
+        tmp->object->fds[0] = tmp->object->fds[1] = fd;
+#elif !defined(_WIN32)
+        if (pipe(tmp->object->fds) != 0) {
+            return IEStatusCode::GENERAL_ERROR;
+        }
+        for (int fd : tmp->object->fds) {
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+            fcntl(fd, F_SETFD, FD_CLOEXEC);
+        }
+#endif
+        *queue = tmp.release();
+    } CATCH_IE_EXCEPTIONS
+
+    return status;
+}
+
+void ie_completion_queue_free(ie_completion_queue_t **queue) {
+    if (queue) {
+        delete *queue;
+        *queue = NULL;
+    }
+}
+
+IEStatusCode ie_completion_queue_attach(ie_completion_queue_t *queue, ie_infer_request_t *infer_request, void *user_data) {
+    if (queue == nullptr || infer_request == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    IEStatusCode status = IEStatusCode::OK;
+    try {
+        // the queue may be freed before the request completes, so the callback shares the state
+        std::weak_ptr<completion_queue_state> state = queue->object;
+        auto fun = [state, infer_request, user_data](IE::InferRequest, IE::StatusCode code) {
+            auto queue_state = state.lock();
+            if (!queue_state)
+                return;
+            auto found = status_map.find(code);
+            queue_state->push({infer_request, user_data, found != status_map.end() ? found->second : IEStatusCode::UNEXPECTED});
+        };
+        infer_request->object.SetCompletionCallback<std::function<void(IE::InferRequest, IE::StatusCode)>>(fun);
+    } CATCH_IE_EXCEPTIONS
+
+    return status;
+}
+
+IEStatusCode ie_completion_queue_wait_any(ie_completion_queue_t *queue, const int64_t timeout, ie_completion_t *completion) {
+    if (queue == nullptr || completion == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    IEStatusCode status = IEStatusCode::OK;
+    try {
+        auto& state = *queue->object;
+        std::unique_lock<std::mutex> lock(state.mutex);
+        auto has_completions = [&state] { return !state.completions.empty(); };
+        if (timeout < 0) {
+            state.completed.wait(lock, has_completions);
+        } else if (!state.completed.wait_for(lock, std::chrono::milliseconds(timeout), has_completions)) {
+            return IEStatusCode::RESULT_NOT_READY;
+        }
+        *completion = state.pop();
+    } CATCH_IE_EXCEPTIONS
+
+    return status;
+}
+
+IEStatusCode ie_completion_queue_poll_n(ie_completion_queue_t *queue, ie_completion_t *completions, const size_t max_count, size_t *count) {
+    if (queue == nullptr || (completions == nullptr && max_count != 0) || count == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    IEStatusCode status = IEStatusCode::OK;
+    try {
+        auto& state = *queue->object;
+        std::lock_guard<std::mutex> lock(state.mutex);
+        size_t taken = 0;
+        while (taken < max_count && !state.completions.empty()) {
+            completions[taken++] = state.pop();
+        }
+        *count = taken;
+    } CATCH_IE_EXCEPTIONS
+
+    return status;
+}
+
+IEStatusCode ie_completion_queue_get_fd(const ie_completion_queue_t *queue, int *fd) {
+    if (queue == nullptr || fd == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    if (queue->object->fds[0] < 0) {
+        return IEStatusCode::NOT_IMPLEMENTED;
+    }
+    *fd = queue->object->fds[0];
+
+    return IEStatusCode::OK;
+}
+
 IEStatusCode ie_blob_make_memory(const tensor_desc_t *tensorDesc, ie_blob_t **blob) {
     if (tensorDesc == nullptr || blob == nullptr) {
         return IEStatusCode::GENERAL_ERROR;
@@ -1375,6 +1599,74 @@ IEStatusCode ie_blob_make_memory_from_preallocated(const tensor_desc_t *tensorDe
     return status;
 }
 
+IEStatusCode ie_blob_make_memory_from_preallocated_with_release(const tensor_desc_t *tensorDesc, void *ptr, size_t size,
+                                                                const ie_blob_release_call_back_t *release, ie_blob_t **blob) {
+    if (tensorDesc == nullptr || ptr == nullptr || release == nullptr || blob == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    IE::Precision prec;
+    for (auto it : precision_map) {
+        if (it.second == tensorDesc->precision) {
+            prec = it.first;
+            break;
+        }
+    }
+
+    IE::Layout l = IE::Layout::NCHW;
+    for (auto it : layout_map) {
+        if (it.second == tensorDesc->layout) {
+            l = it.first;
+            break;
+        }
+    }
+
+    IE::SizeVector dims_vector;
+    for (size_t i = 0; i < tensorDesc->dims.ranks; ++i) {
+        dims_vector.push_back(tensorDesc->dims.dims[i]);
+    }
+
+    IEStatusCode status = IEStatusCode::OK;
+    try {
+        IE::TensorDesc tensor(prec, dims_vector, l);
+        // the memory is returned to the user by the allocator when the blob is freed
+        auto allocator = std::make_shared<preallocated_memory_allocator>(ptr, size * prec.size(), *release);
+        std::unique_ptr<ie_blob_t> _blob(new ie_blob_t);
+        if (prec == IE::Precision::U8) {
+            _blob->object = IE::make_shared_blob<uint8_t>(tensor, allocator);
+        } else if (prec == IE::Precision::U16) {
+            _blob->object = IE::make_shared_blob<uint16_t>(tensor, allocator);
+        } else if (prec == IE::Precision::I8 || prec == IE::Precision::BIN || prec == IE::Precision::I4 || prec == IE::Precision::U4) {
+            _blob->object = IE::make_shared_blob<int8_t>(tensor, allocator);
+        } else if (prec == IE::Precision::I16 || prec == IE::Precision::FP16 || prec == IE::Precision::Q78) {
+            _blob->object = IE::make_shared_blob<int16_t>(tensor, allocator);
+        } else if (prec == IE::Precision::I32) {
+            _blob->object = IE::make_shared_blob<int32_t>(tensor, allocator);
+        } else if (prec == IE::Precision::U32) {
+            _blob->object = IE::make_shared_blob<uint32_t>(tensor, allocator);
+        } else if (prec == IE::Precision::I64) {
+            _blob->object = IE::make_shared_blob<int64_t>(tensor, allocator);
+        } else if (prec == IE::Precision::U64) {
+            _blob->object = IE::make_shared_blob<uint64_t>(tensor, allocator);
+        } else if  (prec == IE::Precision::FP32) {
+            _blob->object = IE::make_shared_blob<float>(tensor, allocator);
+        } else if  (prec == IE::Precision::FP64) {
+            _blob->object = IE::make_shared_blob<double>(tensor, allocator);
+        } else {
+            _blob->object = IE::make_shared_blob<uint8_t>(tensor, allocator);
+        }
+
+        // the allocation fails if the pre-allocated memory is not enough, then the memory is not released
+        _blob->object->allocate();
+        if (_blob->object->buffer().as<void*>() == nullptr) {
+            return IEStatusCode::GENERAL_ERROR;
+        }
+        *blob = _blob.release();
+    } CATCH_IE_EXCEPTIONS
+
+    return status;
+}
+
 IEStatusCode ie_blob_make_memory_with_roi(const ie_blob_t *inputBlob, const roi_t *roi, ie_blob_t **blob) {
     if (inputBlob == nullptr || roi == nullptr || blob == nullptr) {
         return IEStatusCode::GENERAL_ERROR;
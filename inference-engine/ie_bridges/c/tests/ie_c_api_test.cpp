@@ -12,6 +12,9 @@
 #include <inference_engine.hpp>
 #include "test_model_repo.hpp"
 #include <fstream>
+#ifdef __linux__
+#include <poll.h>
+#endif
 
 std::string xml_std = TestDataHelpers::generate_model_path("test_model", "test_model_fp32.xml"),
             bin_std = TestDataHelpers::generate_model_path("test_model", "test_model_fp32.bin"),
@@ -1270,6 +1273,82 @@ TEST(ie_infer_request_set_batch, setNegativeBatch) {
     ie_core_free(&core);
 }
 
+TEST(ie_completion_queue, waitAnyCompletedRequests) {
+    ie_core_t *core = nullptr;
+    IE_ASSERT_OK(ie_core_create("", &core));
+    ASSERT_NE(nullptr, core);
+
+    ie_network_t *network = nullptr;
+    IE_EXPECT_OK(ie_core_read_network(core, xml, bin, &network));
+    EXPECT_NE(nullptr, network);
+
+    IE_EXPECT_OK(ie_network_set_input_precision(network, "data", precision_e::U8));
+
+    const char *device_name = "CPU";
+    ie_config_t config = {nullptr, nullptr, nullptr};
+    ie_executable_network_t *exe_network = nullptr;
+    IE_EXPECT_OK(ie_core_load_network(core, network, device_name, &config, &exe_network));
+    EXPECT_NE(nullptr, exe_network);
+
+    ie_completion_queue_t *queue = nullptr;
+    IE_ASSERT_OK(ie_completion_queue_create(&queue));
+    ASSERT_NE(nullptr, queue);
+
+    ie_completion_t completion;
+    EXPECT_EQ(IEStatusCode::RESULT_NOT_READY, ie_completion_queue_wait_any(queue, 0, &completion));
+
+    cv::Mat image = cv::imread(input_image);
+    ie_infer_request_t *infer_requests[2] = {nullptr, nullptr};
+    int user_data[2] = {0, 1};
+    for (int i = 0; i < 2; ++i) {
+        IE_EXPECT_OK(ie_exec_network_create_infer_request(exe_network, &infer_requests[i]));
+        EXPECT_NE(nullptr, infer_requests[i]);
+
+        ie_blob_t *blob = nullptr;
+        IE_EXPECT_OK(ie_infer_request_get_blob(infer_requests[i], "data", &blob));
+        Mat2Blob(image, blob);
+        ie_blob_free(&blob);
+
+        IE_EXPECT_OK(ie_completion_queue_attach(queue, infer_requests[i], &user_data[i]));
+    }
+
+    for (int i = 0; i < 2; ++i) {
+        IE_EXPECT_OK(ie_infer_request_infer_async(infer_requests[i]));
+    }
+
+    if (!HasFatalFailure()) {
+#ifdef __linux__
+        int fd = -1;
+        IE_EXPECT_OK(ie_completion_queue_get_fd(queue, &fd));
+        struct pollfd poll_fd = {fd, POLLIN, 0};
+        EXPECT_EQ(1, poll(&poll_fd, 1, -1));
+#endif
+        bool completed[2] = {false, false};
+        for (int i = 0; i < 2; ++i) {
+            IE_EXPECT_OK(ie_completion_queue_wait_any(queue, -1, &completion));
+            IE_EXPECT_OK(completion.status);
+            int index = *static_cast<int *>(completion.user_data);
+            ASSERT_TRUE(index == 0 || index == 1);
+            EXPECT_EQ(infer_requests[index], completion.infer_request);
+            completed[index] = true;
+        }
+        EXPECT_TRUE(completed[0] && completed[1]);
+
+        size_t count = 1;
+        IE_EXPECT_OK(ie_completion_queue_poll_n(queue, &completion, 1, &count));
+        EXPECT_EQ(0, count);
+    }
+
+    for (int i = 0; i < 2; ++i) {
+        ie_infer_request_free(&infer_requests[i]);
+    }
+    ie_completion_queue_free(&queue);
+    EXPECT_EQ(nullptr, queue);
+    ie_exec_network_free(&exe_network);
+    ie_network_free(&network);
+    ie_core_free(&core);
+}
+
 TEST(ie_blob_make_memory, makeMemory) {
 
     dimensions_t dim_t;
@@ -1306,6 +1385,42 @@ TEST(ie_blob_make_memory_from_preallocated, makeMemoryfromPreallocated) {
     ie_blob_free(&blob);
 }
 
+void release_callback(void *ptr, void *args) {
+    free(ptr);
+    *static_cast<bool *>(args) = true;
+}
+
+TEST(ie_blob_make_memory_from_preallocated_with_release, makeMemoryfromPreallocatedWithRelease) {
+
+    dimensions_t dim_t;
+    dim_t.ranks = 4 ;
+    dim_t.dims[0] = 1, dim_t.dims[1] = 3, dim_t.dims[2] = 4, dim_t.dims[3] = 4;
+    tensor_desc tensor;
+    tensor.dims = dim_t ;
+    tensor.precision = precision_e::FP32;
+    tensor.layout = layout_e::NCHW;
+
+    size_t size = 48;
+    void *ptr = malloc(size * sizeof(float));
+    bool released = false;
+    ie_blob_release_call_back_t release = {release_callback, &released};
+
+    ie_blob_t *blob = nullptr;
+    EXPECT_NE(IEStatusCode::OK, ie_blob_make_memory_from_preallocated_with_release(&tensor, ptr, size - 1, &release, &blob));
+    EXPECT_EQ(nullptr, blob);
+    EXPECT_FALSE(released);
+
+    IE_EXPECT_OK(ie_blob_make_memory_from_preallocated_with_release(&tensor, ptr, size, &release, &blob));
+    EXPECT_NE(nullptr, blob);
+
+    ie_blob_buffer_t buffer;
+    IE_EXPECT_OK(ie_blob_get_buffer(blob, &buffer));
+    EXPECT_EQ(ptr, buffer.buffer);
+
+    ie_blob_free(&blob);
+    EXPECT_TRUE(released);
+}
+
 TEST(ie_blob_make_memory_with_roi, makeMemorywithROI) {
 
     dimensions_t dim_t;
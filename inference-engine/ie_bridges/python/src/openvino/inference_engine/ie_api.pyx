@@ -14,6 +14,7 @@ from libc.stdlib cimport malloc, free
 from libc.stdint cimport int64_t, uint8_t, int8_t, int32_t, uint16_t, int16_t, uint32_t, uint64_t
 from libc.stddef cimport size_t
 from libc.string cimport memcpy
+from cpython.ref cimport Py_INCREF, Py_DECREF
 
 import os
 from fnmatch import fnmatch
@@ -863,6 +864,9 @@ cdef class ExecutableNetwork:
     #  Wraps `infer()` method of the `InferRequest` class
     #  @param inputs:  A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
     #                  input data for the layer
+    #  @param share_inputs: If True, the arrays are used as the input blobs without copying, see `InferRequest.infer()`
+    #  @param copy_outputs: If False, the returned arrays are views of the output blobs of the first infer request,
+    #                       see `InferRequest.get_output_arrays()`. True by default.
     #  @return A dictionary that maps output layer names to `numpy.ndarray` objects with output data of the layer
     #
     #  Usage example:\n
@@ -879,13 +883,10 @@ cdef class ExecutableNetwork:
     #                  ......
     #                 ]])}
     #  ```
-    def infer(self, inputs=None):
+    def infer(self, inputs=None, share_inputs=False, copy_outputs=True):
         current_request = self.requests[0]
-        current_request.infer(inputs)
-        res = {}
-        for name, value in current_request.output_blobs.items():
-            res[name] = deepcopy(value.buffer)
-        return res
+        current_request.infer(inputs, share_inputs)
+        return current_request.get_output_arrays(copy=copy_outputs)
 
     ## Starts asynchronous inference for specified infer request.
     #  Wraps `async_infer()` method of the `InferRequest` class.
@@ -1050,6 +1051,7 @@ cdef class InferRequest:
     #  which stores infer requests.
     def __init__(self):
         self._user_blobs = {}
+        self._shared_inputs = set()
         self._inputs_list = []
         self._outputs_list = []
         self._py_callback = lambda *args, **kwargs: None
@@ -1118,6 +1120,30 @@ cdef class InferRequest:
             output_blobs[output] = deepcopy(blob)
         return output_blobs
 
+    ## Gets the output data of the last inference as `numpy.ndarray` objects
+    #
+    #  \note The arrays returned with `copy=False` are views of the output blobs memory without copying.
+    #  The memory stays valid while the arrays are alive, but its content is overwritten by the next inference
+    #  of the infer request, so copy the arrays or pass `copy=True` to keep the results longer.
+    #
+    #  @param copy: If True, the data of the outputs is copied to the new arrays. False by default.
+    #  @return A dictionary that maps output layer names to `numpy.ndarray` objects with output data of the layer
+    #
+    #  Usage example:\n
+    #  ```python
+    #  exec_net = ie_core.load_network(network=net, device_name="CPU", num_requests=2)
+    #  request = exec_net.requests[0]
+    #  request.infer({input_blob: image})
+    #  res = request.get_output_arrays()['prob']
+    #  top = np.argmax(res)
+    #  ```
+    def get_output_arrays(self, copy=False):
+        output_arrays = {}
+        for output in self._outputs_list:
+            array = self._get_blob_buffer(output.encode()).to_numpy()
+            output_arrays[output] = array.copy() if copy else array
+        return output_arrays
+
     ## Dictionary that maps input layer names to corresponding preprocessing information
     @property
     def preprocess_info(self):
@@ -1169,6 +1195,10 @@ cdef class InferRequest:
     #
     #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
     #                 input data for the layer
+    #  @param share_inputs: If True, the arrays are set as the input blobs of the request without copying.
+    #                       The arrays have to be C-contiguous and have the dtype of the input precision.
+    #                       The request keeps the references to the arrays, their content must not be changed
+    #                       until the inference is finished. False by default, the data is copied to the request blobs.
     #  @return None
     #
     #  Usage example:\n
@@ -1181,15 +1211,17 @@ cdef class InferRequest:
     #         5.45198545e-02, 2.44456064e-02, 5.41366823e-03, 3.42589128e-03,
     #         2.26027006e-03, 2.12283316e-03 ...])
     #  ```
-    cpdef infer(self, inputs=None):
+    cpdef infer(self, inputs=None, share_inputs=False):
         if inputs is not None:
-            self._fill_inputs(inputs)
+            self._set_inputs(inputs, share_inputs)
         with nogil:
             deref(self.impl).infer()
 
     ## Starts asynchronous inference of the infer request and fill outputs array
     #
     #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with input data for the layer
+    #  @param share_inputs: If True, the arrays are set as the input blobs of the request without copying,
+    #                       see `infer()`. The arrays must not be changed until the request is completed.
     #  @return: None
     #
     #  Usage example:\n
@@ -1199,9 +1231,9 @@ cdef class InferRequest:
     #  request_status = exec_net.requests[0].wait()
     #  res = exec_net.requests[0].output_blobs['prob']
     #  ```
-    cpdef async_infer(self, inputs=None):
+    cpdef async_infer(self, inputs=None, share_inputs=False):
         if inputs is not None:
-            self._fill_inputs(inputs)
+            self._set_inputs(inputs, share_inputs)
         if self._py_callback_used:
             self._py_callback_called.clear()
         with nogil:
@@ -1313,15 +1345,180 @@ cdef class InferRequest:
             raise ValueError(f"Batch size should be positive integer number but {size} specified")
         deref(self.impl).setBatch(size)
 
+    def _set_inputs(self, inputs, share_inputs):
+        if share_inputs:
+            self._share_inputs(inputs)
+        else:
+            self._fill_inputs(inputs)
+
+    def _share_inputs(self, inputs):
+        for k, v in inputs.items():
+            assert k in self._inputs_list, f"No input with name {k} found in network"
+            self.set_blob(k, _make_input_blob(k, v, self.input_blobs[k].tensor_desc, True))
+            self._shared_inputs.add(k)
+
     def _fill_inputs(self, inputs):
         for k, v in inputs.items():
             assert k in self._inputs_list, f"No input with name {k} found in network"
+            if k in self._shared_inputs:
+                # the data must not be written to the array shared by the previous inference
+                self.set_blob(k, Blob(self.input_blobs[k].tensor_desc))
+                self._shared_inputs.discard(k)
             if self.input_blobs[k].tensor_desc.precision == "FP16":
                 self.input_blobs[k].buffer[:] = v.view(dtype=np.int16)
             else:
                 self.input_blobs[k].buffer[:] = v
 
 
+# Creates the blob of the input data, the blob keeps the reference to the array. If share is True, the blob is created
+# over the array memory, otherwise over the copy of the array converted to the input precision
+def _make_input_blob(name, array, TensorDesc tensor_desc, share):
+    if share:
+        if not isinstance(array, np.ndarray) or not array.flags['C_CONTIGUOUS']:
+            raise ValueError(f"Input {name} can't be shared: C-contiguous numpy.ndarray is expected")
+        if array.dtype != format_map[tensor_desc.precision]:
+            raise ValueError(f"Input {name} can't be shared: data type {array.dtype} of provided numpy array "
+                             f"doesn't match to input precision {tensor_desc.precision}")
+    else:
+        array = np.array(array, dtype=format_map[tensor_desc.precision], order="C")
+    return Blob(TensorDesc(tensor_desc.precision, array.shape, tensor_desc.layout), array)
+
+
+ctypedef extern void (*queue_cb_type)(void*, const vector[C.AsyncInferQueue.Completion] &) with gil
+
+## This class runs the asynchronous inference of the jobs on the pool of infer requests. The jobs are submitted
+#  without blocking: a job is started on an idle infer request or waits in the queue until a request is completed.
+#  The completion callbacks are called on the dedicated thread, which takes the GIL once for all the requests
+#  completed at the moment, so the pipelines keep all the infer requests of the device busy.
+#
+#  \note The infer request is reused for the next job after its callback returns, so the output arrays of the request
+#  can be read in the callback without copying.
+#
+#  Usage example:\n
+#  ```python
+#  ie = IECore()
+#  net = ie.read_network(model="./model.xml", weights="./model.bin")
+#  exec_net = ie.load_network(net, "CPU")
+#  results = {}
+#  def callback(request, frame_id, status):
+#      results[frame_id] = np.argmax(request.get_output_arrays()["prob"])
+#
+#  queue = AsyncInferQueue(exec_net)
+#  queue.set_callback(callback)
+#  for frame_id, frame in enumerate(frames):
+#      queue.start_async({"data": frame}, frame_id)
+#  queue.wait_all()
+#  ```
+cdef class AsyncInferQueue:
+    ## Class constructor
+    #  @param network: ExecutableNetwork to create the infer requests of the queue
+    #  @param jobs: Number of the infer requests of the queue. If 0, the optimal number of
+    #               infer requests for the device is used. 0 by default.
+    #  @return Instance of AsyncInferQueue class
+    def __init__(self, ExecutableNetwork network, int jobs = 0):
+        self.impl.reset(new C.AsyncInferQueue(deref(network.impl), jobs))
+        self._exec_net = network
+        self._callback = None
+        self._callback_error = None
+        self._jobs = {}
+        self._next_job_id = 0
+        self._requests = []
+        inputs_list = list(network.input_info.keys())
+        outputs_list = list(network.outputs.keys())
+        for i in range(deref(self.impl).infer_requests.size()):
+            infer_request = InferRequest()
+            infer_request.impl = &(deref(self.impl).infer_requests[i])
+            infer_request._inputs_list = inputs_list
+            infer_request._outputs_list = outputs_list
+            self._requests.append(infer_request)
+        self._input_descs = {name: blob.tensor_desc for name, blob in self._requests[0].input_blobs.items()}
+        deref(self.impl).setCyCallback(<queue_cb_type> self._dispatch, <void *> self)
+
+    cdef void _dispatch(self, const vector[C.AsyncInferQueue.Completion] & batch) with gil:
+        cdef size_t completed = batch.size()
+        cdef size_t i
+        try:
+            for i in range(completed):
+                userdata, _ = self._jobs.pop(batch[i].job_id)
+                if self._callback is not None:
+                    try:
+                        self._callback(self._requests[batch[i].request_id], userdata, batch[i].status)
+                    except Exception as error:
+                        if self._callback_error is None:
+                            self._callback_error = error
+        finally:
+            # the jobs are dropped and their references are released even if the callback raised a BaseException
+            # (e.g. KeyboardInterrupt), every job keeps the reference to the queue, the queue may be released here
+            for i in range(completed):
+                self._jobs.pop(batch[i].job_id, None)
+            for i in range(completed):
+                Py_DECREF(self)
+
+    ## Sets the function that is called when a job is completed
+    #
+    #  @param callback: Function called with the infer request of the job, the user data of the job and
+    #                   the status code of the inference
+    #  @return None
+    def set_callback(self, callback):
+        self._callback = callback
+
+    ## Submits the job without blocking. The job is started on an idle infer request or waits until
+    #  a request is completed.
+    #
+    #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects with the input data
+    #  @param userdata: Any object that is passed to the callback of the job
+    #  @param share_inputs: If True, the arrays are used as the input blobs without copying, they must not be
+    #                       changed until the job is completed. False by default, the data is copied.
+    #  @return None
+    def start_async(self, inputs, userdata = None, share_inputs = False):
+        cdef map[string, CBlob.Ptr] c_inputs
+        cdef Blob blob
+        cdef size_t job_id = self._next_job_id
+        blobs = []
+        for k, v in inputs.items():
+            assert k in self._input_descs, f"No input with name {k} found in network"
+            blob = _make_input_blob(k, v, self._input_descs[k], share_inputs)
+            c_inputs[k.encode()] = blob._ptr
+            blobs.append(blob)
+        self._next_job_id += 1
+        self._jobs[job_id] = (userdata, blobs)
+        Py_INCREF(self)
+        with nogil:
+            deref(self.impl).startAsync(job_id, c_inputs)
+
+    ## Waits until all the submitted jobs are completed and their callbacks are called.
+    #  Raises the first exception raised by the callbacks since the previous call.
+    #
+    #  \note Must not be called from the callback
+    #  @return None
+    def wait_all(self):
+        with nogil:
+            deref(self.impl).waitAll()
+        if self._callback_error is not None:
+            error, self._callback_error = self._callback_error, None
+            raise error
+
+    ## Checks if the queue has an idle infer request, i.e. the next job is started immediately
+    #  @return True if there is an idle infer request
+    def is_ready(self):
+        cdef int request_id
+        with nogil:
+            request_id = deref(self.impl).getIdleRequestId()
+        return request_id != -1
+
+    ## Number of the infer requests of the queue
+    def __len__(self):
+        return len(self._requests)
+
+    ## Gets the infer request of the queue by the index to read its outputs or performance counters.
+    #  The infer requests of the queue are started only by the queue.
+    def __getitem__(self, i):
+        return self._requests[i]
+
+    def __iter__(self):
+        return iter(self._requests)
+
+
 ## This class contains the information about the network model read from IR and allows you to manipulate with
 #  some model parameters such as layers affinity and output layers.
 cdef class IENetwork:
@@ -391,14 +391,15 @@ void InferenceEnginePython::InferRequestWrap::infer() {
 }
 
 void InferenceEnginePython::InferRequestWrap::infer_async() {
-    request_queue_ptr->setRequestBusy(index);
+    if (request_queue_ptr)
+        request_queue_ptr->setRequestBusy(index);
     start_time = Time::now();
     request_ptr.StartAsync();
 }
 
 int InferenceEnginePython::InferRequestWrap::wait(int64_t timeout) {
     InferenceEngine::StatusCode code = request_ptr.Wait(timeout);
-    if (code != InferenceEngine::RESULT_NOT_READY) {
+    if (code != InferenceEngine::RESULT_NOT_READY && request_queue_ptr) {
         request_queue_ptr->setRequestIdle(index);
     }
     return static_cast<int>(code);
@@ -522,6 +523,146 @@ void InferenceEnginePython::IEExecNetwork::createInferRequests(int num_requests)
     }
 }
 
+InferenceEnginePython::AsyncInferQueue::AsyncInferQueue(IEExecNetwork& exec_network, int num_requests)
+    : network(exec_network.actual) {
+    if (0 == num_requests) {
+        num_requests = getOptimalNumberOfRequests(*network);
+    }
+    infer_requests.resize(num_requests);
+    request_jobs.resize(num_requests);
+
+    for (int i = 0; i < num_requests; ++i) {
+        InferRequestWrap& infer_request = infer_requests[i];
+        infer_request.index = i;
+        infer_request.request_ptr = network->CreateInferRequest();
+        infer_request.request_ptr
+            .SetCompletionCallback<std::function<void(InferenceEngine::InferRequest r, InferenceEngine::StatusCode)>>(
+                [this, i](InferenceEngine::InferRequest request, InferenceEngine::StatusCode code) {
+                    complete(i, code);
+                });
+        idle_ids.push_back(i);
+    }
+    dispatcher = std::thread(&AsyncInferQueue::dispatch, this);
+}
+
+InferenceEnginePython::AsyncInferQueue::~AsyncInferQueue() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopped = true;
+        completed_cv.notify_one();
+    }
+    if (std::this_thread::get_id() == dispatcher.get_id()) {
+        // the last reference to the queue is released by the callback, the dispatcher exits when it returns
+        *released = true;
+        dispatcher.detach();
+    } else {
+        dispatcher.join();
+    }
+}
+
+void InferenceEnginePython::AsyncInferQueue::setCyCallback(cy_callback callback, void* data) {
+    std::lock_guard<std::mutex> lock(mutex);
+    user_callback = callback;
+    user_data = data;
+}
+
+void InferenceEnginePython::AsyncInferQueue::startAsync(size_t job_id, const Inputs& inputs) {
+    int request_id;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (idle_ids.empty()) {
+            pending_jobs.push_back({job_id, inputs});
+            return;
+        }
+        request_id = idle_ids.front();
+        idle_ids.pop_front();
+        request_jobs[request_id] = job_id;
+    }
+    start(request_id, {job_id, inputs});
+}
+
+void InferenceEnginePython::AsyncInferQueue::waitAll() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle_cv.wait(lock, [this]() {
+        return idle_ids.size() == infer_requests.size();
+    });
+}
+
+int InferenceEnginePython::AsyncInferQueue::getIdleRequestId() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return idle_ids.size() ? idle_ids.front() : -1;
+}
+
+void InferenceEnginePython::AsyncInferQueue::start(int request_id, const Job& job) {
+    InferRequestWrap& infer_request = infer_requests[request_id];
+    try {
+        for (const auto& input : job.inputs) {
+            infer_request.request_ptr.SetBlob(input.first, input.second);
+        }
+        infer_request.start_time = Time::now();
+        infer_request.request_ptr.StartAsync();
+    } catch (const std::exception&) {
+        complete(request_id, static_cast<int>(InferenceEngine::StatusCode::GENERAL_ERROR));
+    }
+}
+
+void InferenceEnginePython::AsyncInferQueue::complete(int request_id, int status) {
+    InferRequestWrap& infer_request = infer_requests[request_id];
+    auto execTime = std::chrono::duration_cast<ns>(Time::now() - infer_request.start_time);
+    infer_request.exec_time = static_cast<double>(execTime.count()) * 0.000001;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    completions.push_back({request_id, request_jobs[request_id], status});
+    completed_cv.notify_one();
+}
+
+void InferenceEnginePython::AsyncInferQueue::recycle(int request_id) {
+    Job job;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (pending_jobs.empty()) {
+            idle_ids.push_back(request_id);
+            idle_cv.notify_all();
+            return;
+        }
+        job = std::move(pending_jobs.front());
+        pending_jobs.pop_front();
+        request_jobs[request_id] = job.id;
+    }
+    start(request_id, job);
+}
+
+void InferenceEnginePython::AsyncInferQueue::dispatch() {
+    bool queue_released = false;
+    std::vector<Completion> batch;
+    cy_callback callback;
+    void* data;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            released = &queue_released;
+            completed_cv.wait(lock, [this]() {
+                return stopped || !completions.empty();
+            });
+            if (stopped)
+                return;
+            batch.swap(completions);
+            callback = user_callback;
+            data = user_data;
+        }
+        // all the completions collected while the previous batch was processed are passed at once,
+        // so the callback takes the GIL once per batch
+        if (callback)
+            callback(data, batch);
+        if (queue_released)
+            return;
+        for (const auto& completion : batch) {
+            recycle(completion.request_id);
+        }
+        batch.clear();
+    }
+}
+
 InferenceEnginePython::IENetwork InferenceEnginePython::IECore::readNetwork(const std::string& modelPath,
                                                                             const std::string& binPath) {
     InferenceEngine::CNNNetwork net = actual.ReadNetwork(modelPath, binPath);
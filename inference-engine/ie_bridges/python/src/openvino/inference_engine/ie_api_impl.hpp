@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <ie_core.hpp>
 #include <iostream>
 #include <iterator>
@@ -19,6 +20,7 @@
 #include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -156,6 +158,60 @@ struct IEExecNetwork {
     std::shared_ptr<InferenceEngine::ExecutableNetwork> getPluginLink();
 };
 
+// Owns the infer requests and starts the submitted jobs on the idle ones. The jobs submitted when all the requests
+// are busy wait in the queue. The completions are passed to the callback in batches on the dedicated thread,
+// a request is reused for the next job after its completion is passed to the callback
+struct AsyncInferQueue {
+    struct Completion {
+        int request_id;
+        size_t job_id;
+        int status;
+    };
+
+    using Inputs = std::map<std::string, InferenceEngine::Blob::Ptr>;
+    using cy_callback = void (*)(void*, const std::vector<Completion>&);
+
+    std::vector<InferRequestWrap> infer_requests;
+
+    AsyncInferQueue(IEExecNetwork& network, int num_requests);
+    ~AsyncInferQueue();
+
+    void setCyCallback(cy_callback callback, void* data);
+
+    // doesn't block, the failure to start the job is reported as its completion status
+    void startAsync(size_t job_id, const Inputs& inputs);
+
+    // waits until all the jobs are completed and passed to the callback
+    void waitAll();
+
+    int getIdleRequestId();
+
+private:
+    struct Job {
+        size_t id;
+        Inputs inputs;
+    };
+
+    void start(int request_id, const Job& job);
+    void complete(int request_id, int status);
+    void recycle(int request_id);
+    void dispatch();
+
+    std::shared_ptr<InferenceEngine::ExecutableNetwork> network;
+    std::mutex mutex;
+    std::condition_variable completed_cv;
+    std::condition_variable idle_cv;
+    std::list<int> idle_ids;
+    std::deque<Job> pending_jobs;
+    std::vector<size_t> request_jobs;
+    std::vector<Completion> completions;
+    cy_callback user_callback = nullptr;
+    void* user_data = nullptr;
+    bool stopped = false;
+    bool* released = nullptr;
+    std::thread dispatcher;
+};
+
 struct IECore {
     InferenceEngine::Core actual;
     explicit IECore(const std::string& xmlConfigFile = std::string());
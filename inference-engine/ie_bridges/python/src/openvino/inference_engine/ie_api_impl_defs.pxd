@@ -198,6 +198,18 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         void setCyCallback(void (*)(void*, int), void *) except +
         vector[CVariableState] queryState() except +
 
+    cdef cppclass AsyncInferQueue:
+        cppclass Completion:
+            int request_id
+            size_t job_id
+            int status
+        vector[InferRequestWrap] infer_requests
+        AsyncInferQueue(IEExecNetwork & network, int num_requests) except +
+        void setCyCallback(void (*)(void*, const vector[Completion] &), void *) except +
+        void startAsync(size_t job_id, const map[string, CBlob.Ptr] & inputs) nogil except +
+        void waitAll() nogil
+        int getIdleRequestId() nogil
+
     cdef cppclass IECore:
         IECore() nogil except +
         IECore(const string & xml_config_file) nogil except +
@@ -0,0 +1,140 @@
+# Copyright (C) 2018-2021 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import numpy as np
+import os
+import pytest
+import sys
+import time
+
+from openvino.inference_engine import ie_api as ie
+from conftest import model_path, image_path
+
+is_myriad = os.environ.get("TEST_DEVICE") == "MYRIAD"
+test_net_xml, test_net_bin = model_path(is_myriad)
+path_to_img = image_path()
+
+
+def read_image():
+    import cv2
+    n, c, h, w = (1, 3, 32, 32)
+    image = cv2.imread(path_to_img)
+    if image is None:
+        raise FileNotFoundError("Input image not found")
+
+    image = cv2.resize(image, (h, w)) / 255
+    image = image.transpose((2, 0, 1)).astype(np.float32)
+    image = image.reshape((n, c, h, w))
+    return image
+
+
+def load_sample_model(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    return ie_core.load_network(net, device)
+
+
+def test_create_queue(device):
+    exec_net = load_sample_model(device)
+    queue = ie.AsyncInferQueue(exec_net, 3)
+    assert len(queue) == 3
+    assert queue.is_ready()
+    for request in queue:
+        assert isinstance(request, ie.InferRequest)
+    del queue
+    del exec_net
+
+
+def test_start_async_more_jobs_than_requests(device):
+    exec_net = load_sample_model(device)
+    queue = ie.AsyncInferQueue(exec_net, 2)
+    img = read_image()
+    results = {}
+
+    def callback(request, userdata, status):
+        results[userdata] = (status, np.argmax(request.get_output_arrays()['fc_out']))
+
+    queue.set_callback(callback)
+    jobs = 10
+    for i in range(jobs):
+        queue.start_async({'data': img}, i)
+    queue.wait_all()
+    assert queue.is_ready()
+    assert sorted(results.keys()) == list(range(jobs))
+    for status, top in results.values():
+        assert status == ie.StatusCode.OK
+        assert top == 2
+    del queue
+    del exec_net
+
+
+@pytest.mark.parametrize("share_inputs", [True, False])
+def test_start_async_inputs_ownership(device, share_inputs):
+    exec_net = load_sample_model(device)
+    queue = ie.AsyncInferQueue(exec_net, 1)
+    tops = []
+    queue.set_callback(lambda request, userdata, status:
+                       tops.append(np.argmax(request.get_output_arrays()['fc_out'])))
+    # the arrays are released by the caller right after the submission
+    for _ in range(4):
+        queue.start_async({'data': read_image()}, share_inputs=share_inputs)
+    queue.wait_all()
+    assert tops == [2] * 4
+    del queue
+    del exec_net
+
+
+def test_callback_error_raised_by_wait_all(device):
+    exec_net = load_sample_model(device)
+    queue = ie.AsyncInferQueue(exec_net, 2)
+
+    def callback(request, userdata, status):
+        raise RuntimeError(f"job {userdata}")
+
+    queue.set_callback(callback)
+    queue.start_async({'data': read_image()}, 0)
+    with pytest.raises(RuntimeError) as e:
+        queue.wait_all()
+    assert "job 0" in str(e.value)
+    # the error is raised once
+    queue.wait_all()
+    del queue
+    del exec_net
+
+
+@pytest.mark.filterwarnings("ignore::pytest.PytestUnraisableExceptionWarning")
+def test_callback_base_exception_releases_jobs(device):
+    exec_net = load_sample_model(device)
+    queue = ie.AsyncInferQueue(exec_net, 2)
+    refcount = sys.getrefcount(queue)
+
+    class Interrupt(BaseException):
+        pass
+
+    def callback(request, userdata, status):
+        raise Interrupt(f"job {userdata}")
+
+    queue.set_callback(callback)
+    for i in range(4):
+        queue.start_async({'data': read_image()}, i)
+    queue.wait_all()
+    # the BaseException is not stored for wait_all, but the jobs still release their references to the queue
+    assert sys.getrefcount(queue) == refcount
+    del queue
+    del exec_net
+
+
+def test_queue_released_with_running_jobs(device):
+    exec_net = load_sample_model(device)
+    queue = ie.AsyncInferQueue(exec_net, 2)
+    completed = []
+    queue.set_callback(lambda request, userdata, status: completed.append(userdata))
+    for i in range(4):
+        queue.start_async({'data': read_image()}, i)
+    # the queue is alive until its jobs are completed
+    del queue
+    deadline = time.time() + 60
+    while len(completed) != 4 and time.time() < deadline:
+        time.sleep(0.01)
+    assert sorted(completed) == list(range(4))
+    del exec_net
@@ -39,6 +39,18 @@ def test_infer(device):
     del ie_core
 
 
+def test_infer_without_copy_outputs(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(model=test_net_xml, weights=test_net_bin)
+    exec_net = ie_core.load_network(net, device)
+    img = read_image()
+    res = exec_net.infer({'data': img}, share_inputs=True, copy_outputs=False)
+    assert np.argmax(res['fc_out'][0]) == 2
+    assert np.shares_memory(res['fc_out'], exec_net.requests[0].get_output_arrays()['fc_out'])
+    del exec_net
+    del ie_core
+
+
 def test_infer_net_from_buffer(device):
     ie_core = ie.IECore()
     with open(test_net_bin, 'rb') as f:
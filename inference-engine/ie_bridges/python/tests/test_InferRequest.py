@@ -155,6 +155,57 @@ def test_infer(device):
     del net
 
 
+def test_infer_share_inputs(device):
+    exec_net = load_sample_model(device)
+    img = read_image()
+    request = exec_net.requests[0]
+    request.infer({'data': img}, share_inputs=True)
+    assert np.argmax(request.get_output_arrays()['fc_out']) == 2
+    # the input blob is created over the memory of the array
+    assert np.shares_memory(request.input_blobs['data'].buffer, img)
+    del exec_net
+
+
+def test_infer_share_inputs_then_copy(device):
+    exec_net = load_sample_model(device)
+    img = read_image()
+    shared = img.copy()
+    request = exec_net.requests[0]
+    request.infer({'data': shared}, share_inputs=True)
+    request.infer({'data': np.zeros_like(img)})
+    # the copied data doesn't overwrite the array shared by the previous inference
+    assert np.array_equal(shared, img)
+    del exec_net
+
+
+@pytest.mark.parametrize("array", [np.ones((1, 32, 32, 3), dtype=np.float32).transpose((0, 3, 1, 2)),
+                                   np.ones((1, 3, 32, 32), dtype=np.float64)])
+def test_infer_share_inputs_not_matching_array(device, array):
+    exec_net = load_sample_model(device)
+    with pytest.raises(ValueError) as e:
+        exec_net.requests[0].infer({'data': array}, share_inputs=True)
+    assert "can't be shared" in str(e.value)
+    del exec_net
+
+
+def test_get_output_arrays(device):
+    exec_net = load_sample_model(device)
+    img = read_image()
+    request = exec_net.requests[0]
+    request.infer({'data': img})
+    view = request.get_output_arrays()['fc_out']
+    copy = request.get_output_arrays(copy=True)['fc_out']
+    assert np.argmax(view) == 2
+    assert np.array_equal(view, copy)
+    assert np.shares_memory(view, request.get_output_arrays()['fc_out'])
+    assert not np.shares_memory(view, copy)
+    # the view is overwritten by the next inference, the copy isn't
+    request.infer({'data': np.zeros_like(img)})
+    assert np.array_equal(view, request.get_output_arrays()['fc_out'])
+    assert np.argmax(copy) == 2
+    del exec_net
+
+
 def test_async_infer_default_timeout(device):
     ie_core = ie.IECore()
     net = ie_core.read_network(test_net_xml, test_net_bin)
@@ -17,7 +17,7 @@ AutoExecutableNetwork::AutoExecutableNetwork(NetworkFuture cpuFuture,
                                              NetworkFuture acceleratorFuture,
                                              bool          enablePerfCount)
                                              : _cpuFuture(std::move(cpuFuture))
-                                             , _acceleratorFuture(std::move(acceleratorFuture))
+                                             , _acceleratorFuture(acceleratorFuture.share())
                                              , _enablePerfCount(enablePerfCount) {
     // both are valid, like AUTO:CPU,GPU
     if (_cpuFuture.valid() && _acceleratorFuture.valid()) {
@@ -45,50 +45,85 @@ AutoExecutableNetwork::~AutoExecutableNetwork() = default;
 InferenceEngine::IInferRequestInternal::Ptr AutoExecutableNetwork::CreateInferRequestImpl(InputsDataMap networkInputs,
                                                                                           OutputsDataMap networkOutputs) {
     InferenceEngine::SoExecutableNetworkInternal network;
-    SoIInferRequestInternal inferRequest;
-    if (TryGetActualNetwork(network)) {
-        inferRequest = {_networkActualNeeded, _networkActualNeeded->CreateInferRequest()};
-    } else {
-        inferRequest = {_networkFirstReady, _networkFirstReady->CreateInferRequest()};
+    // the flag is derived from the chosen network: the actual network may be switched to right after the check,
+    // then the request created on CPU is hot-swapped on the first inference
+    const bool alreadyActualNetwork = TryGetActualNetwork(network);
+    if (!alreadyActualNetwork) {
+        network = GetCurrentNetwork();
     }
-    return std::make_shared<AutoInferRequest>(_networkInputs, _networkOutputs, inferRequest,
-                                              shared_from_this(), _alreadyActualNetwork,
+    SoIInferRequestInternal inferRequest = {network, network->CreateInferRequest()};
+    return std::make_shared<AutoInferRequest>(_networkInputs, _networkOutputs, network, inferRequest,
+                                              shared_from_this(), alreadyActualNetwork,
                                               _enablePerfCount);
 }
 
-bool AutoExecutableNetwork::TryGetActualNetwork(InferenceEngine::SoExecutableNetworkInternal& soExecNetwork) {
-    // try to get actual network
-    if (_acceleratorFuture.valid() && _acceleratorFuture.wait_for(std::chrono::nanoseconds(0)) == std::future_status::ready) {
-        soExecNetwork = _acceleratorFuture.get();
-        _alreadyActualNetwork = true;
-        _networkActualNeeded = soExecNetwork;
+void AutoExecutableNetwork::SwitchToActualNetwork(InferenceEngine::SoExecutableNetworkInternal actualNetwork) const {
+    _networkActualNeeded = actualNetwork;
+    _alreadyActualNetwork = true;
+    // new requests are created on the actual network only, so the CPU one is kept alive
+    // just by the requests that have not been hot-swapped yet
+    _networkFirstReady = {};
+}
+
+void AutoExecutableNetwork::SwitchToReadyAcceleratorNetwork() const {
+    // the shared state of the future is read without the _mutex, the get() of the copy doesn't block here
+    InferenceEngine::SoExecutableNetworkInternal acceleratorNetwork;
+    std::string error;
+    try {
+        acceleratorNetwork = NetworkSharedFuture(_acceleratorFuture).get();
+    } catch (const std::exception& e) {
+        error = e.what();
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_alreadyActualNetwork) {
+        return;
+    }
+    if (acceleratorNetwork) {
         // reapply config to actual network
         // fixme: GPU doesn't support SetConfig and throw exception
         try {
-            _networkActualNeeded->SetConfig(_cacheConfig);
+            acceleratorNetwork->SetConfig(_cacheConfig);
         } catch (...) {
         }
-        return true;
+        SwitchToActualNetwork(acceleratorNetwork);
+    } else if (_networkFirstReady) {
+        // the accelerator failed to load the network, so the CPU one is the actual one
+        printf("Warning: load network to accelerator failed: %s\n", error.c_str());
+        SwitchToActualNetwork(_networkFirstReady);
+    } else {
+        IE_THROW() << "Load network to accelerator failed: " << error;
     }
-    // if already get actual network
-    if (_alreadyActualNetwork) {
-        soExecNetwork = _networkActualNeeded;
-        return true;
+}
+
+bool AutoExecutableNetwork::TryGetActualNetwork(InferenceEngine::SoExecutableNetworkInternal& soExecNetwork) {
+    if (!_alreadyActualNetwork) {
+        if (!_acceleratorFuture.valid() ||
+            NetworkSharedFuture(_acceleratorFuture).wait_for(std::chrono::nanoseconds(0)) != std::future_status::ready) {
+            return false;
+        }
+        SwitchToReadyAcceleratorNetwork();
     }
-    return false;
+    std::lock_guard<std::mutex> lock(_mutex);
+    soExecNetwork = _networkActualNeeded;
+    return true;
+}
+
+InferenceEngine::SoExecutableNetworkInternal AutoExecutableNetwork::GetCurrentNetwork() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _alreadyActualNetwork ? _networkActualNeeded : _networkFirstReady;
 }
 
 void AutoExecutableNetwork::WaitForActualDevice() const {
     if (_alreadyActualNetwork) {
         return;
     }
-
-    if (_acceleratorFuture.valid()) {
-        _networkActualNeeded = _acceleratorFuture.get();
-        _alreadyActualNetwork = true;
-    } else {
+    if (!_acceleratorFuture.valid()) {
         IE_THROW() << "Export failed due to no valid executable network";
     }
+    // the wait doesn't hold the _mutex, so the inference on CPU goes on until the accelerator is ready
+    NetworkSharedFuture(_acceleratorFuture).wait();
+    SwitchToReadyAcceleratorNetwork();
 }
 
 void AutoExecutableNetwork::Export(std::ostream& networkModel) {
@@ -109,17 +144,13 @@ InferenceEngine::CNNNetwork AutoExecutableNetwork::GetExecGraphInfo() {
 }
 
 Parameter AutoExecutableNetwork::GetMetric(const std::string &name) const {
-    // fixme: should we wait actual device? meanwhile it will block inference, how to fix?
-//    WaitForActualDevice();
-    if (_alreadyActualNetwork) {
-        return _networkActualNeeded->GetMetric(name);
-    } else {
-        return _networkFirstReady->GetMetric(name);
-    }
+    // the metric is taken from the network that serves the new requests at the moment
+    return GetCurrentNetwork()->GetMetric(name);
 }
 
 void AutoExecutableNetwork::SetConfig(const std::map<std::string, Parameter>& config) {
-    //fixme: have to store the config and reapply when the networks swapped
+    // the config is stored to be reapplied when the networks are swapped
+    std::lock_guard<std::mutex> lock(_mutex);
     _cacheConfig = config;
     if (_alreadyActualNetwork) {
         _networkActualNeeded->SetConfig(config);
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <atomic>
+#include <future>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
@@ -19,6 +20,7 @@ namespace AutoPlugin {
 
 using DeviceName = std::string;
 using NetworkFuture = std::future<InferenceEngine::SoExecutableNetworkInternal>;
+using NetworkSharedFuture = std::shared_future<InferenceEngine::SoExecutableNetworkInternal>;
 
 class AutoExecutableNetwork : public InferenceEngine::IExecutableNetworkInternal {
 public:
@@ -42,13 +44,23 @@ public:
 
 private:
     void WaitForActualDevice() const;
+    // must be called when the accelerator future is ready and not under the _mutex
+    void SwitchToReadyAcceleratorNetwork() const;
+    // must be called under the _mutex
+    void SwitchToActualNetwork(InferenceEngine::SoExecutableNetworkInternal actualNetwork) const;
+    InferenceEngine::SoExecutableNetworkInternal GetCurrentNetwork() const;
 
 private:
-    InferenceEngine::SoExecutableNetworkInternal _networkFirstReady;
+    // the CPU network is released once the actual network is ready,
+    // the requests that are still bound to it keep it alive until they are hot-swapped
+    mutable InferenceEngine::SoExecutableNetworkInternal _networkFirstReady;
     mutable InferenceEngine::SoExecutableNetworkInternal _networkActualNeeded;
     NetworkFuture _cpuFuture;
-    mutable NetworkFuture _acceleratorFuture;
+    // the shared future is waited for without the _mutex, so the requests served by CPU are not blocked meanwhile
+    const NetworkSharedFuture _acceleratorFuture;
     bool _enablePerfCount;
+    // guards the networks, which can be accessed from many requests simultaneously
+    mutable std::mutex _mutex;
     mutable std::atomic<bool> _alreadyActualNetwork = {false};
     std::map<std::string, InferenceEngine::Parameter> _cacheConfig;
 };
@@ -12,11 +12,13 @@ namespace AutoPlugin {
 
 AutoInferRequest::AutoInferRequest(const InputsDataMap&              networkInputs,
                                    const OutputsDataMap&             networkOutputs,
+                                   const SoExecutableNetworkInternal& network,
                                    const SoIInferRequestInternal&    inferRequest,
                                    const InferenceEngine::IExecutableNetworkInternal::Ptr autoExecutableNetwork,
                                    bool alreadyActualNetwork,
                                    bool enablePerfCount)
     : IInferRequestInternal(networkInputs, networkOutputs)
+    , _network(network)
     , _inferRequest(inferRequest)
     , _autoExecutableNetwork(std::dynamic_pointer_cast<AutoPlugin::AutoExecutableNetwork>(autoExecutableNetwork))
     , _alreadyActualNetwork(alreadyActualNetwork)
@@ -48,10 +50,13 @@ void AutoInferRequest::InferImpl() {
 
 void AutoInferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& data) {
     IInferRequestInternal::SetBlob(name, data);
+    _userVisibleBlobs.insert(name);
 }
 
 Blob::Ptr AutoInferRequest::GetBlob(const std::string& name) {
-    return IInferRequestInternal::GetBlob(name);
+    auto blob = IInferRequestInternal::GetBlob(name);
+    _userVisibleBlobs.insert(name);
+    return blob;
 }
 
 void AutoInferRequest::Cancel() {
@@ -78,8 +83,24 @@ void AutoInferRequest::HotSwapRequests() {
         InferenceEngine::SoExecutableNetworkInternal tempSoExecNetwork;
         if (_autoExecutableNetwork->TryGetActualNetwork(tempSoExecNetwork)) {
             _alreadyActualNetwork = true;
+            // e.g. the accelerator failed to load the network, so the request already works with the actual one
+            if (tempSoExecNetwork.operator->() == _network.operator->()) {
+                return;
+            }
+            // the previous device request (and the network, once all the requests are swapped) is released here
+            _network = tempSoExecNetwork;
             _inferRequest = {tempSoExecNetwork, tempSoExecNetwork->CreateInferRequest()};
             _inferRequest->SetCallback(_callback);
+            // remap the blobs the user has never seen to the blobs of the new device request to save on the copies,
+            // the rest are kept as is (and set to the new device request) so the user's pointers stay valid
+            for (const auto &it : _networkInputs) {
+                if (_userVisibleBlobs.find(it.first) == _userVisibleBlobs.end())
+                    _inputs[it.first] = _inferRequest->GetBlob(it.first);
+            }
+            for (const auto &it : _networkOutputs) {
+                if (_userVisibleBlobs.find(it.first) == _userVisibleBlobs.end())
+                    _outputs[it.first] = _inferRequest->GetBlob(it.first);
+            }
         }
     }
 }
@@ -88,14 +109,15 @@ void AutoInferRequest::SetBlobsToDeviceRequest() {
         for (const auto &it : _networkInputs) {
             const auto &name = it.first;
             // this assumes the request is already in BUSY state
-            auto blob = GetBlob(name);
+            // (the base class version is used, so the blob is not considered as the user-visible one)
+            auto blob = IInferRequestInternal::GetBlob(name);
             if (_inferRequest->GetBlob(name) != blob)
                 _inferRequest->SetBlob(name, blob);
         }
         for (const auto &it : _networkOutputs) {
             const auto &name = it.first;
             // this assumes the request is already in BUSY state
-            auto blob = GetBlob(name);
+            auto blob = IInferRequestInternal::GetBlob(name);
             if (_inferRequest->GetBlob(name) != blob)
                 _inferRequest->SetBlob(name, blob);
         }
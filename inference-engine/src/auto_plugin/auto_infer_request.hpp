@@ -14,6 +14,7 @@
 #include <queue>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -26,6 +27,7 @@ public:
     using Ptr = std::shared_ptr<AutoInferRequest>;
     explicit AutoInferRequest(const InferenceEngine::InputsDataMap&             networkInputs,
                               const InferenceEngine::OutputsDataMap&            networkOutputs,
+                              const InferenceEngine::SoExecutableNetworkInternal& network,
                               const InferenceEngine::SoIInferRequestInternal&   inferRequest,
                               const InferenceEngine::IExecutableNetworkInternal::Ptr executeNetwork,
                               bool alreadyActualNetwork,
@@ -45,7 +47,11 @@ private:
     void SetBlobsToDeviceRequest();
 
 private:
+    InferenceEngine::SoExecutableNetworkInternal _network;  // the network the _inferRequest is created from
     InferenceEngine::SoIInferRequestInternal _inferRequest;
+    // names of the blobs that were handed out to (or set by) the user, these keep the same blob objects after the
+    // hot-swap, while the rest are replaced with the (device-friendly) blobs of the new device request
+    std::unordered_set<std::string> _userVisibleBlobs;
     AutoPlugin::AutoExecutableNetwork::Ptr _autoExecutableNetwork;
     Callback _callback; // need to save the callback for hot-swap of the requests
     bool _alreadyActualNetwork{ false };
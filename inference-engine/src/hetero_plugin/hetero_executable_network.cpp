@@ -47,6 +47,56 @@ using namespace InferenceEngine::HeteroConfigParams;
 template<typename T>
 using NodeMap = std::unordered_map<ngraph::Node*, T>;
 
+namespace {
+
+void SerializeSubnetwork(const CNNNetwork& subnet, std::ostream& heteroModel) {
+    if (!subnet.getFunction()) {
+        IE_THROW() << "Hetero plugin supports only ngraph function representation";
+    }
+
+    // Note: custom ngraph extensions are not supported
+    std::stringstream xmlFile, binFile;
+    ngraph::pass::Serialize serializer(xmlFile, binFile,
+        ngraph::pass::Serialize::Version::IR_V10);
+    serializer.run_on_function(subnet.getFunction());
+
+    auto m_constants = binFile.str();
+    auto m_model = xmlFile.str();
+
+    auto dataSize = static_cast<std::uint64_t>(m_model.size());
+    heteroModel.write(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+    heteroModel.write(m_model.c_str(), dataSize);
+
+    dataSize = static_cast<std::uint64_t>(m_constants.size());
+    heteroModel.write(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+    heteroModel.write(reinterpret_cast<char*>(&m_constants[0]), dataSize);
+}
+
+CNNNetwork ReadSubnetwork(std::istream& heteroModel, InferenceEngine::ICore& core) {
+    // read XML content
+    std::string xmlString;
+    std::uint64_t dataSize = 0;
+    heteroModel.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+    xmlString.resize(dataSize);
+    heteroModel.read(const_cast<char*>(xmlString.c_str()), dataSize);
+
+    // read blob content
+    InferenceEngine::Blob::Ptr dataBlob;
+    heteroModel.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+    if (0 != dataSize) {
+        dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
+            InferenceEngine::TensorDesc(InferenceEngine::Precision::U8,
+                                        {static_cast<std::size_t>(dataSize)},
+                                        InferenceEngine::Layout::C));
+        dataBlob->allocate();
+        heteroModel.read(dataBlob->buffer(), dataSize);
+    }
+
+    return core.ReadNetwork(xmlString, std::move(dataBlob));
+}
+
+}  // namespace
+
 HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwork&     network,
                                                  const Engine::Configs&                 config,
                                                  Engine*                                plugin):
@@ -421,9 +471,34 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
                 }
             }}.run_on_function(ngraph::clone_function(*function));
     }
+    const bool cacheEnabled = _heteroPlugin->GetCore()->IsCacheEnabled();
     for (auto&& network : _networks) {
         auto metaDevices = _heteroPlugin->GetDevicePlugins(network._device, _config);
-        metaDevices[network._device].emplace(CONFIG_KEY_INTERNAL(FORCE_DISABLE_CACHE), "");
+        if (cacheEnabled && _heteroPlugin->GetCore()->DeviceSupportsImportExport(network._device)) {
+            // The subnetwork is cached by the device under its own hash, while the HETERO cache entry keeps
+            // the partitioning and the subnetwork IR. The subnetwork goes through the same IR round trip
+            // as on the import, so the device cache entry is found by the same hash then
+            std::stringstream subnetworkModel;
+            SerializeSubnetwork(network._clonedNetwork, subnetworkModel);
+            auto subnetwork = ReadSubnetwork(subnetworkModel, *_heteroPlugin->GetCore());
+            auto clonedInputs = network._clonedNetwork.getInputsInfo();
+            for (auto&& input : subnetwork.getInputsInfo()) {
+                auto& clonedInput = clonedInputs.at(input.first);
+                input.second->getPreProcess() = clonedInput->getPreProcess();
+                input.second->setPrecision(clonedInput->getPrecision());
+                input.second->setLayout(clonedInput->getLayout());
+            }
+            auto clonedOutputs = network._clonedNetwork.getOutputsInfo();
+            for (auto&& output : subnetwork.getOutputsInfo()) {
+                auto& clonedOutput = clonedOutputs.at(output.first);
+                output.second->setPrecision(clonedOutput->getPrecision());
+                output.second->setLayout(clonedOutput->getLayout());
+            }
+            network._clonedNetwork = subnetwork;
+            network._cachedOnDevice = true;
+        } else {
+            metaDevices[network._device].emplace(CONFIG_KEY_INTERNAL(FORCE_DISABLE_CACHE), "");
+        }
         network._network = _heteroPlugin->GetCore()->LoadNetwork(network._clonedNetwork,
             network._device, metaDevices[network._device]);
     }
@@ -487,34 +562,20 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
         InferenceEngine::SoExecutableNetworkInternal executableNetwork;
         CNNNetwork cnnnetwork;
         bool loaded = false;
-        if (_heteroPlugin->GetCore()->DeviceSupportsImportExport(deviceName)) {
+        // the subnetwork IR is stored for the networks that are cached by the device itself
+        const bool cachedOnDevice = GetBoolAttr(subnetworkNode, "cached_on_device", false);
+        if (!cachedOnDevice && _heteroPlugin->GetCore()->DeviceSupportsImportExport(deviceName)) {
             executableNetwork = _heteroPlugin->GetCore()->ImportNetwork(heteroModel, deviceName, loadConfig);
         } else {
-            // read XML content
-            std::string xmlString;
-            std::uint64_t dataSize = 0;
-            heteroModel.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
-            xmlString.resize(dataSize);
-            heteroModel.read(const_cast<char*>(xmlString.c_str()), dataSize);
-
-            // read blob content
-            InferenceEngine::Blob::Ptr dataBlob;
-            heteroModel.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
-            if (0 != dataSize) {
-                dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
-                    InferenceEngine::TensorDesc(InferenceEngine::Precision::U8,
-                                                {static_cast<std::size_t>(dataSize)},
-                                                InferenceEngine::Layout::C));
-                dataBlob->allocate();
-                heteroModel.read(dataBlob->buffer(), dataSize);
-            }
-
-            cnnnetwork = _heteroPlugin->GetCore()->ReadNetwork(xmlString, std::move(dataBlob));
+            cnnnetwork = ReadSubnetwork(heteroModel, *_heteroPlugin->GetCore());
             auto inputs = cnnnetwork.getInputsInfo();
             auto inputsNode = subnetworkNode.child("inputs");
             FOREACH_CHILD(inputNode, inputsNode, "input") {
                 auto inputName = GetStrAttr(inputNode, "name");
                 inputs[inputName]->setPrecision(Precision::FromStr(GetStrAttr(inputNode, "precision")));
+                if (!inputNode.attribute("layout").empty()) {
+                    inputs[inputName]->setLayout(static_cast<Layout>(GetIntAttr(inputNode, "layout")));
+                }
             }
 
             auto outputs = cnnnetwork.getOutputsInfo();
@@ -522,8 +583,12 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
             FOREACH_CHILD(outputNode, outputsNode, "output") {
                 auto outputName = GetStrAttr(outputNode, "name");
                 outputs[outputName]->setPrecision(Precision::FromStr(GetStrAttr(outputNode, "precision")));
+                if (!outputNode.attribute("layout").empty()) {
+                    outputs[outputName]->setLayout(static_cast<Layout>(GetIntAttr(outputNode, "layout")));
+                }
             }
 
+            // goes through the device's cache, if the network is cached on the device
             executableNetwork = _heteroPlugin->GetCore()->LoadNetwork(cnnnetwork, deviceName, loadConfig);
             loaded = true;
         }
@@ -545,6 +610,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
             deviceName,
             loaded ? cnnnetwork : CNNNetwork{},
             executableNetwork,
+            cachedOnDevice,
         });
     }
 
@@ -576,6 +642,9 @@ void HeteroExecutableNetwork::Export(std::ostream& heteroModel) {
 
         auto subnetworkNode = subnetworksNode.append_child("subnetwork");
         subnetworkNode.append_attribute("device").set_value(subnetwork._device.c_str());
+        if (subnetwork._cachedOnDevice) {
+            subnetworkNode.append_attribute("cached_on_device").set_value(true);
+        }
 
         // inputs info
         auto subnetworkInputsNode = subnetworkNode.append_child("inputs");
@@ -584,6 +653,10 @@ void HeteroExecutableNetwork::Export(std::ostream& heteroModel) {
             auto inputNode = subnetworkInputsNode.append_child("input");
             inputNode.append_attribute("name").set_value(input.first.c_str());
             inputNode.append_attribute("precision").set_value(input.second->getPrecision().name());
+            if (subnetwork._cachedOnDevice) {
+                // is a part of the device cache entry hash
+                inputNode.append_attribute("layout").set_value(static_cast<int>(input.second->getLayout()));
+            }
         }
 
         // outputs info
@@ -593,6 +666,10 @@ void HeteroExecutableNetwork::Export(std::ostream& heteroModel) {
             auto outputNode = subnetworkOutputsNode.append_child("output");
             outputNode.append_attribute("name").set_value(output.first.c_str());
             outputNode.append_attribute("precision").set_value(output.second->getPrecision().name());
+            if (subnetwork._cachedOnDevice) {
+                // is a part of the device cache entry hash
+                outputNode.append_attribute("layout").set_value(static_cast<int>(output.second->getLayout()));
+            }
         }
     }
 
@@ -615,30 +692,10 @@ void HeteroExecutableNetwork::Export(std::ostream& heteroModel) {
     heteroModel << std::endl;
 
     for (auto&& subnetwork : _networks) {
-        if (_heteroPlugin->GetCore()->DeviceSupportsImportExport(subnetwork._device)) {
+        if (!subnetwork._cachedOnDevice && _heteroPlugin->GetCore()->DeviceSupportsImportExport(subnetwork._device)) {
             subnetwork._network->Export(heteroModel);
         } else {
-            auto subnet = subnetwork._clonedNetwork;
-            if (!subnet.getFunction()) {
-                IE_THROW() << "Hetero plugin supports only ngraph function representation";
-            }
-
-            // Note: custom ngraph extensions are not supported
-            std::stringstream xmlFile, binFile;
-            ngraph::pass::Serialize serializer(xmlFile, binFile,
-                ngraph::pass::Serialize::Version::IR_V10);
-            serializer.run_on_function(subnet.getFunction());
-
-            auto m_constants = binFile.str();
-            auto m_model = xmlFile.str();
-
-            auto dataSize = static_cast<std::uint64_t>(m_model.size());
-            heteroModel.write(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
-            heteroModel.write(m_model.c_str(), dataSize);
-
-            dataSize = static_cast<std::uint64_t>(m_constants.size());
-            heteroModel.write(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
-            heteroModel.write(reinterpret_cast<char*>(&m_constants[0]), dataSize);
+            SerializeSubnetwork(subnetwork._clonedNetwork, heteroModel);
         }
     }
 }
@@ -66,6 +66,9 @@ private:
         std::string                                   _device;
         InferenceEngine::CNNNetwork                   _clonedNetwork;
         InferenceEngine::SoExecutableNetworkInternal  _network;
+        // the compiled network is stored to the device's own cache entry,
+        // so just the subnetwork IR is exported (to be loaded, i.e. imported from the cache, by the device)
+        bool                                          _cachedOnDevice = false;
     };
 
     std::vector<NetworkDesc>                     _networks;
@@ -71,4 +71,44 @@ protected:
  */
 INFERENCE_ENGINE_API_CPP(std::shared_ptr<InferenceEngine::IAllocator>) CreateDefaultAllocator() noexcept;
 
+/**
+ * @brief Usage of the huge memory pages by the allocator created by CreateAllocator()
+ */
+enum HugePagesMode {
+    HUGE_PAGES_NONE = 0,     //!< The memory is allocated with the default pages
+    HUGE_PAGES_TRANSPARENT,  //!< The memory is advised to be backed by the transparent huge pages
+    HUGE_PAGES_EXPLICIT      //!< The memory is taken from the reserved huge pages, or allocated with the default pages
+                             //!< if there are not enough of them
+};
+
+/**
+ * @brief Placement of the memory allocated by the allocator created by CreateAllocator()
+ */
+struct AllocatorParams {
+    /**
+     * @brief Alignment of the allocated memory in bytes, a power of two
+     */
+    size_t alignment = 64;
+    /**
+     * @brief Usage of the huge pages for the allocations not less than the huge page size
+     */
+    HugePagesMode hugePages = HUGE_PAGES_NONE;
+    /**
+     * @brief NUMA node the memory is placed to on the first touch, or -1 to follow the policy of the touching thread
+     */
+    int numaNode = -1;
+};
+
+/**
+ * @brief Creates the allocator which places the memory according to the given parameters.
+ *
+ * The huge pages and the NUMA node placement are supported on Linux only, on the other systems the memory is
+ * just aligned. The allocator is passed to make_shared_blob() to place the memory of a particular blob.
+ *
+ * @param params The memory placement parameters
+ * @return The Inference Engine IAllocator* instance or nullptr if the parameters are not valid
+ */
+INFERENCE_ENGINE_API_CPP(std::shared_ptr<InferenceEngine::IAllocator>)
+CreateAllocator(const AllocatorParams& params) noexcept;
+
 }  // namespace InferenceEngine
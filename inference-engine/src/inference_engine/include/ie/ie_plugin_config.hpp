@@ -192,11 +192,54 @@ DECLARE_METRIC_KEY(DEVICE_GOPS, std::map<InferenceEngine::Precision, float>);
  */
 DECLARE_METRIC_KEY(IMPORT_EXPORT_SUPPORT, bool);
 
+/**
+ * @brief Metric to get the memory of the activation arenas shared by the networks (see CPU_SHARED_ACTIVATION_ARENA).
+ *
+ * Metric returns a value of std::tuple<unsigned long long, unsigned long long> type, where:
+ *  - First value is the memory allocated by the arenas, in bytes.
+ *  - Second value is the activation memory the networks would take without the arenas, in bytes.
+ * String value is "CPU_ACTIVATION_ARENAS_MEMORY"
+ */
+DECLARE_METRIC_KEY(CPU_ACTIVATION_ARENAS_MEMORY, std::tuple<unsigned long long, unsigned long long>);
+
+/**
+ * @brief Metric to get the statistics of the process wide cache of the compiled primitives (see CPU_PRIMITIVE_CACHE_CAPACITY).
+ *
+ * Metric returns a value of std::tuple<unsigned long long, unsigned long long, unsigned long long, unsigned long long>
+ * type, where:
+ *  - First value is the number of the primitives taken from the cache.
+ *  - Second value is the number of the primitives compiled since they were not found in the cache.
+ *  - Third value is the number of the cached primitives.
+ *  - Fourth value is the capacity of the cache.
+ * String value is "CPU_PRIMITIVE_CACHE"
+ */
+DECLARE_METRIC_KEY(CPU_PRIMITIVE_CACHE, std::tuple<unsigned long long, unsigned long long, unsigned long long, unsigned long long>);
+
 /**
  * @brief Metric to get a name of network. String value is "NETWORK_NAME".
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(NETWORK_NAME, std::string);
 
+/**
+ * @brief Metric to get the layout of the streams the executable network runs inference in.
+ *
+ * Value is a vector of "<core type>:<number of streams>x<threads per stream>" strings, e.g. {"BIG:4x4", "LITTLE:2x4"}
+ * for a hybrid processor, or {"ANY:4x4"} when the streams are not bound to a particular core type.
+ * String value is "STREAMS_LAYOUT"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(STREAMS_LAYOUT, std::vector<std::string>);
+
+/**
+ * @brief Metric to get the number of the outputs written by the device directly to the user output blobs.
+ *
+ * Metric returns a value of std::tuple<unsigned int, unsigned int> type, where:
+ *  - First value is the number of the outputs which did not require a copy to the user blobs.
+ *  - Second value is the total number of the outputs.
+ * Both values are accumulated over all inferences of the executable network.
+ * String value is "ZERO_COPY_OUTPUTS"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(ZERO_COPY_OUTPUTS, std::tuple<unsigned int, unsigned int>);
+
 /**
  * @brief  Metric to get a float of device thermal. String value is "DEVICE_THERMAL"
  */
@@ -370,6 +413,28 @@ DECLARE_CONFIG_KEY(DUMP_EXEC_GRAPH_AS_DOT);
  */
 DECLARE_CONFIG_KEY(ENFORCE_BF16);
 
+/**
+ * @brief The name for setting to place the activations of the network to the memory shared with the other networks
+ *
+ * The networks loaded with this option set to PluginConfigParams::YES (default is NO) share an activation
+ * memory arena per stream, which keeps the maximum (not the sum) of the activation memory of the networks.
+ * The inferences of such networks running on the streams with the same index are serialized.
+ * The memory of the arenas is reported by the CPU_ACTIVATION_ARENAS_MEMORY metric of the device.
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_ACTIVATION_ARENA);
+
+/**
+ * @brief The name for setting the maximum number of the compiled primitives kept by the CPU plugin
+ *
+ * The graphs of all the streams and the networks of the process take the primitives of the equal operations
+ * (the shapes, layouts, precisions and fused operations) from the cache instead of compiling them again.
+ * The least recently used primitive is evicted from the full cache. The value is a non negative integer,
+ * 0 disables the cache, the default is 1024. The setting is process wide: the value passed to Core::LoadNetwork
+ * changes the capacity for all the networks, just like Core::SetConfig does.
+ * The statistics of the cache are reported by the CPU_PRIMITIVE_CACHE metric of the device.
+ */
+DECLARE_CONFIG_KEY(CPU_PRIMITIVE_CACHE_CAPACITY);
+
 /**
  * @brief This key defines the directory which will be used to store any data cached by plugins.
  *
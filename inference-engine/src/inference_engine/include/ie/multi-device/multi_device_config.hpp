@@ -34,5 +34,39 @@ namespace MultiDeviceConfigParams {
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @brief Scheduling policy config option, defines how MULTI picks a device for each inference request.
+ * Possible values:
+ *  - MULTI_PRIORITY (default) - the first device (in the DEVICE_PRIORITIES order) with an idle request is used
+ *  - MULTI_LATENCY_AWARE - the device with the lowest predicted completion time is used, the prediction is based on
+ *    the moving-average latency measured for every device and the number of requests in flight on it
+ */
+DECLARE_MULTI_CONFIG_KEY(SCHEDULING_POLICY);
+DECLARE_MULTI_CONFIG_VALUE(PRIORITY);
+DECLARE_MULTI_CONFIG_VALUE(LATENCY_AWARE);
+
 }  // namespace MultiDeviceConfigParams
+
+namespace Metrics {
+
+/**
+ * @def MULTI_METRIC_KEY(name)
+ * @brief shortcut for defining MULTI ExecutableNetwork metrics
+ */
+#define MULTI_METRIC_KEY(name)              METRIC_KEY(MULTI_##name)
+#define DECLARE_MULTI_METRIC_KEY(name, ...) DECLARE_METRIC_KEY(MULTI_##name, __VA_ARGS__)
+
+/**
+ * @brief Metric to get the estimated throughput (inferences per second) of every device used by the MULTI
+ * ExecutableNetwork. The estimate is derived from the moving-average latency and the number of device requests
+ */
+DECLARE_MULTI_METRIC_KEY(DEVICE_THROUGHPUT, std::map<std::string, float>);
+
+/**
+ * @brief Metric to get the number of inference requests that are currently in flight on every device used by the
+ * MULTI ExecutableNetwork
+ */
+DECLARE_MULTI_METRIC_KEY(DEVICE_QUEUE_DEPTH, std::map<std::string, unsigned int>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
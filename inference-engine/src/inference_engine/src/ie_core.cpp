@@ -22,11 +22,13 @@
 #include "ie_icore.hpp"
 #include "ie_itt.hpp"
 #include "ie_network_reader.hpp"
+#include "ie_parallel.hpp"
 #include "ie_plugin_config.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/opsets/opset.hpp"
 #include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "openvino/runtime/core.hpp"
 #include "xml_parse_utils.h"
 
@@ -52,6 +54,25 @@ std::string parseXmlConfig(const std::string& xmlFile) {
     return xmlConfigFile_;
 }
 
+// the loops of the ngraph reference kernels (the constant folding, the fallback operations of the plugins)
+// are run with the threading of the Inference Engine, e.g. in the arena of the calling stream
+void setReferenceKernelsThreading() {
+    static std::once_flag flag;
+    std::call_once(flag, [] {
+        ngraph::runtime::set_parallel_for_backend(
+            [](size_t work_amount, const ngraph::runtime::ParallelForBody& body) {
+                const int threads = static_cast<int>(
+                    std::min<size_t>(work_amount, static_cast<size_t>(parallel_get_max_threads())));
+                InferenceEngine::parallel_nt(threads, [&](int ithr, int nthr) {
+                    size_t begin = 0, end = 0;
+                    InferenceEngine::splitter(work_amount, nthr, ithr, begin, end);
+                    if (begin < end)
+                        body(begin, end);
+                });
+            });
+    });
+}
+
 template <typename T = InferenceEngine::Parameter>
 Parsed<T> parseDeviceNameIntoConfig(const std::string& deviceName, const std::map<std::string, T>& config = {}) {
     auto config_ = config;
@@ -183,6 +204,10 @@ class CoreImpl : public InferenceEngine::ICore, public std::enable_shared_from_t
         return DeviceSupportsImportExport(plugin);
     }
 
+    bool IsCacheEnabled() const override {
+        return coreConfig.getCacheConfig()._cacheManager != nullptr;
+    }
+
     bool DeviceSupportsImportExport(const InferenceEngine::InferencePlugin& plugin) const {
         std::vector<std::string> supportedMetricKeys = plugin.GetMetric(METRIC_KEY(SUPPORTED_METRICS), {});
         auto it = std::find(supportedMetricKeys.begin(), supportedMetricKeys.end(), METRIC_KEY(IMPORT_EXPORT_SUPPORT));
@@ -342,6 +367,7 @@ class CoreImpl : public InferenceEngine::ICore, public std::enable_shared_from_t
 
 public:
     CoreImpl() {
+        core_detail::setReferenceKernelsThreading();
         opsetNames.insert("opset1");
         opsetNames.insert("opset2");
         opsetNames.insert("opset3");
@@ -4,8 +4,70 @@
 
 #include "system_allocator.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#ifdef _WIN32
+#include <malloc.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
 namespace InferenceEngine {
 
+namespace {
+
+constexpr size_t hugePageSize = 2 * 1024 * 1024;
+
+size_t pageSize() {
+#ifdef _WIN32
+    return 4096;
+#else
+    static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+#endif
+}
+
+void* alignedAlloc(size_t size, size_t alignment) {
+#ifdef _WIN32
+    return _aligned_malloc(size ? size : 1, alignment);
+#else
+    void* ptr = nullptr;
+    // posix_memalign requires the alignment to be a multiple of the pointer size
+    alignment = std::max(alignment, sizeof(void*));
+    return posix_memalign(&ptr, alignment, size ? size : 1) == 0 ? ptr : nullptr;
+#endif
+}
+
+void alignedFree(void* ptr) {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+#ifdef __linux__
+// The preferred policy falls back to the other nodes if the memory of the node is exhausted,
+// like the first touch does
+void bindToNumaNode(void* ptr, size_t size, int node) {
+    constexpr int MPOL_PREFERRED = 1;
+    constexpr size_t bits = sizeof(unsigned long) * 8;
+    std::vector<unsigned long> mask(node / bits + 1, 0);
+    mask[node / bits] |= 1ul << (node % bits);
+    syscall(SYS_mbind, ptr, size, MPOL_PREFERRED, mask.data(), mask.size() * bits + 1, 0);
+}
+#endif
+
+}  // namespace
+
 INFERENCE_ENGINE_API_CPP(std::shared_ptr<IAllocator>) CreateDefaultAllocator() noexcept {
     try {
         return std::make_shared<SystemMemoryAllocator>();
@@ -14,4 +76,117 @@ INFERENCE_ENGINE_API_CPP(std::shared_ptr<IAllocator>) CreateDefaultAllocator() n
     }
 }
 
+INFERENCE_ENGINE_API_CPP(std::shared_ptr<IAllocator>) CreateAllocator(const AllocatorParams& params) noexcept {
+    if (params.alignment == 0 || (params.alignment & (params.alignment - 1)) != 0)
+        return nullptr;
+    try {
+        return std::make_shared<PlacedMemoryAllocator>(params);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+PlacedMemoryAllocator::~PlacedMemoryAllocator() {
+#ifndef _WIN32
+    for (auto& mapping : mapped)
+        munmap(mapping.first, mapping.second);
+#endif
+}
+
+void* PlacedMemoryAllocator::alloc(size_t size) noexcept {
+    try {
+        // the small allocations are left to the heap: the placement works with the whole pages
+        const bool useHugePages = params.hugePages != HUGE_PAGES_NONE && size >= hugePageSize;
+        const bool bindToNode = params.numaNode >= 0 && size >= pageSize();
+        if ((useHugePages || bindToNode) && params.alignment <= pageSize()) {
+            if (void* ptr = map(size))
+                return ptr;
+        }
+        return alignedAlloc(size, params.alignment);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+bool PlacedMemoryAllocator::free(void* handle) noexcept {
+    if (!handle)
+        return true;
+    try {
+#ifndef _WIN32
+        {
+            std::lock_guard<std::mutex> lock(guard);
+            auto found = mapped.find(handle);
+            if (found != mapped.end()) {
+                munmap(found->first, found->second);
+                mapped.erase(found);
+                return true;
+            }
+        }
+#endif
+        alignedFree(handle);
+    } catch (...) {
+    }
+    return true;
+}
+
+bool PlacedMemoryAllocator::isMapped(void* handle) const {
+    std::lock_guard<std::mutex> lock(guard);
+    return mapped.count(handle) != 0;
+}
+
+void* PlacedMemoryAllocator::map(size_t size) {
+#ifdef _WIN32
+    (void)size;
+    return nullptr;
+#else
+    size_t mappedSize = size;
+    void* ptr = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    if (params.hugePages == HUGE_PAGES_EXPLICIT && size >= hugePageSize) {
+        mappedSize = (size + hugePageSize - 1) / hugePageSize * hugePageSize;
+        ptr = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+#endif
+    if (ptr == MAP_FAILED) {
+        mappedSize = (size + pageSize() - 1) / pageSize() * pageSize();
+        if (params.hugePages != HUGE_PAGES_NONE && size >= hugePageSize) {
+            // the transparent huge pages back only the 2MB aligned ranges, so the mapping is aligned by
+            // mapping the bigger range and unmapping the unaligned head and tail
+            void* range = mmap(nullptr, mappedSize + hugePageSize, PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (range == MAP_FAILED)
+                return nullptr;
+            const auto begin = reinterpret_cast<uintptr_t>(range);
+            const auto aligned = (begin + hugePageSize - 1) / hugePageSize * hugePageSize;
+            if (aligned != begin)
+                munmap(range, aligned - begin);
+            munmap(reinterpret_cast<void*>(aligned + mappedSize), begin + hugePageSize - aligned);
+            ptr = reinterpret_cast<void*>(aligned);
+#ifdef MADV_HUGEPAGE
+            madvise(ptr, mappedSize, MADV_HUGEPAGE);
+#endif
+        } else {
+            ptr = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (ptr == MAP_FAILED)
+                return nullptr;
+        }
+    }
+
+#ifdef __linux__
+    // the pages are not touched yet, so they are allocated on the node
+    if (params.numaNode >= 0)
+        bindToNumaNode(ptr, mappedSize, params.numaNode);
+#endif
+
+    try {
+        std::lock_guard<std::mutex> lock(guard);
+        mapped.emplace(ptr, mappedSize);
+    } catch (...) {
+        munmap(ptr, mappedSize);
+        return nullptr;
+    }
+    return ptr;
+#endif  // _WIN32
+}
+
 }  // namespace InferenceEngine
@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <mutex>
+#include <unordered_map>
+
 #include "ie_allocator.hpp"
 
 namespace InferenceEngine {
@@ -33,4 +36,36 @@ public:
     }
 };
 
+/**
+ * Allocates the aligned memory. The big allocations are mapped directly from the OS, so they can be backed
+ * by the huge pages and bound to a NUMA node before the first touch.
+ */
+class PlacedMemoryAllocator : public InferenceEngine::IAllocator {
+public:
+    explicit PlacedMemoryAllocator(const AllocatorParams& params) : params(params) {}
+    ~PlacedMemoryAllocator();
+
+    void* lock(void* handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void* a) noexcept override {}
+
+    void* alloc(size_t size) noexcept override;
+
+    bool free(void* handle) noexcept override;
+
+    /**
+     * @return true if the memory is mapped from the OS, false if it's allocated from the heap
+     */
+    bool isMapped(void* handle) const;
+
+private:
+    void* map(size_t size);
+
+    const AllocatorParams params;
+    mutable std::mutex guard;
+    std::unordered_map<void*, size_t> mapped;
+};
+
 }  // namespace InferenceEngine
\ No newline at end of file
@@ -5,8 +5,10 @@
 #include "threading/ie_istreams_executor.hpp"
 
 #include <algorithm>
+#include <numeric>
 #include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
@@ -61,6 +63,22 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
                 _streams = std::max(3, num_cores / 3);
             else  // if user disables some cores say in BIOS, so we got weird #cores which is not easy to divide
                 _streams = 1;
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+            // hybrid processors: the streams are populated on the Big cores first, then on the Little ones
+            // (see PreferredCoreType::ROUND_ROBIN), so every core type gets its own number of ~4-threads streams
+            // instead of dividing the total #cores, which may leave a part of the streams wrapping around the Big cores
+            const auto core_types = custom::info::core_types();
+            if (sockets == 1 && core_types.size() > 1) {
+                const int threads_per_stream = 4;
+                _streams = 0;
+                for (auto&& type : core_types) {
+                    _streams += std::max(
+                        1,
+                        custom::info::default_concurrency(custom::task_arena::constraints{}.set_core_type(type)) /
+                            threads_per_stream);
+                }
+            }
+#endif
         } else {
             int val_i;
             try {
@@ -191,4 +209,54 @@ IStreamsExecutor::Config IStreamsExecutor::Config::MakeDefaultMultiThreaded(cons
     return streamExecutorConfig;
 }
 
+std::vector<std::pair<std::string, int>> IStreamsExecutor::Config::GetStreamsPerCoreType() const {
+    const int streams = std::max(1, _streams);
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    const auto core_types = custom::info::core_types();
+    if (ThreadBindingType::HYBRID_AWARE == _threadBindingType && core_types.size() > 1) {
+        auto core_type_name = [&](std::size_t index) -> std::string {
+            return index == core_types.size() - 1 ? "BIG"
+                                                  : (index == 0 ? "LITTLE" : "CORE_TYPE_" + std::to_string(index));
+        };
+        switch (_threadPreferredCoreType) {
+        case PreferredCoreType::BIG:
+            return {{core_type_name(core_types.size() - 1), streams}};
+        case PreferredCoreType::LITTLE:
+            return {{core_type_name(0), streams}};
+        case PreferredCoreType::ROUND_ROBIN: {
+            // the same prefix sum of the #streams per core type (Big cores first) as in the streams executors
+            const int threadsPerStream =
+                (0 == _threadsPerStream) ? std::thread::hardware_concurrency() : _threadsPerStream;
+            std::vector<std::pair<std::string, int>> streamsPerCoreType;
+            std::vector<int> capacity;
+            for (auto index = core_types.size(); index-- > 0;) {
+                streamsPerCoreType.emplace_back(core_type_name(index), 0);
+                const auto constraints = custom::task_arena::constraints{}.set_core_type(core_types[index]);
+                capacity.push_back(std::max(1, custom::info::default_concurrency(constraints) / threadsPerStream));
+            }
+            const int total_streams = std::accumulate(capacity.begin(), capacity.end(), 0);
+            for (int streamId = 0; streamId < streams; ++streamId) {
+                int streamId_wrapped = streamId % total_streams;
+                std::size_t type = 0;
+                for (; streamId_wrapped >= capacity[type]; ++type) {
+                    streamId_wrapped -= capacity[type];
+                }
+                streamsPerCoreType[type].second++;
+            }
+            streamsPerCoreType.erase(std::remove_if(streamsPerCoreType.begin(),
+                                                    streamsPerCoreType.end(),
+                                                    [](const std::pair<std::string, int>& p) {
+                                                        return p.second == 0;
+                                                    }),
+                                     streamsPerCoreType.end());
+            return streamsPerCoreType;
+        }
+        default:
+            break;
+        }
+    }
+#endif
+    return {{"ANY", streams}};
+}
+
 }  //  namespace InferenceEngine
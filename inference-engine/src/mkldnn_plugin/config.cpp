@@ -99,6 +99,100 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 lpTransformsMode = LPTransformsMode::On;
             else
                 IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE;
+        } else if (key == PluginConfigInternalParams::KEY_CPU_MEMORY_ALIGNMENT) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_MEMORY_ALIGNMENT
+                           << ". Expected only integer numbers";
+            }
+            if (val_i < 32 || (val_i & (val_i - 1)) != 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_MEMORY_ALIGNMENT
+                           << ". Expected only powers of two, not less than 32";
+            memoryAlignment = val_i;
+        } else if (key == PluginConfigInternalParams::KEY_CPU_MEMORY_PLANNER) {
+            if (val == PluginConfigInternalParams::GREEDY_BY_SIZE)
+                memoryPlanner = MemorySolver::Strategy::GreedyBySize;
+            else if (val == PluginConfigInternalParams::BEST_FIT)
+                memoryPlanner = MemorySolver::Strategy::BestFit;
+            else if (val == PluginConfigInternalParams::GREEDY_BY_BREADTH)
+                memoryPlanner = MemorySolver::Strategy::GreedyByBreadth;
+            else if (val == PluginConfigInternalParams::MIN_FOOTPRINT)
+                memoryPlanner = MemorySolver::Strategy::MinFootprint;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_MEMORY_PLANNER
+                           << ". Expected only GREEDY_BY_SIZE/BEST_FIT/GREEDY_BY_BREADTH/MIN_FOOTPRINT";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_EMBEDDING_TABLE_MMAP_THRESHOLD) {
+            long long val_i = -1;
+            try {
+                val_i = std::stoll(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_EMBEDDING_TABLE_MMAP_THRESHOLD
+                           << ". Expected only integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_EMBEDDING_TABLE_MMAP_THRESHOLD
+                           << ". Expected only non negative numbers";
+            embeddingTableMmapThreshold = static_cast<size_t>(val_i);
+        } else if (key == PluginConfigInternalParams::KEY_CPU_WEIGHTS_DECOMPRESSION) {
+            if (val == PluginConfigParams::YES) weightsDecompression = true;
+            else if (val == PluginConfigParams::NO) weightsDecompression = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_WEIGHTS_DECOMPRESSION
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD) {
+            float val_f = -1.f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD
+                           << ". Expected only floating point numbers";
+            }
+            if (val_f < 0.f || val_f > 1.f)
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD
+                           << ". Expected only numbers from 0 to 1";
+            sparseWeightsThreshold = val_f;
+        } else if (key == PluginConfigInternalParams::KEY_CPU_DYNAMIC_INPUT_SHAPES) {
+            if (val == PluginConfigParams::YES) dynamicInputShapes = true;
+            else if (val == PluginConfigParams::NO) dynamicInputShapes = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_DYNAMIC_INPUT_SHAPES
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_HUGE_PAGES) {
+            if (val == PluginConfigParams::NO)
+                hugePages = HUGE_PAGES_NONE;
+            else if (val == PluginConfigInternalParams::MADVISE)
+                hugePages = HUGE_PAGES_TRANSPARENT;
+            else if (val == PluginConfigInternalParams::HUGETLB)
+                hugePages = HUGE_PAGES_EXPLICIT;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_HUGE_PAGES
+                           << ". Expected only NO/MADVISE/HUGETLB";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_NUMA_MEMORY_BINDING) {
+            if (val == PluginConfigParams::YES) numaMemoryBinding = true;
+            else if (val == PluginConfigParams::NO) numaMemoryBinding = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_NUMA_MEMORY_BINDING
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_SHARED_ACTIVATION_ARENA) {
+            if (val == PluginConfigParams::YES) sharedActivationArena = true;
+            else if (val == PluginConfigParams::NO) sharedActivationArena = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHARED_ACTIVATION_ARENA
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY
+                           << ". Expected only integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY
+                           << ". Expected only non negative numbers";
+            primitiveCacheCapacity = static_cast<size_t>(val_i);
         } else if (key == PluginConfigParams::KEY_ENFORCE_BF16) {
             if (val == PluginConfigParams::YES) {
                 if (with_cpu_x86_avx512_core()) {
@@ -154,6 +248,11 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::NO });
 
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
+        if (sharedActivationArena == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_SHARED_ACTIVATION_ARENA, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_SHARED_ACTIVATION_ARENA, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY, std::to_string(primitiveCacheCapacity) });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
         IE_SUPPRESS_DEPRECATED_START
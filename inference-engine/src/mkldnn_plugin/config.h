@@ -5,10 +5,14 @@
 #pragma once
 
 #include <threading/ie_istreams_executor.hpp>
+#include <ie_allocator.hpp>
 #include "utils/debug_capabilities.h"
+#include "mkldnn_memory_solver.hpp"
+#include "mkldnn_primitive_cache.hpp"
 
 #include <string>
 #include <map>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -25,6 +29,16 @@ struct Config {
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
     int batchLimit = 0;
+    bool sharedActivationArena = false;
+    size_t primitiveCacheCapacity = MKLDNNPrimitiveCache::defaultCapacity;
+    int64_t memoryAlignment = 32;
+    MemorySolver::Strategy memoryPlanner = MemorySolver::Strategy::MinFootprint;
+    size_t embeddingTableMmapThreshold = 0;
+    bool weightsDecompression = false;
+    float sparseWeightsThreshold = 1.f;
+    bool dynamicInputShapes = false;
+    InferenceEngine::HugePagesMode hugePages = InferenceEngine::HUGE_PAGES_NONE;
+    bool numaMemoryBinding = false;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
@@ -0,0 +1,142 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_activation_arena.hpp"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+# define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+uint8_t* reserveAddressRange(size_t size) {
+#ifdef _WIN32
+    return static_cast<uint8_t*>(VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS));
+#else
+    // the pages are committed by the OS lazily, on the first touch
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    return ptr == MAP_FAILED ? nullptr : static_cast<uint8_t*>(ptr);
+#endif
+}
+
+bool commit(uint8_t* ptr, size_t size) {
+#ifdef _WIN32
+    return VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+    (void)ptr;
+    (void)size;
+    return true;
+#endif
+}
+
+void decommit(uint8_t* ptr, size_t size) {
+#ifdef _WIN32
+    VirtualFree(ptr, size, MEM_DECOMMIT);
+#else
+    madvise(ptr, size, MADV_DONTNEED);
+#endif
+}
+
+void releaseAddressRange(uint8_t* ptr, size_t size) {
+#ifdef _WIN32
+    (void)size;
+    VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+    munmap(ptr, size);
+#endif
+}
+
+}  // namespace
+
+MKLDNNActivationArena::Reservation::Reservation(const MKLDNNActivationArena::Ptr& arena, size_t size)
+    : arena(arena)
+    , size(size)
+{}
+
+MKLDNNActivationArena::Reservation::~Reservation() {
+    arena->release(size);
+}
+
+uint8_t* MKLDNNActivationArena::Reservation::data() const {
+    return arena->base;
+}
+
+std::unique_lock<std::mutex> MKLDNNActivationArena::Reservation::lock() const {
+    return std::unique_lock<std::mutex>(arena->owner);
+}
+
+MKLDNNActivationArena::MKLDNNActivationArena() {
+    base = reserveAddressRange(maxSize);
+}
+
+MKLDNNActivationArena::~MKLDNNActivationArena() {
+    if (base)
+        releaseAddressRange(base, maxSize);
+}
+
+MKLDNNActivationArena::Reservation::Ptr MKLDNNActivationArena::reserve(size_t size) {
+    std::lock_guard<std::mutex> lock(guard);
+    if (!base || size > maxSize)
+        return nullptr;
+
+    if (size > committed) {
+        // committing the pages does not change the address of the memory, so the graphs that are running
+        // on the arena are not affected
+        if (!commit(base + committed, size - committed))
+            return nullptr;
+        committed = size;
+    }
+    requested += size;
+    users++;
+    return std::make_shared<Reservation>(shared_from_this(), size);
+}
+
+void MKLDNNActivationArena::release(size_t size) {
+    std::lock_guard<std::mutex> lock(guard);
+    requested -= size;
+    if (--users == 0) {
+        // the last graph is gone, so the memory is returned to the OS
+        decommit(base, committed);
+        committed = 0;
+    }
+}
+
+size_t MKLDNNActivationArena::allocatedSize() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return committed;
+}
+
+size_t MKLDNNActivationArena::requestedSize() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return requested;
+}
+
+MKLDNNActivationArena::Ptr StreamsActivationArenas::operator[](int streamId) {
+    std::lock_guard<std::mutex> lock(guard);
+    auto& arena = _arenas[streamId];
+    if (!arena)
+        arena = std::make_shared<MKLDNNActivationArena>();
+    return arena;
+}
+
+std::pair<size_t, size_t> StreamsActivationArenas::memoryUsage() const {
+    std::lock_guard<std::mutex> lock(guard);
+    std::pair<size_t, size_t> usage {0, 0};
+    for (auto& arena : _arenas) {
+        usage.first += arena.second->allocatedSize();
+        usage.second += arena.second->requestedSize();
+    }
+    return usage;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Activation memory shared by the graphs of different executable networks bound to the same stream.
+ * The graphs place their non-persistent edges to the arena instead of their own workspaces, so the arena
+ * keeps the maximum, not the sum, of their activation memory. A graph owns the arena for the whole
+ * inference (see lock()), so the graphs of the same stream run one at a time.
+ *
+ * The address range of the arena is reserved once and committed on demand, so the arena grows
+ * without moving the memory the graphs are already bound to.
+ *
+ * Is a thread safe
+ */
+class MKLDNNActivationArena : public std::enable_shared_from_this<MKLDNNActivationArena> {
+public:
+    typedef std::shared_ptr<MKLDNNActivationArena> Ptr;
+
+    /**
+     * Memory of the arena used by a graph. The graph is unregistered from the arena on destruction
+     */
+    class Reservation {
+    public:
+        typedef std::shared_ptr<Reservation> Ptr;
+
+        Reservation(const MKLDNNActivationArena::Ptr& arena, size_t size);
+        ~Reservation();
+
+        uint8_t* data() const;
+        std::unique_lock<std::mutex> lock() const;
+
+    private:
+        MKLDNNActivationArena::Ptr arena;
+        size_t size;
+    };
+
+    MKLDNNActivationArena();
+    ~MKLDNNActivationArena();
+
+    /**
+     * Registers a graph which requires the given size of the activation memory
+     * @return the reservation or nullptr if the arena can't provide such size
+     */
+    Reservation::Ptr reserve(size_t size);
+
+    /**
+     * @return the size of the memory committed by the arena, i.e. the maximum size required by the registered graphs
+     */
+    size_t allocatedSize() const;
+
+    /**
+     * @return the total size of the memory required by the registered graphs, i.e. the size the graphs take without
+     * the arena
+     */
+    size_t requestedSize() const;
+
+private:
+    void release(size_t size);
+
+    // Size of the reserved address range (not the committed memory)
+    static constexpr size_t maxSize = static_cast<size_t>(1) << (sizeof(void*) == 8 ? 36 : 28);
+
+    std::mutex owner;
+    mutable std::mutex guard;
+    uint8_t* base = nullptr;
+    size_t committed = 0;
+    size_t requested = 0;
+    size_t users = 0;
+};
+
+/**
+ * Collection of activation arenas per stream
+ *
+ * Is a thread safe
+ */
+class StreamsActivationArenas {
+public:
+    MKLDNNActivationArena::Ptr operator[](int streamId);
+
+    /**
+     * @return the allocated size of all arenas and the size the graphs would take without them, in bytes
+     */
+    std::pair<size_t, size_t> memoryUsage() const;
+
+private:
+    mutable std::mutex guard;
+    std::map<int, MKLDNNActivationArena::Ptr> _arenas;
+};
+
+}  // namespace MKLDNNPlugin
@@ -11,6 +11,7 @@
 #include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
 #include "nodes/mkldnn_memory_node.hpp"
+#include <ie_ngraph_utils.hpp>
 #include <threading/ie_executor_manager.hpp>
 #if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
 #include <threading/ie_tbb_streams_executor.hpp>
@@ -18,11 +19,16 @@
 #include <threading/ie_cpu_streams_executor.hpp>
 #endif
 #include <ie_system_conf.h>
+#include <ie_parallel.hpp>
 #include <algorithm>
 #include <unordered_set>
+#include <tuple>
 #include <utility>
 #include <cstring>
 #include <ngraph/opsets/opset1.hpp>
+#include <ngraph/graph_util.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
 #include <transformations/utils/utils.hpp>
 
 using namespace MKLDNNPlugin;
@@ -46,12 +52,18 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     StreamsActivationArenas &activationArenas,
+                                     const InferenceEngine::CNNNetwork &originalNetwork,
+                                     const Transformation &transformation) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
     _numaNodesWeights(numaNodesWeights),
+    _activationArenas(activationArenas),
+    _originalNetwork(originalNetwork),
+    _transformation(transformation),
         _network(network) {
     auto function = network.getFunction();
     if (function == nullptr) {
@@ -69,9 +81,12 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     if (cfg.exclusiveAsyncRequests) {
         // special case when all InferRequests are muxed into a single queue
         _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPU");
+        // the single stream of the shared executor uses all the threads
+        _streamsExecutorConfig._threadsPerStream = parallel_get_max_threads();
     } else {
         auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig, isFloatModel);
         streamsExecutorConfig._name = "CPUStreamsExecutor";
+        _streamsExecutorConfig = streamsExecutorConfig;
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         _taskExecutor = std::make_shared<TBBStreamsExecutor>(streamsExecutorConfig);
 #else
@@ -97,6 +112,9 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         op->get_friendly_name();
     }
 
+    for (const auto& input : _network.getInputsInfo())
+        _loadedShapes[input.first] = input.second->getTensorDesc().getDims();
+
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
@@ -110,6 +128,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         MKLDNNExecNetwork::GetGraph();
     }
+    ShareMappedConstants();
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
@@ -132,6 +151,46 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     }
 }
 
+void MKLDNNExecNetwork::ShareMappedConstants() {
+    std::unordered_set<const ngraph::Node*> replaced;
+    // the Constants of the original network kept for the reshape share the data with the transformed ones
+    std::unordered_map<const void*, std::shared_ptr<ngraph::opset1::Constant>> sharedConstants;
+    for (auto& graph : _graphs) {
+        auto graphLock = Graph::Lock(graph);
+        for (const auto& mapped : graphLock._graph.TakeMappedConstants()) {
+            const auto& constant = mapped.first;
+            // the graphs of the streams share the mapped memory of the same Constant
+            if (!replaced.insert(constant.get()).second)
+                continue;
+
+            const auto& memory = mapped.second;
+            auto data = std::make_shared<ngraph::runtime::SharedBuffer<MKLDNNMemoryCPtr>>(
+                    static_cast<char*>(memory->GetPtr()), memory->GetSize(), memory);
+            auto sharedConstant = std::make_shared<ngraph::opset1::Constant>(constant->get_element_type(), constant->get_shape(), data);
+            sharedConstant->set_friendly_name(constant->get_friendly_name());
+            ngraph::copy_runtime_info(constant, sharedConstant);
+            sharedConstants.emplace(constant->get_data_ptr(), sharedConstant);
+            ngraph::replace_node(constant, sharedConstant);
+        }
+    }
+
+    if (sharedConstants.empty() || !_originalNetwork.getFunction())
+        return;
+    for (const auto& op : _originalNetwork.getFunction()->get_ops()) {
+        auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(op);
+        if (!constant)
+            continue;
+        auto sharedConstant = sharedConstants.find(constant->get_data_ptr());
+        if (sharedConstant == sharedConstants.end() || sharedConstant->second->get_element_type() != constant->get_element_type() ||
+            sharedConstant->second->get_shape() != constant->get_shape())
+            continue;
+        auto originalConstant = std::make_shared<ngraph::opset1::Constant>(*sharedConstant->second);
+        originalConstant->set_friendly_name(constant->get_friendly_name());
+        ngraph::copy_runtime_info(constant, originalConstant);
+        ngraph::replace_node(constant, originalConstant);
+    }
+}
+
 MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
     int streamId = 0;
     int numaNodeId = 0;
@@ -148,8 +207,14 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
                 {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
+                    if (_cfg.sharedActivationArena) {
+                        graphLock._graph.setActivationArena(_activationArenas[streamId]);
+                    }
+                    graphLock._graph.setNumaNode(numaNodeId);
                 }
+                graphLock._graph._shapes.clear();
                 graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
+                graphLock._graph._shapes = _loadedShapes;
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -166,6 +231,48 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
     return graphLock;
 }
 
+void MKLDNNExecNetwork::ReshapeGraph(Graph::Lock &graphLock, const InputShapes &shapes) {
+    auto& graph = graphLock._graph;
+    if (shapes == graph._shapes)
+        return;
+
+    const auto network = GetNetworkForShapes(shapes);
+    int numaNodeId = 0;
+    auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    if (nullptr != streamsExecutor) {
+        numaNodeId = streamsExecutor->GetNumaNodeId();
+    }
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        graph.setConfig(_cfg);
+    }
+    // the nodes of the previous shapes keep the weights in the cache until the nodes of the new ones take them,
+    // the primitives of the shapes inferred before are taken from the primitive cache
+    const auto previousNodes = graph.GetNodes();
+    graph._shapes.clear();
+    graph.CreateGraph(network, extensionManager, _numaNodesWeights[numaNodeId]);
+    graph._shapes = shapes;
+}
+
+InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetNetworkForShapes(const InputShapes &shapes) {
+    if (shapes == _loadedShapes)
+        return _network;
+
+    std::lock_guard<std::mutex> lock{_reshapeMutex};
+    if (_reshapedNetwork.first != shapes) {
+        // the shape subgraphs of the original network are folded again for the new input shapes
+        auto network = InferenceEngine::details::cloneNetwork(_originalNetwork);
+        network.reshape(shapes);
+        _transformation(network);
+        // Workaround for initializing friendly names for all the OPs, as in the constructor
+        for (const auto& op : network.getFunction()->get_ops()) {
+            op->get_friendly_name();
+        }
+        _reshapedNetwork = {shapes, network};
+    }
+    return _reshapedNetwork.second;
+}
+
 MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
     int streamId = 0;
     int numaNodeId = 0;
@@ -226,6 +333,8 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(STREAMS_LAYOUT));
+        metrics.push_back(METRIC_KEY(ZERO_COPY_OUTPUTS));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -240,6 +349,21 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(STREAMS_LAYOUT)) {
+        std::vector<std::string> layout;
+        for (auto&& streams : _streamsExecutorConfig.GetStreamsPerCoreType()) {
+            layout.push_back(streams.first + ":" + std::to_string(streams.second) + "x" +
+                             std::to_string(_streamsExecutorConfig._threadsPerStream));
+        }
+        IE_SET_METRIC_RETURN(STREAMS_LAYOUT, layout);
+    } else if (name == METRIC_KEY(ZERO_COPY_OUTPUTS)) {
+        unsigned int zeroCopyOutputs = 0, pulledOutputs = 0;
+        for (auto&& graph : _graphs) {
+            auto count = graph.getZeroCopyOutputsCount();
+            zeroCopyOutputs += count.first;
+            pulledOutputs += count.second;
+        }
+        IE_SET_METRIC_RETURN(ZERO_COPY_OUTPUTS, std::make_tuple(zeroCopyOutputs, pulledOutputs));
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -16,6 +16,8 @@
 #include <map>
 #include <string>
 #include <unordered_map>
+#include <functional>
+#include <utility>
 
 namespace MKLDNNPlugin {
 
@@ -29,8 +31,18 @@ public:
 
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
 
+    using InputShapes = std::map<std::string, InferenceEngine::SizeVector>;
+    // the transformations of the plugin applied to the reshaped network
+    using Transformation = std::function<void(InferenceEngine::CNNNetwork&)>;
+
+    /**
+     * With the CPU_DYNAMIC_INPUT_SHAPES, the original network is reshaped and transformed for the input shapes other
+     * than the loaded ones, then the graph of the stream is re-created from it on the inference with these shapes
+     */
     MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      StreamsActivationArenas &activationArenas,
+                      const InferenceEngine::CNNNetwork &originalNetwork = {}, const Transformation &transformation = {});
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
@@ -50,10 +62,13 @@ protected:
     const InferenceEngine::CNNNetwork           _network;
     std::mutex                                  _cfgMutex;
     Config                                      _cfg;
+    InferenceEngine::IStreamsExecutor::Config   _streamsExecutorConfig;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
     struct Graph : public MKLDNNGraph {
         std::mutex  _mutex;
+        // the input shapes the graph is created for
+        InputShapes _shapes;
         struct Lock : public std::unique_lock<std::mutex> {
             explicit Lock(Graph& graph) : std::unique_lock<std::mutex>(graph._mutex), _graph(graph) {}
             Graph&                          _graph;
@@ -63,6 +78,7 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<Graph>                   _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
+    StreamsActivationArenas&                    _activationArenas;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -71,8 +87,29 @@ protected:
     Graph::Lock GetGraph();
     Graph::Lock GetGraph() const;
 
+    /**
+     * Re-creates the graph of the locked stream for the input shapes, if it is created for the other ones
+     */
+    void ReshapeGraph(Graph::Lock &graphLock, const InputShapes &shapes);
+
+    /**
+     * @return the network transformed for the input shapes, the reshaped one is kept for the graphs of the other streams
+     */
+    InferenceEngine::CNNNetwork GetNetworkForShapes(const InputShapes &shapes);
+
+    const InferenceEngine::CNNNetwork           _originalNetwork;
+    const Transformation                        _transformation;
+    InputShapes                                 _loadedShapes;
+    std::mutex                                  _reshapeMutex;
+    std::pair<InputShapes, InferenceEngine::CNNNetwork> _reshapedNetwork;
 
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
+
+    /**
+     * Replaces the Constants of the network whose data are mapped to file by the graphs by the Constants sharing the
+     * mapped memory, so the network does not keep the original data resident
+     */
+    void ShareMappedConstants();
 };
 
 }  // namespace MKLDNNPlugin
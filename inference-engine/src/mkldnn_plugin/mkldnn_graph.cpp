@@ -10,9 +10,15 @@
 #include <unordered_set>
 #include <limits>
 #include <fstream>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <sstream>
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <exception>
+#include <ie_parallel.hpp>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
@@ -25,6 +31,7 @@
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
 #include <nodes/mkldnn_convert_node.h>
+#include <nodes/mkldnn_fullyconnected_node.h>
 
 #include <ie_algorithm.hpp>
 #include <blob_factory.hpp>
@@ -66,7 +73,7 @@ void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMg
     if (IsReady())
         ForgetGraphData();
     // disable caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    weightsCache = config.streamExecutorConfig._streams != 1 || config.dynamicInputShapes ? w_cache : nullptr;
 
     Replicate(net, extMgr);
     InitGraph();
@@ -314,12 +321,17 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
 void MKLDNNGraph::InitGraph() {
     MKLDNNGraphOptimizer optimizer;
 
+    SplitSharedConstants();
     SortTopologically();
     InitNodes();
 
+    UseSparseWeights();
+
     optimizer.ApplyCommonGraphOptimizations(*this);
     SortTopologically();
 
+    MapEmbeddingTables();
+
     InitDescriptors();
     RemoveDroppedEdges();
 
@@ -344,6 +356,42 @@ void MKLDNNGraph::InitGraph() {
     ExecuteConstantNodesOnly();
 }
 
+void MKLDNNGraph::SplitSharedConstants() {
+    // The fusions of the constant inputs expect the constant to have a single consumer, while the constants of equal
+    // content are merged by the ConstantDeduplication. So each consumer gets its own node sharing the constant data.
+    const size_t nodesNum = graphNodes.size();
+    for (size_t n = 0; n < nodesNum; n++) {
+        auto inputNode = std::dynamic_pointer_cast<MKLDNNInputNode>(graphNodes[n]);
+        if (!inputNode || !inputNode->getMemoryPtr() || inputNode->getChildEdges().size() < 2)
+            continue;
+
+        const auto childEdges = inputNode->childEdges;
+        for (size_t i = 1; i < childEdges.size(); i++) {
+            auto edge = childEdges[i].lock();
+            if (!edge)
+                continue;
+            auto child = edge->getChild();
+            const MKLDNNNodePtr clone = inputNode->cloneConstant(inputNode->getName() + "_" + std::to_string(i));
+            MKLDNNEdgePtr newEdge(new MKLDNNEdge(clone, child, edge->getInputNum(), edge->getOutputNum()));
+
+            // the edge is replaced in place, so the order of the parent edges of the child is kept
+            auto &parentEdges = child->parentEdges;
+            auto parentEdge = std::find_if(parentEdges.begin(), parentEdges.end(), [&](const MKLDNNEdgeWeakPtr &e) {
+                return e.lock() == edge;
+            });
+            *parentEdge = newEdge;
+            auto &siblingEdges = inputNode->childEdges;
+            siblingEdges.erase(std::find_if(siblingEdges.begin(), siblingEdges.end(), [&](const MKLDNNEdgeWeakPtr &e) {
+                return e.lock() == edge;
+            }));
+            clone->childEdges.push_back(newEdge);
+
+            *std::find(graphEdges.begin(), graphEdges.end(), edge) = newEdge;
+            graphNodes.push_back(clone);
+        }
+    }
+}
+
 void MKLDNNGraph::InitNodes() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::InitNodes");
     for (auto &node : graphNodes) {
@@ -351,24 +399,83 @@ void MKLDNNGraph::InitNodes() {
     }
 }
 
+void MKLDNNGraph::UseSparseWeights() {
+    if (config.sparseWeightsThreshold >= 1.f)
+        return;
+
+    for (auto &node : graphNodes) {
+        auto *fcNode = dynamic_cast<MKLDNNFullyConnectedNode *>(node.get());
+        if (fcNode)
+            fcNode->useSparseWeights(config.sparseWeightsThreshold);
+    }
+}
+
+void MKLDNNGraph::MapEmbeddingTables() {
+    if (config.embeddingTableMmapThreshold == 0)
+        return;
+
+    // the nodes of the split constant share the data, so the table is mapped once if all of them feed the embeddings
+    std::map<const void *, std::vector<MKLDNNInputNode *>> tables;
+    std::unordered_set<const void *> notTables;
+    for (auto &node : graphNodes) {
+        if (node->getType() != Input || !node->isConstant() || node->getChildEdges().empty())
+            continue;
+
+        auto *inputNode = dynamic_cast<MKLDNNInputNode *>(node.get());
+        if (!inputNode || !inputNode->getMemoryPtr())
+            continue;
+
+        bool isTable = true;
+        for (size_t i = 0; i < node->getChildEdges().size() && isTable; i++) {
+            auto edge = node->getChildEdgeAt(i);
+            isTable = edge->getOutputNum() == 0 &&
+                      one_of(edge->getChild()->getType(), EmbeddingBagOffsetsSum, EmbeddingBagPackedSum, EmbeddingSegmentsSum);
+        }
+
+        const void *data = inputNode->getMemoryPtr()->GetPtr();
+        if (isTable)
+            tables[data].push_back(inputNode);
+        else
+            notTables.insert(data);
+    }
+
+    for (auto &table : tables) {
+        auto &inputNodes = table.second;
+        if (notTables.count(table.first) || inputNodes.front()->getMemoryPtr()->GetSize() < config.embeddingTableMmapThreshold)
+            continue;
+
+        auto constOp = inputNodes.front()->getConstOp();
+        inputNodes.front()->mapToFile();
+        if (constOp)
+            mappedConstants.emplace_back(constOp, inputNodes.front()->getMemoryPtr());
+        for (size_t i = 1; i < inputNodes.size(); i++)
+            inputNodes[i]->shareConstant(*inputNodes.front());
+    }
+}
+
 void MKLDNNGraph::InitDescriptors() {
     OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "InitDescriptors", "Prepare");
 
-    for (auto &node : graphNodes) {
+    // the enumeration of the primitive descriptors of the node doesn't depend on its siblings
+    ParallelForEachNode([this](const MKLDNNNodePtr &node) {
         if (node->getType() == Input && _normalizePreprocMap.find(node->getName()) != _normalizePreprocMap.end()) {
             auto *inputNode = dynamic_cast<MKLDNNInputNode *>(node.get());
             if (inputNode)
                 inputNode->withMeanImage();
         }
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.getSupportedDescriptors);
-        node->getSupportedDescriptors();
-
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.initSupportedPrimitiveDescriptors);
-        node->initSupportedPrimitiveDescriptors();
-
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.filterSupportedPrimitiveDescriptors);
-        node->filterSupportedPrimitiveDescriptors();
-    }
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.getSupportedDescriptors);
+            node->getSupportedDescriptors();
+        }
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.initSupportedPrimitiveDescriptors);
+            node->initSupportedPrimitiveDescriptors();
+        }
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.filterSupportedPrimitiveDescriptors);
+            node->filterSupportedPrimitiveDescriptors();
+        }
+    });
 
     for (auto &node : graphNodes) {
         OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.selectOptimalPrimitiveDescriptor);
@@ -561,6 +668,25 @@ static edge_clusters_t findEdgeClusters(const std::vector<MKLDNNEdgePtr> & graph
     return edge_clusters;
 }
 
+// The workspace is allocated by the IE allocator only if the config places the memory, otherwise by mkldnn
+std::shared_ptr<void> MKLDNNGraph::allocateWorkspace(size_t size) const {
+    const bool bindToNumaNode = config.numaMemoryBinding && numaNode >= 0;
+    if (config.hugePages == HUGE_PAGES_NONE && !bindToNumaNode)
+        return nullptr;
+
+    AllocatorParams params;
+    params.hugePages = config.hugePages;
+    params.numaNode = bindToNumaNode ? numaNode : -1;
+    auto allocator = CreateAllocator(params);
+    void* handle = allocator ? allocator->alloc(size) : nullptr;
+    if (!handle)
+        IE_THROW() << "Failed to allocate " << size << " bytes of the graph workspace";
+    return std::shared_ptr<void>(allocator->lock(handle), [allocator, handle](void*) {
+        allocator->unlock(handle);
+        allocator->free(handle);
+    });
+}
+
 void MKLDNNGraph::AllocateWithReuse() {
     edge_clusters_t edge_clusters = findEdgeClusters(graphEdges);
 
@@ -592,9 +718,10 @@ void MKLDNNGraph::AllocateWithReuse() {
 
     edge_clusters.resize(edge_clusters_count);
 
-    const int64_t alignment = 32;  // 32 bytes
+    const int64_t alignment = config.memoryAlignment;  // in bytes
 
     std::vector<MemorySolver::Box> boxes(edge_clusters.size());
+    std::vector<bool> isPersistent(edge_clusters.size(), false);
     for (int i = 0; i < edge_clusters.size(); i++) {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
@@ -615,12 +742,16 @@ void MKLDNNGraph::AllocateWithReuse() {
         // Constant data are filled once on load.
         // So we need it untouchable during all execution time
         // -1 is a place holder for a max timestamp.
-        bool isConst = false, isOutput = false, isInput = false;
+        bool isConst = false, isOutput = false, isInput = false, isState = false;
         for (auto &edge : edge_clusters[i]) {
             isConst  |= isConstOutput(edge);
             isOutput |= edge->getChild()->getType() == Output;
             isInput  |= edge->getParent()->getType() == Input;
+            isState  |= edge->getParent()->getType() == MemoryInput || edge->getChild()->getType() == MemoryOutput;
         }
+        // Constant data and the states of the memory layers are kept between the inferences,
+        // so they can't be placed to the activation arena shared with the other graphs
+        isPersistent[i] = isConst || isState;
 
         if (reuse_io_tensors) {
             if (isInput | isConst) box.start = 0;
@@ -635,25 +766,66 @@ void MKLDNNGraph::AllocateWithReuse() {
         box.size = div_up(box.size, alignment);
     }
 
-    MemorySolver memSolver(boxes);
-    size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
+    // With the shared activation arena, the persistent boxes are placed to the own workspace of the graph
+    std::vector<MemorySolver::Box> ownBoxes, sharedBoxes;
+    for (int i = 0; i < boxes.size(); i++) {
+        (activationArena && !isPersistent[i] ? sharedBoxes : ownBoxes).push_back(boxes[i]);
+    }
+
+    MemorySolver sharedMemSolver(sharedBoxes);
+    activationReservation.reset();
+    if (!sharedBoxes.empty()) {
+        activationReservation = activationArena->reserve(static_cast<size_t>(sharedMemSolver.solve(config.memoryPlanner)) * alignment);
+        if (!activationReservation) {
+            // the arena can't provide the memory, so falling back to the own workspace
+            ownBoxes = boxes;
+            sharedBoxes.clear();
+        }
+    }
+
+    MemorySolver memSolver(ownBoxes);
+    size_t total_size = static_cast<size_t>(memSolver.solve(config.memoryPlanner)) * alignment;
+
+    ENABLE_CPU_DEBUG_CAP(dumpMemoryPlanningStats(boxes, alignment));
 
-    memWorkspace = std::make_shared<MKLDNNMemory>(eng);
-    memWorkspace->Create(MKLDNNMemoryDesc({total_size}, mkldnn::memory::data_type::s8));
+    // mkldnn aligns the memory by 64 bytes, so the bigger alignment requires a padding at the beginning
+    const int64_t defaultAlignment = 64;
+    size_t padding = alignment > defaultAlignment ? static_cast<size_t>(alignment) : 0;
+
+    // the graph re-created for the other input shapes keeps the workspace, unless the shapes need more memory
+    if (!memWorkspace || memWorkspace->GetSize() < total_size + padding) {
+        memWorkspace.reset();
+        workspaceBuffer.reset();
+        memWorkspace = std::make_shared<MKLDNNMemory>(eng);
+        workspaceBuffer = allocateWorkspace(total_size + padding);
+        memWorkspace->Create(MKLDNNMemoryDesc({total_size + padding}, mkldnn::memory::data_type::s8), workspaceBuffer.get());
+    }
 
     if (edge_clusters.empty())
         return;
 
     auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
+    if (padding) {
+        auto address = reinterpret_cast<uintptr_t>(workspace_ptr);
+        workspace_ptr += rnd_up(address, static_cast<uintptr_t>(alignment)) - address;
+    }
+
+    // the arena memory may be in use by another graph
+    auto arenaLock = lockActivationArena();
+    std::vector<bool> isShared(edge_clusters.size(), false);
+    for (auto &box : sharedBoxes) {
+        isShared[box.id] = true;
+    }
 
     for (int i = 0; i < edge_clusters.size(); i++) {
         int count = 0;
         for (auto &edge : edge_clusters[i]) {
             if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation) {
-                int64_t offset = memSolver.getOffset(i);
+                int8_t* base_ptr = isShared[i] ? reinterpret_cast<int8_t*>(activationReservation->data()) : workspace_ptr;
+                int64_t offset = isShared[i] ? sharedMemSolver.getOffset(i) : memSolver.getOffset(i);
                 // !! Fallback to individual memory allocation !!
                 // if you like to check infer without reuse just call this function without arguments.
-                edge->allocate(workspace_ptr + offset * alignment);  // alignment in byte
+                edge->allocate(base_ptr + offset * alignment);  // alignment in byte
 
                 // TODO: WA for some test (like strided_slice_test) which use tensors with
                 //       shapes {0}. And it is implisitly converted into {1} tensor.
@@ -668,6 +840,42 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
 }
 
+#ifdef CPU_DEBUG_CAPS
+void MKLDNNGraph::dumpMemoryPlanningStats(const std::vector<MemorySolver::Box>& boxes, int64_t alignment) {
+    const std::string& path = config.debugCaps.memoryStatsPath;
+    if (path.empty())
+        return;
+
+    // All the boxes are planned as a single workspace, so the numbers don't depend on the activation arena
+    std::stringstream line;
+    MemorySolver lowerBoundSolver(boxes);
+    line << _name << "," << boxes.size() << "," << alignment << "," << lowerBoundSolver.maxDepth() * alignment;
+    for (auto strategy : {MemorySolver::Strategy::GreedyBySize, MemorySolver::Strategy::BestFit,
+                          MemorySolver::Strategy::GreedyByBreadth, MemorySolver::Strategy::MinFootprint}) {
+        MemorySolver solver(boxes);
+        auto start = std::chrono::steady_clock::now();
+        int64_t size = solver.solve(strategy);
+        auto time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        line << "," << size * alignment << "," << time.count();
+    }
+    line << "\n";
+
+    static std::mutex statsMutex;
+    std::lock_guard<std::mutex> lock(statsMutex);
+    if (path == "cout") {
+        std::cout << line.str();
+        return;
+    }
+    bool isNew = !std::ifstream(path).good();
+    std::ofstream stats(path, std::ios::app);
+    if (isNew) {
+        stats << "graph,boxes,alignment,max_depth,greedy_by_size,greedy_by_size_us,best_fit,best_fit_us,"
+                 "greedy_by_breadth,greedy_by_breadth_us,min_footprint,min_footprint_us\n";
+    }
+    stats << line.str();
+}
+#endif
+
 void MKLDNNGraph::Allocate() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::Allocate");
 
@@ -688,9 +896,51 @@ void MKLDNNGraph::Allocate() {
 
 void MKLDNNGraph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::CreatePrimitives");
-    for (auto& node : graphNodes) {
+    // the kernels are generated and the weights are reordered by the independent nodes in parallel
+    ParallelForEachNode([](const MKLDNNNodePtr &node) {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.createPrimitive);
         node->createPrimitive();
+    });
+}
+
+void MKLDNNGraph::ParallelForEachNode(const std::function<void(const MKLDNNNodePtr&)> &fn) {
+    std::unordered_map<const MKLDNNNode*, size_t> nodeLevels;
+    std::vector<std::vector<MKLDNNNodePtr>> levels;
+    for (auto &node : graphNodes) {
+        size_t level = 0;
+        for (auto &parentEdge : node->getParentEdges()) {
+            auto edge = parentEdge.lock();
+            if (!edge)
+                continue;
+            auto parentLevel = nodeLevels.find(edge->getParent().get());
+            if (parentLevel != nodeLevels.end())
+                level = std::max(level, parentLevel->second + 1);
+        }
+        nodeLevels[node.get()] = level;
+        if (levels.size() <= level)
+            levels.resize(level + 1);
+        levels[level].push_back(node);
+    }
+
+    for (auto &nodes : levels) {
+        if (nodes.size() == 1) {
+            fn(nodes.front());
+            continue;
+        }
+        // the exception can't leave the parallel region, so the first one is rethrown after the level
+        std::exception_ptr error;
+        std::mutex errorGuard;
+        parallel_for(nodes.size(), [&](size_t i) {
+            try {
+                fn(nodes[i]);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorGuard);
+                if (!error)
+                    error = std::current_exception();
+            }
+        });
+        if (error)
+            std::rethrow_exception(error);
     }
 }
 
@@ -753,8 +1003,12 @@ void MKLDNNGraph::PullOutputData(const BlobMap &out) {
         void *ext_blob_ptr = ext_blob->buffer();
         void *intr_blob_ptr = intr_blob.GetData();
 
-        // That is the same memory. No need to copy
-        if (ext_blob_ptr == intr_blob_ptr) continue;
+        pulledOutputs++;
+        // That is the same memory (the output edge was rebound to the user blob). No need to copy
+        if (ext_blob_ptr == intr_blob_ptr) {
+            zeroCopyOutputs++;
+            continue;
+        }
 
         int MB = intr_blob.GetDims()[0];
         int MB_to_process = node->batchToProcess();
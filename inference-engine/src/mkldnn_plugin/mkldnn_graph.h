@@ -10,11 +10,16 @@
 #include "normalize_preprocess.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
+#include "mkldnn_activation_arena.hpp"
+#include <ngraph/op/constant.hpp>
 #include <map>
 #include <string>
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <functional>
+#include <mutex>
+#include <utility>
 
 namespace MKLDNNPlugin {
 class MKLDNNInferRequest;
@@ -172,6 +177,48 @@ public:
         return isQuantizedFlag;
     }
 
+    /**
+     * @brief Places the activations of the graph to the arena shared with the graphs of other networks (on next CreateGraph)
+     */
+    void setActivationArena(const MKLDNNActivationArena::Ptr& arena) {
+        activationArena = arena;
+    }
+
+    /**
+     * @brief NUMA node of the stream the graph is created for, the activation memory is bound to it if the
+     * CPU_NUMA_MEMORY_BINDING is enabled (on next CreateGraph)
+     */
+    void setNumaNode(int node) {
+        numaNode = node;
+    }
+
+    /**
+     * @brief Takes the ownership of the shared activation arena, the lock is empty if the graph does not use the arena
+     */
+    std::unique_lock<std::mutex> lockActivationArena() const {
+        return activationReservation ? activationReservation->lock() : std::unique_lock<std::mutex>{};
+    }
+
+    /**
+     * @brief Number of the outputs written by the graph directly to the user blobs, i.e. pulled without a copy,
+     * and the total number of the pulled outputs, over all inferences of the graph
+     */
+    std::pair<unsigned int, unsigned int> getZeroCopyOutputsCount() const {
+        return {zeroCopyOutputs.load(), pulledOutputs.load()};
+    }
+
+    using MappedConstants = std::vector<std::pair<std::shared_ptr<ngraph::op::Constant>, MKLDNNMemoryCPtr>>;
+
+    /**
+     * @brief Takes the Constants of the network whose data are mapped to file by the graph, with the mapped memory,
+     * so the owner of the network may replace them and release their data
+     */
+    MappedConstants TakeMappedConstants() {
+        MappedConstants constants;
+        constants.swap(mappedConstants);
+        return constants;
+    }
+
 protected:
     void VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes);
 
@@ -184,6 +231,8 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _normalizePreprocMap.clear();
+        mappedConstants.clear();
+        activationReservation.reset();
     }
     Status status { NotReady };
     Config config;
@@ -195,6 +244,11 @@ protected:
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    // the memory of the workspace if it's placed by the config, otherwise the workspace owns its memory
+    std::shared_ptr<void> workspaceBuffer;
+    int numaNode = -1;
+    MKLDNNActivationArena::Ptr activationArena;
+    MKLDNNActivationArena::Reservation::Ptr activationReservation;
 
     std::map<std::string, MKLDNNNodePtr> inputNodesMap;
     std::map<std::string, MKLDNNNodePtr> outputNodesMap;
@@ -204,20 +258,37 @@ protected:
     std::map<std::string, NormalizePreprocess> _normalizePreprocMap;
     std::string _name;
 
+    MappedConstants mappedConstants;
+
     bool isQuantizedFlag = false;
 
+    std::atomic<unsigned int> zeroCopyOutputs {0};
+    std::atomic<unsigned int> pulledOutputs {0};
+
     static mkldnn::engine eng;
 
     void Replicate(const InferenceEngine::CNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
     void Replicate(const std::shared_ptr<const ngraph::Function> &subgraph, const MKLDNNExtensionManager::Ptr& extMgr);
     void InitGraph();
+    void SplitSharedConstants();
     void InitNodes();
     void InitDescriptors();
+    void UseSparseWeights();
+    void MapEmbeddingTables();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
+    std::shared_ptr<void> allocateWorkspace(size_t size) const;
+#ifdef CPU_DEBUG_CAPS
+    void dumpMemoryPlanningStats(const std::vector<MemorySolver::Box>& boxes, int64_t alignment);
+#endif
     void CreatePrimitives();
+    /**
+     * Calls the function for the nodes level by level: the parents of a node belong to the previous levels, so the nodes
+     * of a level don't depend on each other and are processed in parallel
+     */
+    void ParallelForEachNode(const std::function<void(const MKLDNNNodePtr&)> &fn);
     void ExtractConstantNodes();
     void ExecuteConstantNodesOnly();
 
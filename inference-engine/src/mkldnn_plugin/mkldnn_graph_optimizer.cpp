@@ -17,6 +17,8 @@
 #include <nodes/mkldnn_transpose_node.h>
 #include "nodes/mkldnn_interpolate_node.h"
 #include "nodes/mkldnn_input_node.h"
+#include "nodes/mkldnn_embedding_bag_sum_node.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
 #include "nodes/common/cpu_convert.h"
 
 #include "mkldnn/ie_mkldnn.h"
@@ -41,6 +43,7 @@
 #include <memory>
 #include <set>
 #include <algorithm>
+#include <numeric>
 
 #include "mkldnn_itt.h"
 #include "cpu_memory_desc_utils.h"
@@ -56,6 +59,14 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseConvolutionAndBias(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEmbeddingBagAndDequantization");
+    FuseEmbeddingBagAndDequantization(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseFullyConnectedAndWeightsDecompression");
+    FuseFullyConnectedAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseMultiplyAndAdd");
     FuseMultiplyAndAdd(graph);
     graph.RemoveDroppedNodes();
@@ -410,6 +421,319 @@ void MKLDNNGraphOptimizer::FuseMultiplyAndAdd(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseEmbeddingBagAndDequantization(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSutableEmbeddingNode = [](MKLDNNNodePtr node) {
+        return one_of(node->getType(), EmbeddingBagOffsetsSum, EmbeddingBagPackedSum, EmbeddingSegmentsSum) &&
+               one_of(node->getOriginalInputPrecisionAtPort(0), Precision::FP32, Precision::BF16) &&
+               node->getParentEdgeAt(0)->getShape().isStatic();
+    };
+
+    // Returns the values of the constant input of the eltwise node broadcasted per row of the table, if they are
+    auto getPerRowConstant = [](MKLDNNNodePtr eltwise, size_t rowsNum, std::vector<float>& values) {
+        if (eltwise->getParentEdges().size() != 2)
+            return false;
+        auto constNode = eltwise->getParentEdgesAtPort(1)[0]->getParent();
+        if (constNode->getType() != Input || !constNode->isConstant() || constNode->getChildEdges().size() != 1 ||
+            constNode->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            return false;
+
+        const auto& dims = eltwise->getParentEdgesAtPort(1)[0]->getShape().getDims();
+        const auto& dataDims = eltwise->getParentEdgesAtPort(0)[0]->getShape().getDims();
+        const size_t size = std::accumulate(dims.begin(), dims.end(), 1lu, std::multiplies<size_t>());
+        if (size != 1 && (dims.size() != dataDims.size() || dims[0] != rowsNum || size != rowsNum))
+            return false;
+
+        auto input = std::dynamic_pointer_cast<MKLDNNInputNode>(constNode);
+        if (!input || !input->getMemoryPtr())
+            return false;
+        auto data = static_cast<const float*>(input->getMemoryPtr()->GetPtr());
+        values.assign(data, data + size);
+        return true;
+    };
+
+    // The dequantization is applied as (row * scale + shift) and the values per row are broadcasted as necessary
+    auto broadcast = [](std::vector<float>& values, size_t size) {
+        if (values.size() == 1 && size > 1)
+            values.resize(size, values[0]);
+    };
+
+    for (auto& node : graphNodes) {
+        if (!isSutableEmbeddingNode(node))
+            continue;
+
+        const size_t rowsNum = node->getParentEdgeAt(0)->getShape().getStaticDims()[0];
+        std::vector<float> scales = {1.f};
+        std::vector<float> shifts = {0.f};
+
+        // The chain of the eltwise nodes is walked up to the Convert of the quantized table
+        std::vector<MKLDNNNodePtr> eltwiseNodes;
+        auto parent = node->getParentEdgesAtPort(0)[0]->getParent();
+        while (parent->getType() == Eltwise && parent->getFusedWith().empty() && parent->getChildEdges().size() == 1) {
+            eltwiseNodes.push_back(parent);
+            parent = parent->getParentEdgesAtPort(0)[0]->getParent();
+        }
+
+        if (eltwiseNodes.empty() || parent->getType() != Convert || parent->getChildEdges().size() != 1)
+            continue;
+        auto convert = parent;
+        auto table = convert->getParentEdgesAtPort(0)[0]->getParent();
+        auto tablePrecision = table->getOriginalOutputPrecisionAtPort(0);
+        if (table->getType() != Input || !table->isConstant() || !one_of(tablePrecision, Precision::I8, Precision::U8))
+            continue;
+
+        bool isDequantization = true;
+        for (auto it = eltwiseNodes.rbegin(); it != eltwiseNodes.rend() && isDequantization; it++) {
+            auto eltwise = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(*it);
+            std::vector<float> values;
+            switch (eltwise->getAlgorithm()) {
+                case EltwiseMultiply:
+                    isDequantization = getPerRowConstant(eltwise, rowsNum, values);
+                    if (!isDequantization)
+                        break;
+                    broadcast(scales, values.size());
+                    broadcast(shifts, values.size());
+                    broadcast(values, scales.size());
+                    for (size_t i = 0; i < values.size(); i++) {
+                        scales[i] *= values[i];
+                        shifts[i] *= values[i];
+                    }
+                    break;
+                case EltwiseAdd:
+                case EltwiseSubtract:
+                    isDequantization = getPerRowConstant(eltwise, rowsNum, values);
+                    if (!isDequantization)
+                        break;
+                    broadcast(shifts, values.size());
+                    broadcast(values, shifts.size());
+                    for (size_t i = 0; i < values.size(); i++)
+                        shifts[i] += eltwise->getAlgorithm() == EltwiseAdd ? values[i] : -values[i];
+                    break;
+                case EltwisePowerStatic:
+                    isDequantization = eltwise->getAlpha() == 1.f && eltwise->getParentEdges().size() == 1;
+                    for (size_t i = 0; i < scales.size() && isDequantization; i++)
+                        scales[i] *= eltwise->getBeta();
+                    for (size_t i = 0; i < shifts.size() && isDequantization; i++)
+                        shifts[i] = shifts[i] * eltwise->getBeta() + eltwise->getGamma();
+                    break;
+                default:
+                    isDequantization = false;
+            }
+        }
+        if (!isDequantization)
+            continue;
+
+        auto embeddingNode = dynamic_cast<MKLDNNEmbeddingBagSumNode*>(node.get());
+        if (embeddingNode == nullptr)
+            IE_THROW() << "Cannot get embedding bag node " << node->getName();
+
+        bool withShifts = std::any_of(shifts.begin(), shifts.end(), [](float shift) { return shift != 0.f; });
+        embeddingNode->fuseDequantization(tablePrecision, scales, withShifts ? shifts : std::vector<float>{});
+
+        for (auto& eltwise : eltwiseNodes) {
+            if (eltwise->getParentEdges().size() > 1) {
+                auto constEdge = eltwise->getParentEdgesAtPort(1)[0];
+                graph.RemoveEdge(constEdge);
+            }
+            node->addOriginalLayer(eltwise->getOriginalLayers());
+            graph.DropNode(eltwise);
+        }
+        node->addOriginalLayer(convert->getOriginalLayers());
+        graph.DropNode(convert);
+    }
+}
+
+void MKLDNNGraphOptimizer::FuseFullyConnectedAndWeightsDecompression(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSutableFullyConnectedNode = [](MKLDNNNodePtr node) {
+        return node->getType() == FullyConnected && node->getOriginalInputPrecisionAtPort(0) != Precision::U8 &&
+               node->getOriginalInputPrecisionAtPort(0) != Precision::I8 && node->getParentEdgeAt(1)->getShape().getRank() == 2 &&
+               node->getParentEdgeAt(1)->getShape().isStatic();
+    };
+
+    auto hasSingleChild = [](MKLDNNNodePtr node) {
+        return node->getChildEdges().size() == 1;
+    };
+
+    // The values of the weights are laid out as [N, K], [N, G, K / G] or transposed ([K, N], [G, K / G, N]),
+    // where N is the number of the output channels and G is the number of the groups of the input channels
+    struct WeightsLayout {
+        std::vector<size_t> dims;
+        size_t nAxis;
+        int groupAxis;
+        size_t groups;
+    };
+
+    // Returns the values of the constant input of the eltwise node per output channel and group, if they are
+    auto getConstantPerGroup = [](MKLDNNNodePtr eltwise, const WeightsLayout& layout, std::vector<float>& values) {
+        if (eltwise->getParentEdges().size() != 2)
+            return false;
+        auto constNode = eltwise->getParentEdgesAtPort(1)[0]->getParent();
+        if (constNode->getType() != Input || !constNode->isConstant() || constNode->getChildEdges().size() != 1 ||
+            constNode->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            return false;
+
+        auto dims = eltwise->getParentEdgesAtPort(1)[0]->getShape().getStaticDims();
+        if (dims.size() > layout.dims.size())
+            return false;
+        dims.insert(dims.begin(), layout.dims.size() - dims.size(), 1);
+        for (size_t i = 0; i < dims.size(); i++) {
+            if (dims[i] != 1 && dims[i] != layout.dims[i])
+                return false;
+            if (dims[i] != 1 && i != layout.nAxis && static_cast<int>(i) != layout.groupAxis)
+                return false;
+        }
+
+        auto input = std::dynamic_pointer_cast<MKLDNNInputNode>(constNode);
+        if (!input || !input->getMemoryPtr())
+            return false;
+        auto data = static_cast<const float*>(input->getMemoryPtr()->GetPtr());
+
+        std::vector<size_t> strides(dims.size(), 1);
+        for (int i = static_cast<int>(dims.size()) - 2; i >= 0; i--)
+            strides[i] = strides[i + 1] * dims[i + 1];
+        const size_t N = layout.dims[layout.nAxis];
+        const size_t nStride = dims[layout.nAxis] == 1 ? 0 : strides[layout.nAxis];
+        const size_t groupStride = layout.groupAxis < 0 || dims[layout.groupAxis] == 1 ? 0 : strides[layout.groupAxis];
+
+        values.resize(N * layout.groups);
+        for (size_t n = 0; n < N; n++) {
+            for (size_t g = 0; g < layout.groups; g++)
+                values[n * layout.groups + g] = data[n * nStride + g * groupStride];
+        }
+        return true;
+    };
+
+    for (auto& node : graphNodes) {
+        if (!isSutableFullyConnectedNode(node))
+            continue;
+
+        const auto weightsDims = node->getParentEdgeAt(1)->getShape().getStaticDims();
+        const size_t N = weightsDims[0], K = weightsDims[1];
+
+        // The weights may be transposed and reshaped (grouped) after the decompression
+        std::vector<MKLDNNNodePtr> layoutNodes;
+        bool transposed = false;
+        auto parent = node->getParentEdgesAtPort(1)[0]->getParent();
+        if (parent->getType() == Transpose && hasSingleChild(parent)) {
+            auto transpose = std::dynamic_pointer_cast<MKLDNNTransposeNode>(parent);
+            if (!transpose || transpose->getOrder() != SizeVector{1, 0})
+                continue;
+            transposed = true;
+            layoutNodes.push_back(parent);
+            parent = parent->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        if (parent->getType() == Reshape && hasSingleChild(parent)) {
+            layoutNodes.push_back(parent);
+            parent = parent->getParentEdgesAtPort(0)[0]->getParent();
+        }
+
+        std::vector<MKLDNNNodePtr> eltwiseNodes;
+        while (parent->getType() == Eltwise && parent->getFusedWith().empty() && hasSingleChild(parent)) {
+            eltwiseNodes.push_back(parent);
+            parent = parent->getParentEdgesAtPort(0)[0]->getParent();
+        }
+
+        if (eltwiseNodes.empty() || parent->getType() != Convert || !hasSingleChild(parent))
+            continue;
+        auto convert = parent;
+        auto weights = convert->getParentEdgesAtPort(0)[0]->getParent();
+        auto weightsPrecision = weights->getOriginalOutputPrecisionAtPort(0);
+        if (weights->getType() != Input || !weights->isConstant() || !hasSingleChild(weights) ||
+            !one_of(weightsPrecision, Precision::I8, Precision::U8))
+            continue;
+
+        WeightsLayout layout;
+        layout.dims = convert->getParentEdgesAtPort(0)[0]->getShape().getStaticDims();
+        if (layout.dims == (transposed ? SizeVector{K, N} : SizeVector{N, K})) {
+            layout.nAxis = transposed ? 1 : 0;
+            layout.groupAxis = -1;
+            layout.groups = 1;
+        } else if (layout.dims.size() == 3 && !transposed && layout.dims[0] == N && layout.dims[1] * layout.dims[2] == K) {
+            layout.nAxis = 0;
+            layout.groupAxis = 1;
+            layout.groups = layout.dims[1];
+        } else if (layout.dims.size() == 3 && transposed && layout.dims[2] == N && layout.dims[0] * layout.dims[1] == K) {
+            layout.nAxis = 2;
+            layout.groupAxis = 0;
+            layout.groups = layout.dims[0];
+        } else {
+            continue;
+        }
+
+        // The decompression is applied as (weight * scale + shift)
+        std::vector<float> scales(N * layout.groups, 1.f);
+        std::vector<float> shifts(N * layout.groups, 0.f);
+        bool isDecompression = true;
+        for (auto it = eltwiseNodes.rbegin(); it != eltwiseNodes.rend() && isDecompression; it++) {
+            auto eltwise = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(*it);
+            std::vector<float> values;
+            switch (eltwise->getAlgorithm()) {
+                case EltwiseMultiply:
+                    isDecompression = getConstantPerGroup(eltwise, layout, values);
+                    for (size_t i = 0; i < values.size(); i++) {
+                        scales[i] *= values[i];
+                        shifts[i] *= values[i];
+                    }
+                    break;
+                case EltwiseAdd:
+                case EltwiseSubtract:
+                    isDecompression = getConstantPerGroup(eltwise, layout, values);
+                    for (size_t i = 0; i < values.size(); i++)
+                        shifts[i] += eltwise->getAlgorithm() == EltwiseAdd ? values[i] : -values[i];
+                    break;
+                case EltwisePowerStatic:
+                    isDecompression = eltwise->getAlpha() == 1.f && eltwise->getParentEdges().size() == 1;
+                    for (size_t i = 0; i < scales.size() && isDecompression; i++) {
+                        scales[i] *= eltwise->getBeta();
+                        shifts[i] = shifts[i] * eltwise->getBeta() + eltwise->getGamma();
+                    }
+                    break;
+                default:
+                    isDecompression = false;
+            }
+        }
+        if (!isDecompression)
+            continue;
+
+        auto fcNode = std::dynamic_pointer_cast<MKLDNNFullyConnectedNode>(node);
+        if (fcNode == nullptr)
+            IE_THROW() << "Cannot get fully connected node " << node->getName();
+
+        CompressedWeightsParams params;
+        params.precision = weightsPrecision;
+        params.N = N;
+        params.K = K;
+        params.groups = layout.groups;
+        params.transposed = transposed;
+        params.scales = scales;
+        if (std::any_of(shifts.begin(), shifts.end(), [](float shift) { return shift != 0.f; }))
+            params.shifts = shifts;
+        fcNode->fuseWeightsDecompression(params);
+
+        auto dropNode = [&](const MKLDNNNodePtr& droppedNode) {
+            std::vector<MKLDNNEdgePtr> constEdges;
+            for (size_t port = 1; port < droppedNode->getParentEdges().size(); port++)
+                constEdges.push_back(droppedNode->getParentEdgesAtPort(port)[0]);
+            for (auto& constEdge : constEdges)
+                graph.RemoveEdge(constEdge);
+            constEdges.clear();
+            node->addOriginalLayer(droppedNode->getOriginalLayers());
+            graph.DropNode(droppedNode);
+        };
+        for (auto& layoutNode : layoutNodes)
+            dropNode(layoutNode);
+        for (auto& eltwise : eltwiseNodes)
+            dropNode(eltwise);
+        dropNode(convert);
+
+        // the weights are consumed as they are stored
+        node->inputShapes[1] = Shape(layout.dims);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseConvolutionAndZeroPoints(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -34,6 +34,7 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
     if (execNetwork->_graphs.size() == 0)
         IE_THROW() << "No graph was found";
     graph = &(execNetwork->GetGraph()._graph);
+    withDynamicShapes = execNetwork->_cfg.dynamicInputShapes;
 
     // Allocate all input blobs
     for (const auto& it : _networkInputs) {
@@ -171,6 +172,19 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     auto graphLock = execNetwork->GetGraph();
     graph = &(graphLock._graph);
 
+    if (withDynamicShapes) {
+        MKLDNNExecNetwork::InputShapes shapes;
+        for (const auto& input : _inputs)
+            shapes[input.first] = input.second->getTensorDesc().getDims();
+        if (!memoryStates.empty() && shapes != execNetwork->_loadedShapes)
+            IE_THROW() << "The network with the states can't be inferred with the input shapes other than the loaded ones";
+        execNetwork->ReshapeGraph(graphLock, shapes);
+        resizeOutputs();
+    }
+
+    // the graphs of the same stream sharing the activation arena run one at a time
+    auto arenaLock = graph->lockActivationArena();
+
     ThrowIfCanceled();
 
     execDataPreprocessing(_inputs);
@@ -204,6 +218,43 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> MKLDNNPlugin:
     return perfMap;
 }
 
+// The output blobs of the plugin are reallocated when the output shapes change, the user ones should fit the shapes
+void MKLDNNPlugin::MKLDNNInferRequest::resizeOutputs() {
+    for (auto& output : _outputs) {
+        const auto dims = graph->getOutputBlob(output.first)->getTensorDesc().getDims();
+        auto& blob = output.second;
+        if (blob->getTensorDesc().getDims() == dims)
+            continue;
+
+        if (userOutputs.count(output.first))
+            IE_THROW(ParameterMismatch) << "The output blob " << output.first << " set by the user doesn't fit the output shape "
+                                        << InferenceEngine::details::dumpVec(dims) << " of the input shapes";
+        blob = make_blob_with_precision(InferenceEngine::TensorDesc(blob->getTensorDesc().getPrecision(), dims,
+                                                                    InferenceEngine::TensorDesc::getLayoutByDims(dims)));
+        blob->allocate();
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::checkBlobs() {
+    if (!withDynamicShapes) {
+        IInferRequestInternal::checkBlobs();
+        return;
+    }
+    // the blobs of any shape are accepted, so they are checked against their own shapes
+    for (auto const& input : _inputs)
+        checkBlob(input.second, input.first, true, input.second->getTensorDesc().getDims());
+    for (auto const& output : _outputs)
+        checkBlob(output.second, output.first, false, output.second->getTensorDesc().getDims());
+}
+
+// The graph output edge can be rebound to the user blob, when the blob has the same precision and memory layout
+// (the Layout enum of the descriptors may differ, e.g. BLOCKED vs NCHW, while describing the same memory)
+static inline bool canShareOutputMemory(const InferenceEngine::TensorDesc& userDesc, const InferenceEngine::TensorDesc& graphDesc) {
+    return userDesc.getPrecision() == graphDesc.getPrecision() &&
+           userDesc.getDims() == graphDesc.getDims() &&
+           userDesc.getBlockingDesc() == graphDesc.getBlockingDesc();
+}
+
 InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::string& name) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "GetBlob");
 
@@ -238,13 +289,13 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
 
             _inputs[name] = make_blob_with_precision(desc);
             _inputs[name]->allocate();
-            if (pBlob->getTensorDesc() == desc &&
+            if (!withDynamicShapes && pBlob->getTensorDesc() == desc &&
                 graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit) {
                 externalPtr[name] = _inputs[name]->buffer();
             }
         }
         data = _inputs[name];
-        checkBlob(data, name, true);
+        checkBlob(data, name, true, withDynamicShapes ? data->getTensorDesc().getDims() : InferenceEngine::SizeVector{});
         // check if preprocess required, but still wasn't set
         auto preProcessedInput = std::find_if(std::begin(_networkInputs), std::end(_networkInputs),
             [&](const std::pair<std::string, InferenceEngine::InputInfo::Ptr>& pair)
@@ -301,12 +352,13 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
             }
 
             _outputs[name] = data;
-            if (!externalPtr.count(name) && data->getTensorDesc() == pBlob->getTensorDesc() && !graph->getProperty().batchLimit) {
+            if (!withDynamicShapes && !externalPtr.count(name) && canShareOutputMemory(data->getTensorDesc(), pBlob->getTensorDesc()) &&
+                !graph->getProperty().batchLimit) {
                 externalPtr[name] = data->buffer();
             }
         }
         data = _outputs[name];
-        checkBlob(data, name, false);
+        checkBlob(data, name, false, withDynamicShapes ? data->getTensorDesc().getDims() : InferenceEngine::SizeVector{});
     }
     if (!data) {
         IE_THROW() << "Cannot find blob with name: " << name;
@@ -355,21 +407,29 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             // pre-processing
             _preProcData[name]->setRoiBlob(data);
         } else {
-            size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
-                ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
-                : 1;
-            if (dataSize != inputSize) {
-                IE_THROW() << "Input blob size is not equal network input size ("
-                                   << dataSize << "!=" << inputSize << ").";
-            }
+            // the network with the dynamic input shapes accepts the blobs of any shape of the same rank
+            if (withDynamicShapes && foundInput->getTensorDesc().getDims().size() == data->getTensorDesc().getDims().size()) {
+                if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                    foundInput->getTensorDesc().getLayout() != data->getTensorDesc().getLayout()) {
+                    IE_THROW(ParameterMismatch) << "Failed to set input blob. Layout mismatch.";
+                }
+            } else {
+                size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
+                    ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
+                    : 1;
+                if (dataSize != inputSize) {
+                    IE_THROW() << "Input blob size is not equal network input size ("
+                                       << dataSize << "!=" << inputSize << ").";
+                }
 
-            if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-                IE_THROW(ParameterMismatch) << "Failed to set input blob. Dimensions mismatch.";
-            }
+                if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+                    IE_THROW(ParameterMismatch) << "Failed to set input blob. Dimensions mismatch.";
+                }
 
-            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
-                foundInput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
-                IE_THROW(ParameterMismatch) << "Failed to set input blob. Blocking descriptor mismatch.";
+                if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                    foundInput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
+                    IE_THROW(ParameterMismatch) << "Failed to set input blob. Blocking descriptor mismatch.";
+                }
             }
 
             auto pBlob = graph->getInputBlob(name);
@@ -377,7 +437,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
                 IE_THROW() << "MKLDNN graph doesn't contain input node with name: " << name;
             }
 
-            if (data->getTensorDesc() == pBlob->getTensorDesc() &&
+            if (!withDynamicShapes && data->getTensorDesc() == pBlob->getTensorDesc() &&
                 graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit) {
                 externalPtr[name] = data->buffer();
             } else if (externalPtr.find(name) != externalPtr.end()) {
@@ -395,32 +455,36 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             IE_THROW(ParameterMismatch) << "Failed to set output blob with precision: "
                                << data->getTensorDesc().getPrecision() << ", if CNNNetwork output blob precision is: " << foundOutput->getPrecision();
         }
-        size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
-            ? InferenceEngine::details::product(foundOutput->getDims())
-            : 1;
-        if (dataSize != outputSize) {
-            IE_THROW() << "Output blob size is not equal network output size ("
-                               << dataSize << "!=" << outputSize << ").";
-        }
-        if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-            IE_THROW(ParameterMismatch) << "Failed to set output Blob. Dimensions mismatch.";
-        }
-        if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
-            foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
-                IE_THROW(ParameterMismatch) << "Failed to set output blob. Blocking descriptor mismatch.";
+        // the output blob of the other shape is checked by the inference against the output shape, see resizeOutputs()
+        if (!withDynamicShapes || foundOutput->getTensorDesc().getDims().size() != data->getTensorDesc().getDims().size()) {
+            size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
+                ? InferenceEngine::details::product(foundOutput->getDims())
+                : 1;
+            if (dataSize != outputSize) {
+                IE_THROW() << "Output blob size is not equal network output size ("
+                                   << dataSize << "!=" << outputSize << ").";
+            }
+            if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+                IE_THROW(ParameterMismatch) << "Failed to set output Blob. Dimensions mismatch.";
+            }
+            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
+                    IE_THROW(ParameterMismatch) << "Failed to set output blob. Blocking descriptor mismatch.";
+            }
         }
 
         auto pBlob = graph->getOutputBlob(name);
         if (!pBlob)
             IE_THROW() << "MKLDNN graph doesn't contain output node with name: " << name;
 
-        if (data->getTensorDesc() == pBlob->getTensorDesc() &&
+        if (!withDynamicShapes && canShareOutputMemory(data->getTensorDesc(), pBlob->getTensorDesc()) &&
                 !graph->getProperty().batchLimit) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
         }
         _outputs[name] = data;
+        userOutputs.insert(name);
     }
 }
 
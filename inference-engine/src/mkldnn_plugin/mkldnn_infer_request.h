@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <unordered_set>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
@@ -34,6 +35,8 @@ public:
 
     void SetBatch(int batch = -1) override;
 
+    void checkBlobs() override;
+
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> QueryState() override;
 
     /**
@@ -55,8 +58,13 @@ private:
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
     void changeDefaultPtr();
+    void resizeOutputs();
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
+    // the network accepts the input shapes other than the loaded ones, so the blobs are never bound to the graph memory
+    bool                                withDynamicShapes = false;
+    // the outputs set by the user, their blobs are never reallocated for the other output shapes
+    std::unordered_set<std::string>     userOutputs;
     std::map<std::string, void*>        externalPtr;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
@@ -8,6 +8,8 @@
 
 
 #include <algorithm>
+#include <limits>
+#include <utility>
 #include <vector>
 #include <map>
 
@@ -57,19 +59,106 @@ inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Bo
     }
 }
 
-int64_t MemorySolver::solve() {
+namespace {
+
+struct PlacedBox {
+    int start;
+    int finish;
+    int64_t offset;
+    int64_t size;
+};
+
+// Returns the offset of the smallest gap between the placed boxes alive at the same time where the box fits in.
+// If there is no such gap, the box is placed on the top of them.
+int64_t findBestFitOffset(const MemorySolver::Box &box, const std::vector<PlacedBox> &placed) {
+    std::vector<std::pair<int64_t, int64_t>> busy;  // [begin, end) of the memory used by the intersected boxes
+    for (const auto &p : placed) {
+        if (p.start <= box.finish && box.start <= p.finish)
+            busy.emplace_back(p.offset, p.offset + p.size);
+    }
+    std::sort(busy.begin(), busy.end());
+
+    int64_t best_offset = -1;
+    int64_t best_gap = std::numeric_limits<int64_t>::max();
+    int64_t top = 0;
+    for (const auto &b : busy) {
+        int64_t gap = b.first - top;
+        if (gap >= box.size && gap < best_gap) {
+            best_gap = gap;
+            best_offset = top;
+        }
+        top = std::max(top, b.second);
+    }
+    return best_offset == -1 ? top : best_offset;
+}
+
+}  // namespace
+
+int64_t MemorySolver::solve(Strategy strategy) {
     maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
+
+    if (strategy != Strategy::MinFootprint) {
+        _offsets.clear();
+        _strategy = strategy;
+        switch (strategy) {
+            case Strategy::BestFit: return solveBestFit(_offsets);
+            case Strategy::GreedyByBreadth: return solveGreedyByBreadth(_offsets);
+            default: return solveGreedyBySize(_offsets);
+        }
+    }
+
+    // The strategies are cheap comparing to the graph compilation, so all of them are tried
+    // and the first one with the smallest footprint wins
+    int64_t min_required = -1;
+    for (auto candidate : {Strategy::GreedyBySize, Strategy::BestFit, Strategy::GreedyByBreadth}) {
+        std::map<int64_t, int64_t> offsets;
+        int64_t required = candidate == Strategy::BestFit ? solveBestFit(offsets) :
+                           candidate == Strategy::GreedyByBreadth ? solveGreedyByBreadth(offsets) :
+                           solveGreedyBySize(offsets);
+        if (min_required == -1 || required < min_required) {
+            min_required = required;
+            _offsets = std::move(offsets);
+            _strategy = candidate;
+        }
+    }
+    return min_required;
+}
+
+MemorySolver::Strategy MemorySolver::getStrategy() const {
+    return _strategy;
+}
+
+int64_t MemorySolver::maxDepth() {
+    if (_depth == -1) calcDepth();
+    return _depth;
+}
+
+int64_t MemorySolver::maxTopDepth() {
+    if (_top_depth == -1) calcDepth();
+    return _top_depth;
+}
+
+int64_t MemorySolver::getOffset(int id) const {
+    auto res = _offsets.find(id);
+    if (res == _offsets.end()) IE_THROW() << "There are no box for provided ID";
+    return res->second;
+}
+
+//======== Private =============//
+
+int64_t MemorySolver::solveGreedyBySize(std::map<int64_t, int64_t>& offsets) {
+    std::vector<Box> boxes = _boxes;
     std::vector<std::vector<const Box*>> time_slots(_time_duration);
     for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
 
     // Sort be box size. First is biggest
     // Comment this line to check other order of box putting
-    std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r)
+    std::sort(boxes.begin(), boxes.end(), [](const Box& l, const Box& r)
         { return l.size > r.size; });
 
     int64_t _min_required = 0;
 
-    for (Box& box : _boxes) {
+    for (Box& box : boxes) {
         // start from bottom and will lift it up if intersect with other present
         int64_t id = box.id;
         box.id = 0;  // id will be used as a temp offset storage
@@ -91,29 +180,66 @@ int64_t MemorySolver::solve() {
 
         // store the max top bound for each box
         _min_required = std::max(_min_required, box.id + box.size);
-        _offsets[id] = box.id;  // TODO: move to constructor (use .insert instead of [])
+        offsets[id] = box.id;
     }
 
     return _min_required;
 }
 
-int64_t MemorySolver::maxDepth() {
-    if (_depth == -1) calcDepth();
-    return _depth;
-}
+int64_t MemorySolver::solveBestFit(std::map<int64_t, int64_t>& offsets) {
+    std::vector<Box> boxes = _boxes;
+    // The biggest and then the longest living boxes are placed first
+    std::stable_sort(boxes.begin(), boxes.end(), [](const Box& l, const Box& r) {
+        return l.size > r.size || (l.size == r.size && l.finish - l.start > r.finish - r.start);
+    });
 
-int64_t MemorySolver::maxTopDepth() {
-    if (_top_depth == -1) calcDepth();
-    return _top_depth;
+    std::vector<PlacedBox> placed;
+    placed.reserve(boxes.size());
+    int64_t min_required = 0;
+    for (const Box& box : boxes) {
+        int64_t offset = findBestFitOffset(box, placed);
+        placed.push_back({box.start, box.finish, offset, box.size});
+        min_required = std::max(min_required, offset + box.size);
+        offsets[box.id] = offset;
+    }
+    return min_required;
 }
 
-int64_t MemorySolver::getOffset(int id) const {
-    auto res = _offsets.find(id);
-    if (res == _offsets.end()) IE_THROW() << "There are no box for provided ID";
-    return res->second;
-}
+int64_t MemorySolver::solveGreedyByBreadth(std::map<int64_t, int64_t>& offsets) {
+    // Breadth of a time stamp is the total size of the boxes alive at it
+    std::vector<int64_t> breadth(_time_duration, 0);
+    std::vector<std::vector<size_t>> alive(_time_duration);
+    for (size_t i = 0; i < _boxes.size(); i++) {
+        for (int ts = _boxes[i].start; ts <= _boxes[i].finish; ts++) {
+            breadth[ts] += _boxes[i].size;
+            alive[ts].push_back(i);
+        }
+    }
 
-//======== Private =============//
+    std::vector<int> time_stamps(_time_duration);
+    for (int ts = 0; ts < _time_duration; ts++) time_stamps[ts] = ts;
+    std::stable_sort(time_stamps.begin(), time_stamps.end(), [&](int l, int r) { return breadth[l] > breadth[r]; });
+
+    std::vector<bool> is_placed(_boxes.size(), false);
+    std::vector<PlacedBox> placed;
+    placed.reserve(_boxes.size());
+    int64_t min_required = 0;
+    for (int ts : time_stamps) {
+        auto &boxes = alive[ts];
+        std::stable_sort(boxes.begin(), boxes.end(), [&](size_t l, size_t r) { return _boxes[l].size > _boxes[r].size; });
+        for (size_t i : boxes) {
+            if (is_placed[i])
+                continue;
+            const Box& box = _boxes[i];
+            int64_t offset = findBestFitOffset(box, placed);
+            placed.push_back({box.start, box.finish, offset, box.size});
+            is_placed[i] = true;
+            min_required = std::max(min_required, offset + box.size);
+            offsets[box.id] = offset;
+        }
+    }
+    return min_required;
+}
 
 void MemorySolver::calcDepth() {
     int64_t top_depth = 0;
@@ -65,13 +65,32 @@ public:
         int64_t id;
     };
 
+    /** @brief Heuristic used to place the boxes */
+    enum class Strategy {
+        /** The biggest boxes are placed first, a box is lifted up until it has no intersections */
+        GreedyBySize,
+        /** The biggest boxes are placed first, a box is placed to the smallest gap it fits in */
+        BestFit,
+        /**
+         * The boxes of the time stamps with the biggest total size (breadth) are placed first,
+         * a box is placed to the smallest gap it fits in
+         */
+        GreedyByBreadth,
+        /** All the strategies above are tried, the one with the smallest footprint is taken */
+        MinFootprint
+    };
+
     explicit MemorySolver(const std::vector<Box>& boxes);
 
     /**
      * @brief Solve memory location with maximal reuse.
+     * @param strategy Heuristic used to place the boxes
      * @return Size of common memory blob required for storing all
      */
-    int64_t solve();
+    int64_t solve(Strategy strategy = Strategy::GreedyBySize);
+
+    /** Strategy which provided the offsets of the last solve() call. Differs from the requested one for MinFootprint */
+    Strategy getStrategy() const;
 
     /** Provides calculated offset for specified box id */
     int64_t getOffset(int id) const;
@@ -87,8 +106,12 @@ private:
     int64_t _top_depth = -1;
     int64_t _depth = -1;
     int _time_duration = -1;
+    Strategy _strategy = Strategy::GreedyBySize;
 
     void calcDepth();
+    int64_t solveGreedyBySize(std::map<int64_t, int64_t>& offsets);
+    int64_t solveBestFit(std::map<int64_t, int64_t>& offsets);
+    int64_t solveGreedyByBreadth(std::map<int64_t, int64_t>& offsets);
 };
 
 }  // namespace MKLDNNPlugin
@@ -19,6 +19,7 @@
 #include "mkldnn/iml_type_mapper.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_primitive.h"
+#include "mkldnn_primitive_cache.hpp"
 #include "mkldnn_weights_cache.hpp"
 #include "mkldnn.hpp"
 #include <openvino/itt.hpp>
@@ -461,7 +462,7 @@ public:
             selectedPrimitiveDescriptorIndex = index;
     }
 
-    std::string getPrimitiveDescriptorType();
+    virtual std::string getPrimitiveDescriptorType();
 
     PerfCount &PerfCounter() { return perfCounter; }
 
@@ -545,6 +546,17 @@ public:
         IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
     }
 
+    /**
+     * @brief Creates the primitive of the descriptor or takes the equal one from the process wide primitive cache,
+     * so the kernels are not generated again by the graphs of the other streams and networks
+     */
+    template <class P, class PD>
+    void createCachedPrimitive(const PD &pd, const mkldnn::primitive_attr &attr = mkldnn::primitive_attr()) {
+        prim = MKLDNNPrimitiveCache::getInstance().getOrCreate(MKLDNNPrimitiveCache::makeKey(pd, attr), [&pd]() {
+            return std::make_shared<P>(pd);
+        });
+    }
+
     int getExecIndex() const {
         return execIndex;
     }
@@ -6,11 +6,13 @@
 #include "mkldnn_plugin.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
+#include "mkldnn_primitive_cache.hpp"
 #include "mkldnn_itt.h"
 
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
 #include <ie_plugin_config.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <vector>
 #include <tuple>
 #include <unordered_set>
@@ -73,6 +75,7 @@
 #include <ngraph/opsets/opset6.hpp>
 #include <ngraph/op/util/op_types.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pass/constant_deduplication.hpp>
 #include <ngraph/graph_util.hpp>
 
 #include <transformations/common_optimizations/lin_op_sequence_fusion.hpp>
@@ -93,6 +96,8 @@
 #include "nodes/mkldnn_fake_quantize_node.h"
 #include "nodes/mkldnn_normalize_node.h"
 #include "ngraph_transformations/convert_to_cpu_specific_opset.hpp"
+#include "ngraph_transformations/keep_embedding_table_dequantization.hpp"
+#include "ngraph_transformations/keep_weights_decompression.hpp"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
 # ifdef _WIN32
@@ -122,6 +127,7 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
 
     ngraph::pass::Manager manager;
     manager.register_pass<ngraph::pass::InitNodeInfo>();
+    manager.register_pass<KeepEmbeddingTableDequantization>();
 
     const bool useLpt =
         (conf.lpTransformsMode == Config::LPTransformsMode::On) &&
@@ -129,6 +135,8 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     if (useLpt) {
         manager.register_pass<ngraph::pass::DisableConvertConstantFoldingOnConstPath>(
             std::vector<ngraph::element::Type>{ ngraph::element::i8, ngraph::element::u8, ngraph::element::i4, ngraph::element::u4 });
+    } else if (conf.weightsDecompression) {
+        manager.register_pass<KeepWeightsDecompression>();
     }
 
     auto get_convert_precisions = []() {
@@ -174,6 +182,7 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     manager.register_pass<ngraph::pass::ConvertMatrixNmsToMatrixNmsIE>();
     manager.register_pass<ngraph::pass::TransposeMatMul>();
     manager.register_pass<ngraph::pass::ConstantFolding>();
+    manager.register_pass<ngraph::pass::ConstantDeduplication>();
 
     if (useLpt) {
         manager.register_pass<ngraph::pass::low_precision::ConvertSubtractConstant>(
@@ -434,16 +443,31 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
+    if (conf.dynamicInputShapes && conf.enableDynamicBatch)
+        IE_THROW() << "The dynamic input shapes can't be used together with the dynamic batch";
+
+    // the cache is process wide, so the capacity passed with the network is applied to all the networks
+    if (config.count(PluginConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY))
+        MKLDNNPrimitiveCache::getInstance().setCapacity(conf.primitiveCacheCapacity);
+
     CNNNetwork clonedNetwork = InferenceEngine::details::cloneNetwork(network);
 
     Transformation(clonedNetwork, conf);
 
-    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+    if (!conf.dynamicInputShapes)
+        return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing, activationArenas);
+
+    // the shape subgraphs of the original network are folded again when the network is inferred with the other input shapes
+    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing, activationArenas,
+                                               InferenceEngine::details::cloneNetwork(network),
+                                               [conf](CNNNetwork &shapeNetwork) { Transformation(shapeNetwork, conf); });
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
     // accumulate config parameters on engine level
     engConfig.readProperties(config);
+    if (config.count(PluginConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY))
+        MKLDNNPrimitiveCache::getInstance().setCapacity(engConfig.primitiveCacheCapacity);
 }
 
 Parameter Engine::GetConfig(const std::string& name, const std::map<std::string, Parameter>& /*options*/) const {
@@ -481,6 +505,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(CPU_ACTIVATION_ARENAS_MEMORY));
+        metrics.push_back(METRIC_KEY(CPU_PRIMITIVE_CACHE));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -527,6 +553,15 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(CPU_ACTIVATION_ARENAS_MEMORY)) {
+        auto usage = activationArenas.memoryUsage();
+        std::tuple<unsigned long long, unsigned long long> memory = std::make_tuple(usage.first, usage.second);
+        IE_SET_METRIC_RETURN(CPU_ACTIVATION_ARENAS_MEMORY, memory);
+    } else if (name == METRIC_KEY(CPU_PRIMITIVE_CACHE)) {
+        auto statistics = MKLDNNPrimitiveCache::getInstance().getStatistics();
+        std::tuple<unsigned long long, unsigned long long, unsigned long long, unsigned long long> cache =
+            std::make_tuple(statistics.hits, statistics.misses, statistics.size, statistics.capacity);
+        IE_SET_METRIC_RETURN(CPU_PRIMITIVE_CACHE, cache);
     } else {
         IE_THROW() << "Unsupported metric key " << name;
     }
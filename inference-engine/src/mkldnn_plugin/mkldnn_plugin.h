@@ -39,6 +39,7 @@ public:
 private:
     Config engConfig;
     NumaNodesWeights weightsSharing;
+    StreamsActivationArenas activationArenas;
     MKLDNNExtensionManager::Ptr extensionManager = std::make_shared<MKLDNNExtensionManager>();
 };
 
@@ -0,0 +1,209 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_primitive_cache.hpp"
+
+#include <vector>
+#include <ie_parallel.hpp>
+#include <common/primitive_attr.hpp>
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+template <typename T>
+void append(MKLDNNPrimitiveCache::Key &key, const T &value) {
+    key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void append(MKLDNNPrimitiveCache::Key &key, const void *data, size_t size) {
+    key.append(static_cast<const char*>(data), size);
+}
+
+// the size of the operation descriptor or 0 if the kind is described by the memory descriptors only
+bool getOpDescSize(mkldnn_primitive_kind_t kind, size_t &size) {
+    switch (kind) {
+        case mkldnn_convolution:
+        case mkldnn_deconvolution:
+            size = sizeof(mkldnn_convolution_desc_t);
+            return true;
+        case mkldnn_pooling:
+            size = sizeof(mkldnn_pooling_desc_t);
+            return true;
+        case mkldnn_inner_product:
+            size = sizeof(mkldnn_inner_product_desc_t);
+            return true;
+        case mkldnn_softmax:
+            size = sizeof(mkldnn_softmax_desc_t);
+            return true;
+        case mkldnn_lrn:
+            size = sizeof(mkldnn_lrn_desc_t);
+            return true;
+        case mkldnn_rnn:
+            size = sizeof(mkldnn_rnn_desc_t);
+            return true;
+        case mkldnn_reorder:
+        case mkldnn_concat:
+            size = 0;
+            return true;
+        default:
+            return false;
+    }
+}
+
+void appendMemoryDescs(MKLDNNPrimitiveCache::Key &key, const mkldnn::primitive_desc_base &pd, mkldnn_query_t what, int count) {
+    for (int i = 0; i < count; i++) {
+        const mkldnn_memory_desc_t *md = mkldnn_primitive_desc_query_md(pd.get(), what, i);
+        if (md == nullptr)
+            continue;
+        append(key, what);
+        append(key, i);
+        append(key, *md);
+    }
+}
+
+// the post operations carrying the data are bound to the memory of the fused node, so the pointers are the part of the key
+bool appendPostOps(MKLDNNPrimitiveCache::Key &key, const mkldnn::primitive_attr &attr) {
+    const auto &postOps = (*attr.get()).post_ops_;
+    append(key, postOps.len());
+    for (int i = 0; i < postOps.len(); i++) {
+        const auto &postOp = postOps.entry_[i];
+        if (postOp.is_eltwise()) {
+            append(key, 'e');
+            append(key, postOp.eltwise.alg);
+            append(key, postOp.eltwise.scale);
+            append(key, postOp.eltwise.alpha);
+            append(key, postOp.eltwise.beta);
+        } else if (postOp.is_sum(false)) {
+            append(key, 's');
+            append(key, postOp.sum.scale);
+        } else if (postOp.is_depthwise()) {
+            append(key, 'd');
+            append(key, postOp.depthwise.alg);
+            append(key, postOp.depthwise.weights_data);
+            append(key, postOp.depthwise.biases_data);
+        } else if (postOp.is_quantization()) {
+            append(key, 'q');
+            append(key, postOp.quantization.alg);
+            append(key, postOp.quantization.crop_low_data);
+            append(key, postOp.quantization.crop_high_data);
+            append(key, postOp.quantization.input_scale_data);
+            append(key, postOp.quantization.input_shift_data);
+            append(key, postOp.quantization.output_scale_data);
+            append(key, postOp.quantization.output_shift_data);
+        } else {
+            // e.g. the fused depthwise convolution
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+constexpr size_t MKLDNNPrimitiveCache::defaultCapacity;
+
+MKLDNNPrimitiveCache::MKLDNNPrimitiveCache(size_t capacity) : capacity(capacity) {}
+
+MKLDNNPrimitiveCache& MKLDNNPrimitiveCache::getInstance() {
+    static MKLDNNPrimitiveCache cache;
+    return cache;
+}
+
+MKLDNNPrimitiveCache::Key MKLDNNPrimitiveCache::makeKey(const mkldnn::primitive_desc_base &pd, const mkldnn::primitive_attr &attr) {
+    Key key;
+
+    mkldnn_primitive_kind_t kind;
+    size_t opDescSize = 0;
+    if (mkldnn_primitive_desc_query(pd.get(), mkldnn_query_primitive_kind, 0, &kind) != mkldnn_success ||
+        !getOpDescSize(kind, opDescSize))
+        return {};
+    append(key, kind);
+
+    if (opDescSize != 0) {
+        const_mkldnn_op_desc_t opDesc = nullptr;
+        if (mkldnn_primitive_desc_query(pd.get(), mkldnn_query_op_d, 0, &opDesc) != mkldnn_success || opDesc == nullptr)
+            return {};
+        append(key, opDesc, opDescSize);
+    }
+
+    // the memory descriptors chosen by the implementation
+    const int inputs = mkldnn_primitive_desc_query_s32(pd.get(), mkldnn_query_num_of_inputs_s32, 0);
+    const int outputs = mkldnn_primitive_desc_query_s32(pd.get(), mkldnn_query_num_of_outputs_s32, 0);
+    appendMemoryDescs(key, pd, mkldnn_query_src_md, inputs);
+    appendMemoryDescs(key, pd, mkldnn_query_weights_md, inputs);
+    appendMemoryDescs(key, pd, mkldnn_query_dst_md, outputs);
+
+    const std::string implementation = pd.impl_info_str();
+    append(key, implementation.size());
+    key.append(implementation);
+
+    // the work is split between the threads when the primitive is created
+    append(key, parallel_get_max_threads());
+
+    int scalesMask = 0;
+    std::vector<float> scales;
+    attr.get_output_scales(scalesMask, scales);
+    append(key, scalesMask);
+    append(key, scales.size());
+    append(key, scales.data(), scales.size() * sizeof(float));
+
+    if (!appendPostOps(key, attr))
+        return {};
+
+    return key;
+}
+
+std::shared_ptr<mkldnn::primitive> MKLDNNPrimitiveCache::getOrCreate(const Key &key, const Creator &create) {
+    if (key.empty())
+        return create();
+
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto found = index.find(key);
+        if (found != index.end()) {
+            hits++;
+            entries.splice(entries.begin(), entries, found->second);
+            return found->second->second;
+        }
+        misses++;
+    }
+
+    // the kernels are generated out of the lock, so the streams create the different primitives in parallel
+    auto primitive = create();
+
+    std::lock_guard<std::mutex> lock(guard);
+    if (capacity == 0)
+        return primitive;
+    auto found = index.find(key);
+    if (found != index.end()) {
+        // the primitive was created by the other thread meanwhile
+        entries.splice(entries.begin(), entries, found->second);
+        return found->second->second;
+    }
+    entries.emplace_front(key, primitive);
+    index[key] = entries.begin();
+    evict();
+    return primitive;
+}
+
+void MKLDNNPrimitiveCache::setCapacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(guard);
+    this->capacity = capacity;
+    evict();
+}
+
+MKLDNNPrimitiveCache::Statistics MKLDNNPrimitiveCache::getStatistics() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return {hits, misses, entries.size(), capacity};
+}
+
+void MKLDNNPrimitiveCache::evict() {
+    while (entries.size() > capacity) {
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+}
+
+}  // namespace MKLDNNPlugin
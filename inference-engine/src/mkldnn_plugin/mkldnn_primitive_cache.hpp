@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mkldnn.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Process wide LRU cache of the compiled primitives. The nodes of all the graphs (the streams and the loaded
+ * networks) share the primitives of the equal descriptors, so the kernels of a primitive are generated once.
+ *
+ * The primitives are executed concurrently by the different streams, it relies on the concurrent execution support
+ * of the library (the scratchpad of a primitive is not shared between the threads).
+ *
+ * Is a thread safe
+ */
+class MKLDNNPrimitiveCache {
+public:
+    using Key = std::string;
+    using Creator = std::function<std::shared_ptr<mkldnn::primitive>()>;
+
+    struct Statistics {
+        size_t hits;
+        size_t misses;
+        size_t size;
+        size_t capacity;
+    };
+
+    static constexpr size_t defaultCapacity = 1024;
+
+    explicit MKLDNNPrimitiveCache(size_t capacity = defaultCapacity);
+
+    /**
+     * @return the cache shared by all the graphs of the process
+     */
+    static MKLDNNPrimitiveCache& getInstance();
+
+    /**
+     * Builds the key of the primitive: the primitive kind and its operation descriptor (shapes, layouts and precisions
+     * of the memory, the parameters of the operation), the implementation, the number of threads and the attributes
+     * with the post operations
+     * @return the empty key if the descriptor or the attributes can't be compared, i.e. the primitive is not cacheable
+     */
+    static Key makeKey(const mkldnn::primitive_desc_base &pd, const mkldnn::primitive_attr &attr = mkldnn::primitive_attr());
+
+    /**
+     * Finds the primitive of the key or creates it and puts it to the cache. The least recently used primitive is
+     * evicted when the cache exceeds the capacity. The primitive of the empty key is created without the cache.
+     * The evicted primitive is alive while the nodes use it
+     */
+    std::shared_ptr<mkldnn::primitive> getOrCreate(const Key &key, const Creator &create);
+
+    /**
+     * Sets the maximum number of the cached primitives, 0 disables the cache
+     */
+    void setCapacity(size_t capacity);
+
+    Statistics getStatistics() const;
+
+private:
+    using Entries = std::list<std::pair<Key, std::shared_ptr<mkldnn::primitive>>>;
+
+    void evict();
+
+    mutable std::mutex guard;
+    size_t capacity;
+    Entries entries;
+    std::unordered_map<Key, Entries::iterator> index;
+    size_t hits = 0;
+    size_t misses = 0;
+};
+
+}  // namespace MKLDNNPlugin
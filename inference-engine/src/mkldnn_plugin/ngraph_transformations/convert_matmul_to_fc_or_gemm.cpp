@@ -4,6 +4,7 @@
 
 #include "convert_matmul_to_fc_or_gemm.hpp"
 #include "op/fully_connected.hpp"
+#include "keep_weights_decompression.hpp"
 #include <numeric>
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/rt_info.hpp>
@@ -99,11 +100,12 @@ MKLDNNPlugin::ConvertMatMulToFC::ConvertMatMulToFC() {
         // vector of new nGraph operations
         ngraph::NodeVector new_ops;
 
-        // Check that if second inputs is Constant operation and it's shape without ones dimensions has length <= 2
-        // we replace MatMul with FullyConnected operation.
+        // Check that if second inputs is Constant operation (or the decompression of the constant weights)
+        // and it's shape without ones dimensions has length <= 2 we replace MatMul with FullyConnected operation.
         // Otherwise we replace MatMul with Gemm.
         if ((std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) ||
-             std::dynamic_pointer_cast<ngraph::opset1::FakeQuantize>(fc_input_b.get_node_shared_ptr())) &&
+             std::dynamic_pointer_cast<ngraph::opset1::FakeQuantize>(fc_input_b.get_node_shared_ptr()) ||
+             isDecompressedWeights(fc_input_b)) &&
              std::count_if(shape_b.begin(), shape_b.end(), [](size_t x) { return x != 1; }) <= 2) {
             ngraph::Shape shape_a_aligned, shape_b_aligned;
             std::tie(shape_a_aligned, shape_b_aligned) = get_aligned_shapes();
@@ -0,0 +1,55 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "keep_embedding_table_dequantization.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::KeepEmbeddingTableDequantization, "KeepEmbeddingTableDequantization", 0);
+
+MKLDNNPlugin::KeepEmbeddingTableDequantization::KeepEmbeddingTableDequantization() {
+    auto table = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(ngraph::pattern::type_matches_any({ngraph::element::i8, ngraph::element::u8}));
+    auto convert = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({table}, ngraph::pattern::consumers_count(1));
+    auto zeroPoint = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto subtract = ngraph::pattern::wrap_type<ngraph::opset1::Subtract>({convert, zeroPoint}, ngraph::pattern::consumers_count(1));
+    auto convertOrSubtract = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{convert, subtract});
+    auto scale = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto multiply = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({convertOrSubtract, scale}, ngraph::pattern::consumers_count(1));
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& patternMap = m.get_pattern_value_map();
+        const auto multiplyNode = patternMap.at(multiply).get_node_shared_ptr();
+        const auto tableShape = patternMap.at(table).get_shape();
+        if (tableShape.size() < 2)
+            return false;
+
+        auto consumer = multiplyNode->output(0).get_target_inputs().begin();
+        if (consumer->get_index() != 0 ||
+            !(ngraph::is_type<ngraph::opset3::EmbeddingBagOffsetsSum>(consumer->get_node()) ||
+              ngraph::is_type<ngraph::opset3::EmbeddingBagPackedSum>(consumer->get_node()) ||
+              ngraph::is_type<ngraph::opset3::EmbeddingSegmentsSum>(consumer->get_node())))
+            return false;
+
+        // the node applies a scale and a shift per row (or per tensor)
+        auto isPerRow = [&](const ngraph::Shape& shape) {
+            if (ngraph::shape_size(shape) == 1)
+                return true;
+            return shape.size() == tableShape.size() && shape[0] == tableShape[0] && ngraph::shape_size(shape) == shape[0];
+        };
+        if (!isPerRow(patternMap.at(scale).get_shape()))
+            return false;
+        if (patternMap.count(zeroPoint) && !isPerRow(patternMap.at(zeroPoint).get_shape()))
+            return false;
+
+        ngraph::disable_constant_folding(patternMap.at(convert).get_node_shared_ptr());
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(multiply, "KeepEmbeddingTableDequantization");
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,32 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Disables the constant folding of the dequantization of the quantized embedding tables:
+ *
+ *   Constant (i8/u8)
+ *       |
+ *    Convert   Constant
+ *         \    /
+ *        Subtract   Constant         (optional)
+ *            \     /
+ *            Multiply
+ *               |
+ *       EmbeddingBag*Sum / EmbeddingSegmentsSum (table input)
+ *
+ * So the table stays quantized and the dequantization is fused into the embedding node
+ */
+class KeepEmbeddingTableDequantization: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    KeepEmbeddingTableDequantization();
+};
+
+}  // namespace MKLDNNPlugin
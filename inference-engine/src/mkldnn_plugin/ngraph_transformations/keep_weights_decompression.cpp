@@ -0,0 +1,84 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "keep_weights_decompression.hpp"
+
+#include <algorithm>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::KeepWeightsDecompression, "KeepWeightsDecompression", 0);
+
+namespace {
+
+const std::vector<ngraph::element::Type> compressedPrecisions = {
+    ngraph::element::i8, ngraph::element::u8, ngraph::element::i4, ngraph::element::u4
+};
+
+}  // namespace
+
+MKLDNNPlugin::KeepWeightsDecompression::KeepWeightsDecompression() {
+    auto weights = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(ngraph::pattern::type_matches_any(compressedPrecisions));
+    auto convert = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({weights}, ngraph::pattern::consumers_count(1));
+    auto zeroPoint = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto subtract = ngraph::pattern::wrap_type<ngraph::opset1::Subtract>({convert, zeroPoint}, ngraph::pattern::consumers_count(1));
+    auto convertOrSubtract = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{convert, subtract});
+    auto scale = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto multiply = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({convertOrSubtract, scale}, ngraph::pattern::consumers_count(1));
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& patternMap = m.get_pattern_value_map();
+        const auto multiplyNode = patternMap.at(multiply).get_node_shared_ptr();
+        if (multiplyNode->get_output_element_type(0) != ngraph::element::f32)
+            return false;
+
+        auto is2D = [](const ngraph::PartialShape& shape) {
+            return shape.rank().is_static() && shape.rank().get_length() == 2;
+        };
+
+        // the grouped weights are reshaped to 2D
+        auto consumer = *multiplyNode->output(0).get_target_inputs().begin();
+        if (ngraph::is_type<ngraph::opset1::Reshape>(consumer.get_node())) {
+            const auto& reshapeOutput = consumer.get_node()->output(0);
+            if (reshapeOutput.get_target_inputs().size() != 1 || !is2D(reshapeOutput.get_partial_shape()))
+                return false;
+            consumer = *reshapeOutput.get_target_inputs().begin();
+        }
+
+        if (consumer.get_index() != 1 || !ngraph::is_type<ngraph::opset1::MatMul>(consumer.get_node()) ||
+            !is2D(consumer.get_partial_shape()))
+            return false;
+
+        ngraph::disable_constant_folding(patternMap.at(convert).get_node_shared_ptr());
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(multiply, "KeepWeightsDecompression");
+    this->register_matcher(m, callback);
+}
+
+bool MKLDNNPlugin::isDecompressedWeights(const ngraph::Output<ngraph::Node>& output) {
+    auto node = output.get_node_shared_ptr();
+    if (ngraph::is_type<ngraph::opset1::Reshape>(node))
+        node = node->get_input_node_shared_ptr(0);
+
+    auto isConstantInput = [](const std::shared_ptr<ngraph::Node>& node, size_t port) {
+        return ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_ptr(port));
+    };
+
+    if (!ngraph::is_type<ngraph::opset1::Multiply>(node) || !isConstantInput(node, 1))
+        return false;
+    node = node->get_input_node_shared_ptr(0);
+
+    // the zero point may be converted to the addition of the negative one
+    if ((ngraph::is_type<ngraph::opset1::Subtract>(node) || ngraph::is_type<ngraph::opset1::Add>(node)) && isConstantInput(node, 1))
+        node = node->get_input_node_shared_ptr(0);
+
+    if (!ngraph::is_type<ngraph::opset1::Convert>(node) || !isConstantInput(node, 0))
+        return false;
+    const auto precision = node->get_input_element_type(0);
+    return std::find(compressedPrecisions.begin(), compressedPrecisions.end(), precision) != compressedPrecisions.end();
+}
@@ -0,0 +1,39 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Disables the constant folding of the decompression of the compressed MatMul weights:
+ *
+ *   Constant (i8/u8/i4/u4)
+ *       |
+ *    Convert   Constant
+ *         \    /
+ *        Subtract   Constant         (optional)
+ *            \     /
+ *            Multiply
+ *               |
+ *            Reshape                 (optional)
+ *               |
+ *      MatMul (second input)
+ *
+ * So the weights stay compressed and the decompression is fused into the FullyConnected node
+ */
+class KeepWeightsDecompression: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    KeepWeightsDecompression();
+};
+
+/*
+ * Returns true if the output is the decompression of the constant weights kept by KeepWeightsDecompression
+ */
+bool isDecompressedWeights(const ngraph::Output<ngraph::Node>& output);
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,350 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compressed_weights_gemm.h"
+
+#include <algorithm>
+#include <vector>
+#include <mkldnn_types.h>
+#include <ie_parallel.hpp>
+#include "utils/general_utils.h"
+
+#include "cpu/x64/jit_generator.hpp"
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+using namespace mkldnn;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_compressed_gemm_call_args, field)
+
+/**
+ * Computes a block of the output channels for several rows of the source. For every group of the input channels
+ * the packed weights are loaded, decompressed to FP32 in the registers and accumulated with the broadcasted source
+ * values, then the group sums are scaled (and shifted by the scaled sums of the source) to the output accumulators
+ */
+template <cpu_isa_t isa>
+struct jit_uni_compressed_gemm_kernel_f32 : public jit_uni_compressed_gemm_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_compressed_gemm_kernel_f32)
+
+    explicit jit_uni_compressed_gemm_kernel_f32(jit_compressed_gemm_config_params jcp)
+        : jit_uni_compressed_gemm_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_scales, ptr[reg_params + GET_OFF(scales)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        if (jcp_.with_shifts) {
+            mov(reg_shifts, ptr[reg_params + GET_OFF(shifts)]);
+            mov(reg_src_sums, ptr[reg_params + GET_OFF(src_sums)]);
+        }
+
+        for (size_t r = 0; r < jcp_.rows; r++)
+            uni_vpxor(vmm_dst(r), vmm_dst(r), vmm_dst(r));
+
+        Xbyak::Label group_loop_label;
+        Xbyak::Label k_loop_label;
+
+        mov(reg_group, jcp_.groups);
+        L(group_loop_label);
+        {
+            for (size_t r = 0; r < jcp_.rows; r++)
+                uni_vpxor(vmm_acc(r), vmm_acc(r), vmm_acc(r));
+
+            mov(reg_k, jcp_.bits == 4 ? jcp_.group_size / 2 : jcp_.group_size);
+            L(k_loop_label);
+            {
+                if (jcp_.bits == 4) {
+                    load_4bit_weights();
+                    accumulate(vmm_weights, 0);
+                    accumulate(vmm_weights_high, sizeof(float));
+                    add(reg_src, 2 * sizeof(float));
+                } else {
+                    load_8bit_weights();
+                    accumulate(vmm_weights, 0);
+                    add(reg_src, sizeof(float));
+                }
+                add(reg_weights, step);
+
+                sub(reg_k, 1);
+                jnz(k_loop_label, T_NEAR);
+            }
+
+            uni_vmovups(vmm_scale, ptr[reg_scales]);
+            for (size_t r = 0; r < jcp_.rows; r++)
+                uni_vfmadd231ps(vmm_dst(r), vmm_acc(r), vmm_scale);
+            add(reg_scales, step * sizeof(float));
+
+            if (jcp_.with_shifts) {
+                // sum(src * (w * scale + shift)) = sum(src * w) * scale + sum(src) * shift
+                uni_vmovups(vmm_shift, ptr[reg_shifts]);
+                for (size_t r = 0; r < jcp_.rows; r++) {
+                    uni_vbroadcastss(vmm_src, ptr[reg_src_sums + r * jcp_.groups * sizeof(float)]);
+                    uni_vfmadd231ps(vmm_dst(r), vmm_src, vmm_shift);
+                }
+                add(reg_shifts, step * sizeof(float));
+                add(reg_src_sums, sizeof(float));
+            }
+
+            sub(reg_group, 1);
+            jnz(group_loop_label, T_NEAR);
+        }
+
+        for (size_t r = 0; r < jcp_.rows; r++)
+            uni_vmovups(ptr[reg_dst + r * step * sizeof(float)], vmm_dst(r));
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int step = vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_weights = r9;
+    Xbyak::Reg64 reg_scales = r10;
+    Xbyak::Reg64 reg_shifts = r11;
+    Xbyak::Reg64 reg_src_sums = r12;
+    Xbyak::Reg64 reg_dst = r13;
+    Xbyak::Reg64 reg_k = r14;
+    Xbyak::Reg64 reg_group = r15;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    // 0 .. rows - 1 are the output accumulators, rows .. 2 * rows - 1 are the accumulators of the group
+    Vmm vmm_dst(size_t r) const { return Vmm(r); }
+    Vmm vmm_acc(size_t r) const { return Vmm(jcp_.rows + r); }
+
+    Vmm vmm_weights = Vmm(8);
+    Vmm vmm_weights_high = Vmm(9);
+    Vmm vmm_src = Vmm(10);
+    Vmm vmm_scale = Vmm(11);
+    Vmm vmm_shift = Vmm(12);
+
+    inline void load_8bit_weights() {
+        if (jcp_.wei_prc == Precision::I8)
+            uni_vpmovsxbd(vmm_weights, ptr[reg_weights]);
+        else
+            uni_vpmovzxbd(vmm_weights, ptr[reg_weights]);
+        uni_vcvtdq2ps(vmm_weights, vmm_weights);
+    }
+
+    // A byte keeps the weights of two neighbouring input channels: the low half for the even one
+    inline void load_4bit_weights() {
+        uni_vpmovzxbd(vmm_weights, ptr[reg_weights]);
+        uni_vmovups(vmm_weights_high, vmm_weights);
+        if (jcp_.wei_prc == Precision::I8) {
+            // the sign bit of the half is moved to the sign bit of the dword to get it extended
+            uni_vpslld(vmm_weights_high, vmm_weights_high, 24);
+            shift_right_arithmetic(vmm_weights_high, 28);
+            uni_vpslld(vmm_weights, vmm_weights, 28);
+            shift_right_arithmetic(vmm_weights, 28);
+        } else {
+            uni_vpsrld(vmm_weights_high, vmm_weights_high, 4);
+            uni_vpslld(vmm_weights, vmm_weights, 28);
+            uni_vpsrld(vmm_weights, vmm_weights, 28);
+        }
+        uni_vcvtdq2ps(vmm_weights, vmm_weights);
+        uni_vcvtdq2ps(vmm_weights_high, vmm_weights_high);
+    }
+
+    inline void shift_right_arithmetic(const Vmm& vmm, int imm) {
+        if (isa == cpu::x64::sse41)
+            psrad(vmm, imm);
+        else
+            vpsrad(vmm, vmm, imm);
+    }
+
+    inline void accumulate(const Vmm& vmm_wei, size_t src_offset) {
+        for (size_t r = 0; r < jcp_.rows; r++) {
+            uni_vbroadcastss(vmm_src, ptr[reg_src + r * jcp_.K * sizeof(float) + src_offset]);
+            uni_vfmadd231ps(vmm_acc(r), vmm_src, vmm_wei);
+        }
+    }
+};
+
+CompressedWeightsGemm::CompressedWeightsGemm(const CompressedWeightsParams& params, const uint8_t* weights) : params(params) {
+    if (!one_of(params.precision, Precision::I8, Precision::U8))
+        IE_THROW() << "CompressedWeightsGemm does not support weights precision: " << params.precision;
+    if (params.groups == 0 || params.K % params.groups != 0)
+        IE_THROW() << "CompressedWeightsGemm got " << params.groups << " groups for " << params.K << " input channels";
+    if (params.scales.size() != params.N * params.groups ||
+        (!params.shifts.empty() && params.shifts.size() != params.N * params.groups))
+        IE_THROW() << "CompressedWeightsGemm got dequantization parameters of unexpected size";
+
+    groupSize = params.K / params.groups;
+
+    // the pairs of the input channels are packed to a byte, so they must not cross the groups
+    const int minValue = params.precision == Precision::I8 ? -8 : 0;
+    const int maxValue = params.precision == Precision::I8 ? 7 : 15;
+    bool fits4Bits = groupSize % 2 == 0;
+    for (size_t n = 0; n < params.N && fits4Bits; n++) {
+        for (size_t k = 0; k < params.K && fits4Bits; k++) {
+            const int value = getWeight(weights, n, k);
+            fits4Bits = value >= minValue && value <= maxValue;
+        }
+    }
+    bits = fits4Bits ? 4 : 8;
+
+    jit_compressed_gemm_config_params jcp = {params.precision, bits, 0, params.K, groupSize, params.groups, !params.shifts.empty()};
+    for (size_t rows = 1; rows <= maxRows; rows++) {
+        jcp.rows = rows;
+        std::shared_ptr<jit_uni_compressed_gemm_kernel> kernel;
+        if (mayiuse(cpu::x64::avx512_common)) {
+            kernel.reset(new jit_uni_compressed_gemm_kernel_f32<cpu::x64::avx512_common>(jcp));
+            blockSize = cpu_isa_traits<cpu::x64::avx512_common>::vlen / sizeof(float);
+        } else if (mayiuse(cpu::x64::avx2)) {
+            kernel.reset(new jit_uni_compressed_gemm_kernel_f32<cpu::x64::avx2>(jcp));
+            blockSize = cpu_isa_traits<cpu::x64::avx2>::vlen / sizeof(float);
+        } else if (mayiuse(cpu::x64::sse41)) {
+            kernel.reset(new jit_uni_compressed_gemm_kernel_f32<cpu::x64::sse41>(jcp));
+            blockSize = cpu_isa_traits<cpu::x64::sse41>::vlen / sizeof(float);
+        }
+        if (!kernel)
+            break;
+        kernel->create_ker();
+        kernels.push_back(kernel);
+    }
+
+    blocksNum = div_up(params.N, blockSize);
+    kSteps = bits == 4 ? params.K / 2 : params.K;
+
+    auto packParams = [&](const std::vector<float>& values, std::vector<float>& packed) {
+        if (values.empty())
+            return;
+        packed.assign(blocksNum * params.groups * blockSize, 0.f);
+        for (size_t n = 0; n < params.N; n++) {
+            for (size_t g = 0; g < params.groups; g++)
+                packed[((n / blockSize) * params.groups + g) * blockSize + n % blockSize] = values[n * params.groups + g];
+        }
+    };
+    packParams(params.scales, packedScales);
+    packParams(params.shifts, packedShifts);
+}
+
+int CompressedWeightsGemm::getWeight(const uint8_t* weights, size_t n, size_t k) const {
+    const size_t idx = params.transposed ? k * params.N + n : n * params.K + k;
+    return params.precision == Precision::I8 ? static_cast<int>(reinterpret_cast<const int8_t*>(weights)[idx])
+                                             : static_cast<int>(weights[idx]);
+}
+
+size_t CompressedWeightsGemm::getPackedWeightsSize() const {
+    return blocksNum * kSteps * blockSize;
+}
+
+void CompressedWeightsGemm::packWeights(const uint8_t* weights, uint8_t* packedWeights) const {
+    const size_t N = params.N;
+    std::fill(packedWeights, packedWeights + getPackedWeightsSize(), 0);
+    parallel_for(blocksNum, [&](size_t b) {
+        uint8_t* blockWeights = packedWeights + b * kSteps * blockSize;
+        for (size_t j = 0; j < blockSize && b * blockSize + j < N; j++) {
+            const size_t n = b * blockSize + j;
+            for (size_t s = 0; s < kSteps; s++) {
+                if (bits == 4) {
+                    const int low = getWeight(weights, n, 2 * s);
+                    const int high = getWeight(weights, n, 2 * s + 1);
+                    blockWeights[s * blockSize + j] = static_cast<uint8_t>((low & 0xF) | ((high & 0xF) << 4));
+                } else {
+                    blockWeights[s * blockSize + j] = static_cast<uint8_t>(getWeight(weights, n, s));
+                }
+            }
+        }
+    });
+}
+
+void CompressedWeightsGemm::referenceExecute(const uint8_t* blockWeights, const float* src, float* blockDst, const float* sums,
+                                             size_t block, size_t rows) const {
+    const size_t K = params.K, G = params.groups;
+    const float* blockScales = packedScales.data() + block * G * blockSize;
+    const float* blockShifts = packedShifts.empty() ? nullptr : packedShifts.data() + block * G * blockSize;
+
+    auto weight = [&](size_t k, size_t j) -> float {
+        if (bits == 8) {
+            const uint8_t value = blockWeights[k * blockSize + j];
+            return params.precision == Precision::I8 ? static_cast<float>(static_cast<int8_t>(value)) : static_cast<float>(value);
+        }
+        const uint8_t value = blockWeights[(k / 2) * blockSize + j];
+        int half = k % 2 ? value >> 4 : value & 0xF;
+        if (params.precision == Precision::I8 && half >= 8)
+            half -= 16;
+        return static_cast<float>(half);
+    };
+
+    for (size_t r = 0; r < rows; r++) {
+        for (size_t j = 0; j < blockSize; j++) {
+            float acc = 0.f;
+            for (size_t g = 0; g < G; g++) {
+                float groupAcc = 0.f;
+                for (size_t k = g * groupSize; k < (g + 1) * groupSize; k++)
+                    groupAcc += src[r * K + k] * weight(k, j);
+                acc += groupAcc * blockScales[g * blockSize + j];
+                if (blockShifts)
+                    acc += sums[r * G + g] * blockShifts[g * blockSize + j];
+            }
+            blockDst[r * blockSize + j] = acc;
+        }
+    }
+}
+
+void CompressedWeightsGemm::execute(const uint8_t* packedWeights, const float* src, float* dst, const float* bias, size_t M) const {
+    const size_t N = params.N, K = params.K, G = params.groups;
+
+    // the sums of the source per group are shared by all the output channels
+    std::vector<float> sums;
+    if (!packedShifts.empty()) {
+        sums.resize(M * G);
+        parallel_for(M, [&](size_t m) {
+            for (size_t g = 0; g < G; g++) {
+                float sum = 0.f;
+                for (size_t k = g * groupSize; k < (g + 1) * groupSize; k++)
+                    sum += src[m * K + k];
+                sums[m * G + g] = sum;
+            }
+        });
+    }
+
+    // the chunks of the rows are the inner dimension, so a thread reuses the block of the weights from the cache
+    const size_t chunksNum = div_up(M, maxRows);
+    parallel_for2d(blocksNum, chunksNum, [&](size_t b, size_t c) {
+        const size_t rows = std::min(maxRows, M - c * maxRows);
+        const uint8_t* blockWeights = packedWeights + b * kSteps * blockSize;
+        const float* chunkSrc = src + c * maxRows * K;
+        const float* chunkSums = sums.empty() ? nullptr : sums.data() + c * maxRows * G;
+
+        float blockDst[maxRows * maxBlockSize];
+        if (kernels.empty()) {
+            referenceExecute(blockWeights, chunkSrc, blockDst, chunkSums, b, rows);
+        } else {
+            jit_compressed_gemm_call_args args;
+            args.src = chunkSrc;
+            args.weights = blockWeights;
+            args.scales = packedScales.data() + b * G * blockSize;
+            args.shifts = packedShifts.empty() ? nullptr : packedShifts.data() + b * G * blockSize;
+            args.src_sums = chunkSums;
+            args.dst = blockDst;
+            (*kernels[rows - 1])(&args);
+        }
+
+        const size_t n0 = b * blockSize;
+        const size_t blockN = std::min(blockSize, N - n0);
+        for (size_t r = 0; r < rows; r++) {
+            float* rowDst = dst + (c * maxRows + r) * N + n0;
+            for (size_t j = 0; j < blockN; j++)
+                rowDst[j] = blockDst[r * blockSize + j] + (bias ? bias[n0 + j] : 0.f);
+        }
+    });
+}
@@ -0,0 +1,110 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <ie_precision.hpp>
+#include <cassert>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * The weights of the FullyConnected layer stored as I8/U8 values with the dequantization parameters:
+ * the weight is computed as (value * scale + shift), where the scale and the shift are set per output channel
+ * and per group of the input channels
+ */
+struct CompressedWeightsParams {
+    InferenceEngine::Precision precision;   // I8 or U8
+    size_t N;                               // number of the output channels
+    size_t K;                               // number of the input channels
+    size_t groups = 1;                      // number of the groups of the input channels, K is divisible by it
+    bool transposed = false;                // the weights are laid out as [K, N] instead of [N, K]
+    std::vector<float> scales;              // [N, groups]
+    std::vector<float> shifts;              // [N, groups], empty means zero shifts
+};
+
+struct jit_compressed_gemm_config_params {
+    InferenceEngine::Precision wei_prc;
+    size_t bits;
+    size_t rows;
+    size_t K;
+    size_t group_size;
+    size_t groups;
+    bool with_shifts;
+};
+
+struct jit_compressed_gemm_call_args {
+    const float *src;
+    const uint8_t *weights;
+    const float *scales;
+    const float *shifts;
+    const float *src_sums;
+    float *dst;
+};
+
+struct jit_uni_compressed_gemm_kernel {
+    void (*ker_)(const jit_compressed_gemm_call_args *);
+
+    void operator()(const jit_compressed_gemm_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_compressed_gemm_kernel(jit_compressed_gemm_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_compressed_gemm_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_compressed_gemm_config_params jcp_;
+};
+
+/**
+ * Matrix multiplication of the FP32 activations by the compressed weights: dst[M, N] = src[M, K] * W^T + bias.
+ * The weights stay compressed in memory and are decompressed in the registers of the kernel, so the layers limited
+ * by the memory bandwidth (small batch) read 4 times (8 bit) or 8 times (4 bit) less data than with the FP32 weights.
+ * The weights which fit 4 bits (int4 models, the plugin widens them to I8/U8 on load) are packed to 4 bits
+ */
+class CompressedWeightsGemm {
+public:
+    CompressedWeightsGemm(const CompressedWeightsParams& params, const uint8_t* weights);
+
+    /**
+     * The packed weights are kept outside, so the instances of the network created for the different streams
+     * can share them through the weights cache
+     */
+    size_t getPackedWeightsSize() const;
+    void packWeights(const uint8_t* weights, uint8_t* packedWeights) const;
+
+    void execute(const uint8_t* packedWeights, const float* src, float* dst, const float* bias, size_t M) const;
+
+    size_t getBits() const {
+        return bits;
+    }
+
+private:
+    int getWeight(const uint8_t* weights, size_t n, size_t k) const;
+    void referenceExecute(const uint8_t* blockWeights, const float* src, float* blockDst, const float* sums, size_t block, size_t rows) const;
+
+    static const size_t maxRows = 4;
+    static const size_t maxBlockSize = 16;
+
+    CompressedWeightsParams params;
+    size_t bits = 8;
+    size_t blockSize = 8;
+    size_t blocksNum = 0;
+    size_t groupSize = 0;
+    // the number of the packed rows of the block: K for 8 bits and K / 2 for 4 bits
+    size_t kSteps = 0;
+
+    // [blocks, groups, block]
+    std::vector<float> packedScales;
+    std::vector<float> packedShifts;
+
+    std::vector<std::shared_ptr<jit_uni_compressed_gemm_kernel>> kernels;
+};
+
+}  // namespace MKLDNNPlugin
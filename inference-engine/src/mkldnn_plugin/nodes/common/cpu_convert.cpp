@@ -5,15 +5,391 @@
 #include "cpu_convert.h"
 #include "cpu_memcpy.h"
 #include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
+#include "emitters/jit_load_store_emitters.hpp"
+#include <cpu/x64/jit_generator.hpp>
 #include <mkldnn_selective_build.h>
+#include <algorithm>
 #include <type_traits>
 #include <tuple>
+#include <limits>
+#include <map>
+#include <mutex>
 #include <ie_parallel.hpp>
 
 using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
 
 namespace {
 
+template <typename T>
+inline typename std::enable_if<std::is_signed<T>::value, bool>::type isNegative(T val) {
+    return val < 0;
+}
+
+template <typename T>
+inline typename std::enable_if<!std::is_signed<T>::value, bool>::type isNegative(T) {
+    return false;
+}
+
+// Conversion to BOOL (the destination type is bool, while the BOOL data is read as uint8_t) is static_cast<bool>:
+// any non-zero value is true, including the negative and fractional values and NaN
+template <typename dstType, typename srcType>
+inline typename std::enable_if<std::is_same<dstType, bool>::value, dstType>::type
+saturate_cast(srcType val) {
+    return static_cast<float>(val) != 0.f;
+}
+
+// Conversion to the floating point types is a plain cast
+template <typename dstType, typename srcType>
+inline typename std::enable_if<!std::numeric_limits<dstType>::is_integer, dstType>::type
+saturate_cast(srcType val) {
+    return static_cast<dstType>(val);
+}
+
+// Floating point values are truncated toward zero, the out of range values are saturated, NaN becomes the lowest value
+template <typename dstType, typename srcType>
+inline typename std::enable_if<std::numeric_limits<dstType>::is_integer && !std::is_same<dstType, bool>::value &&
+                               !std::numeric_limits<srcType>::is_integer, dstType>::type
+saturate_cast(srcType val) {
+    const double value = static_cast<float>(val);
+    if (!(value > static_cast<double>(std::numeric_limits<dstType>::lowest())))
+        return std::numeric_limits<dstType>::lowest();
+    if (value >= static_cast<double>(std::numeric_limits<dstType>::max()))
+        return std::numeric_limits<dstType>::max();
+    return static_cast<dstType>(value);
+}
+
+// The out of range integer values are saturated
+template <typename dstType, typename srcType>
+inline typename std::enable_if<std::numeric_limits<dstType>::is_integer && !std::is_same<dstType, bool>::value &&
+                               std::numeric_limits<srcType>::is_integer, dstType>::type
+saturate_cast(srcType val) {
+    if (isNegative(val)) {
+        if (!std::numeric_limits<dstType>::is_signed)
+            return 0;
+        if (static_cast<int64_t>(val) < static_cast<int64_t>(std::numeric_limits<dstType>::lowest()))
+            return std::numeric_limits<dstType>::lowest();
+        return static_cast<dstType>(val);
+    }
+    if (static_cast<uint64_t>(val) > static_cast<uint64_t>(std::numeric_limits<dstType>::max()))
+        return std::numeric_limits<dstType>::max();
+    return static_cast<dstType>(val);
+}
+
+#define GET_OFF(field) offsetof(jit_convert_call_args, field)
+
+struct jit_convert_config_params {
+    Precision src_prc;
+    Precision dst_prc;
+};
+
+struct jit_convert_call_args {
+    const void *src;
+    void *dst;
+    size_t work_amount;
+};
+
+struct jit_uni_convert_kernel {
+    void (*ker_)(const jit_convert_call_args *);
+
+    void operator()(const jit_convert_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_convert_kernel(jit_convert_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_convert_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_convert_config_params jcp_;
+};
+
+// Range of the values representable by the precision supported by the kernel
+std::pair<double, double> precisionRange(Precision prc) {
+    switch (prc) {
+        case Precision::U8: return {std::numeric_limits<uint8_t>::lowest(), std::numeric_limits<uint8_t>::max()};
+        case Precision::I8: return {std::numeric_limits<int8_t>::lowest(), std::numeric_limits<int8_t>::max()};
+        case Precision::U16: return {std::numeric_limits<uint16_t>::lowest(), std::numeric_limits<uint16_t>::max()};
+        case Precision::I16: return {std::numeric_limits<int16_t>::lowest(), std::numeric_limits<int16_t>::max()};
+        case Precision::I32: return {std::numeric_limits<int32_t>::lowest(), std::numeric_limits<int32_t>::max()};
+        case Precision::BOOL: return {0, 1};
+        default: return {std::numeric_limits<float>::lowest(), std::numeric_limits<float>::max()};
+    }
+}
+
+/**
+ * Converts work_amount elements vector by vector. The elements are loaded as FP32 (floating point sources)
+ * or I32 (integer sources), clamped to the range of the destination precision and stored. So the narrowing
+ * conversions saturate and the floating point values are truncated toward zero, as saturate_cast does.
+ * BOOL destination gets 1 for any non-zero value (NaN included) and 0 otherwise.
+ */
+template <cpu_isa_t isa>
+struct jit_uni_convert_kernel_f32 : public jit_uni_convert_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_convert_kernel_f32)
+
+    explicit jit_uni_convert_kernel_f32(jit_convert_config_params jcp) : jit_uni_convert_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        src_prc = jcp_.src_prc == Precision::BOOL ? Precision::U8 : jcp_.src_prc;
+        dst_prc = jcp_.dst_prc == Precision::BOOL ? Precision::U8 : jcp_.dst_prc;
+        exec_prc = src_prc.is_float() ? Precision::FP32 : Precision::I32;
+        to_bool = jcp_.dst_prc == Precision::BOOL;
+        to_integer = !dst_prc.is_float() && !to_bool;
+
+        auto srcRange = precisionRange(src_prc);
+        auto dstRange = precisionRange(dst_prc);
+        need_clamp = to_integer && (srcRange.first < dstRange.first || srcRange.second > dstRange.second);
+        // 2^31 - 1 is not representable in FP32, so the positive overflow is fixed up after the conversion
+        fix_i32_overflow = exec_prc == Precision::FP32 && dst_prc == Precision::I32;
+        lower_bound = dstRange.first;
+        upper_bound = dstRange.second;
+
+        load_emitter.reset(new jit_load_emitter(this, isa, nullptr));
+        store_emitter.reset(new jit_store_emitter(this, isa, nullptr));
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_table, l_table);
+
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+        if (need_clamp || fix_i32_overflow || to_bool) {
+            uni_vmovups(vmm_lower, ptr[reg_table]);
+            uni_vmovups(vmm_upper, ptr[reg_table + vlen]);
+        }
+
+        load_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx()), static_cast<size_t>(reg_load_table.getIdx())};
+        store_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx())};
+        store_pool_vec_idxs = {static_cast<size_t>(vmm_zero.getIdx())};
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label exit_label;
+
+        L(main_loop_label);
+        {
+            cmp(reg_work_amount, step);
+            jl(tail_loop_label, T_NEAR);
+
+            worker(step);
+
+            add(reg_src, step * jcp_.src_prc.size());
+            add(reg_dst, step * jcp_.dst_prc.size());
+            sub(reg_work_amount, step);
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        L(tail_loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            jle(exit_label, T_NEAR);
+
+            worker(1);
+
+            add(reg_src, jcp_.src_prc.size());
+            add(reg_dst, jcp_.dst_prc.size());
+            sub(reg_work_amount, 1);
+            jmp(tail_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+
+        load_emitter->emit_data();
+        store_emitter->emit_data();
+
+        prepare_table();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int step = vlen / sizeof(float);
+
+    Precision src_prc;
+    Precision dst_prc;
+    Precision exec_prc;
+    bool to_bool = false;
+    bool to_integer = false;
+    bool need_clamp = false;
+    bool fix_i32_overflow = false;
+    double lower_bound = 0;
+    double upper_bound = 0;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg64 reg_table = r11;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Xbyak::Reg64 reg_load_table = r15;
+    Xbyak::Reg64 reg_load_store_mask = rbp;
+
+    Vmm vmm_val = Vmm(0);
+    Vmm vmm_lower = Vmm(1);
+    Vmm vmm_upper = Vmm(2);
+    Vmm vmm_zero = Vmm(3);
+    Vmm vmm_aux0 = Vmm(4);
+    Vmm vmm_aux1 = Vmm(5);
+
+    Xbyak::Label l_table;
+
+    std::unique_ptr<jit_load_emitter> load_emitter = nullptr;
+    std::unique_ptr<jit_store_emitter> store_emitter = nullptr;
+
+    std::vector<size_t> store_pool_gpr_idxs;
+    std::vector<size_t> store_pool_vec_idxs;
+    std::vector<size_t> load_pool_gpr_idxs;
+
+    inline void worker(int elt_num) {
+        load_emitter->emit_code({static_cast<size_t>(reg_src.getIdx())}, {static_cast<size_t>(vmm_val.getIdx())},
+            std::make_shared<load_emitter_context>(src_prc, exec_prc, elt_num),
+            {}, {load_pool_gpr_idxs});
+
+        Precision store_prc = exec_prc;
+        if (to_bool) {
+            // the non-zero bits (but the FP32 sign) give the non-zero unsigned value, its minimum with 1 is the result
+            if (exec_prc == Precision::FP32)
+                uni_vandps(vmm_val, vmm_val, vmm_lower);
+            if (isa == cpu::x64::sse41)
+                pminud(vmm_val, vmm_upper);
+            else
+                vpminud(vmm_val, vmm_val, vmm_upper);
+            store_prc = Precision::I32;
+        } else if (exec_prc == Precision::FP32 && to_integer) {
+            // NaN becomes the lower bound
+            uni_vmaxps(vmm_val, vmm_val, vmm_lower);
+            if (!fix_i32_overflow)
+                uni_vminps(vmm_val, vmm_val, vmm_upper);
+            else
+                uni_vmovups(vmm_aux0, vmm_val);
+            // truncation toward zero, the store emitter would round to nearest
+            if (isa == cpu::x64::sse41)
+                cvttps2dq(vmm_val, vmm_val);
+            else
+                vcvttps2dq(vmm_val, vmm_val);
+            if (fix_i32_overflow) {
+                // the overflowed lanes are 0x80000000 while the source is positive, flipping them gives 0x7fffffff
+                uni_vpsrad(vmm_aux0, vmm_aux0, 31);
+                uni_vpsrad(vmm_aux1, vmm_val, 31);
+                if (isa == cpu::x64::avx512_common) {
+                    vpandnd(vmm_aux0, vmm_aux0, vmm_aux1);
+                } else if (isa == cpu::x64::avx2) {
+                    vpandn(vmm_aux0, vmm_aux0, vmm_aux1);
+                } else {
+                    pandn(vmm_aux0, vmm_aux1);
+                }
+                uni_vpxor(vmm_val, vmm_val, vmm_aux0);
+            }
+            store_prc = Precision::I32;
+        } else if (need_clamp) {
+            uni_vpmaxsd(vmm_val, vmm_val, vmm_lower);
+            uni_vpminsd(vmm_val, vmm_val, vmm_upper);
+        }
+
+        store_emitter->emit_code({static_cast<size_t>(vmm_val.getIdx())}, {static_cast<size_t>(reg_dst.getIdx())},
+            std::make_shared<store_emitter_context>(store_prc, dst_prc, elt_num),
+            {store_pool_vec_idxs}, {store_pool_gpr_idxs});
+    }
+
+    void prepare_table() {
+        align(64);
+        L(l_table);
+        if (to_bool) {
+            // the mask clearing the FP32 sign (so -0.0 is false) and the upper bound
+            for (int32_t value : {0x7fffffff, 1}) {
+                for (size_t d = 0; d < vlen / sizeof(int32_t); ++d)
+                    dd(value);
+            }
+            return;
+        }
+        for (auto bound : {lower_bound, upper_bound}) {
+            for (size_t d = 0; d < vlen / sizeof(int32_t); ++d) {
+                if (exec_prc == Precision::FP32)
+                    dd(float2int(static_cast<float>(bound)));
+                else
+                    dd(static_cast<int32_t>(bound));
+            }
+        }
+    }
+};
+
+bool isJitSupported(Precision srcPrc, Precision dstPrc) {
+    static const Precision supported[] = {Precision::FP32, Precision::BF16, Precision::I32, Precision::I16,
+                                          Precision::U16, Precision::I8, Precision::U8};
+    auto isSupported = [](Precision prc) { return std::find(std::begin(supported), std::end(supported), prc) != std::end(supported); };
+    if (!isSupported(srcPrc) && srcPrc != Precision::BOOL)
+        return false;
+    if (!isSupported(dstPrc) && dstPrc != Precision::BOOL)
+        return false;
+    // the store emitter converts to BF16 only on avx512_core
+    if (dstPrc == Precision::BF16 && !mayiuse(cpu::x64::avx512_core))
+        return false;
+    return mayiuse(cpu::x64::sse41);
+}
+
+/**
+ * Kernels are compiled once per precision pair and shared by all the callers
+ */
+std::shared_ptr<jit_uni_convert_kernel> getConvertKernel(Precision srcPrc, Precision dstPrc) {
+    static std::mutex guard;
+    static std::map<std::pair<Precision::ePrecision, Precision::ePrecision>, std::shared_ptr<jit_uni_convert_kernel>> kernels;
+
+    std::lock_guard<std::mutex> lock(guard);
+    auto key = std::make_pair(static_cast<Precision::ePrecision>(srcPrc), static_cast<Precision::ePrecision>(dstPrc));
+    auto found = kernels.find(key);
+    if (found != kernels.end())
+        return found->second;
+
+    std::shared_ptr<jit_uni_convert_kernel> kernel;
+    if (isJitSupported(srcPrc, dstPrc)) {
+        jit_convert_config_params jcp = { srcPrc, dstPrc };
+        if (mayiuse(cpu::x64::avx512_common)) {
+            kernel.reset(new jit_uni_convert_kernel_f32<cpu::x64::avx512_common>(jcp));
+        } else if (mayiuse(cpu::x64::avx2)) {
+            kernel.reset(new jit_uni_convert_kernel_f32<cpu::x64::avx2>(jcp));
+        } else if (mayiuse(cpu::x64::sse41)) {
+            kernel.reset(new jit_uni_convert_kernel_f32<cpu::x64::sse41>(jcp));
+        }
+        if (kernel)
+            kernel->create_ker();
+    }
+    kernels[key] = kernel;
+    return kernel;
+}
+
+// Number of elements converted by a single kernel call
+constexpr size_t convertBlockSize = 4096;
+
+void jitConvert(jit_uni_convert_kernel &kernel, const void *srcPtr, void *dstPtr, Precision srcPrc, Precision dstPrc, const size_t size) {
+    const auto *srcData = reinterpret_cast<const uint8_t *>(srcPtr);
+    auto *dstData = reinterpret_cast<uint8_t *>(dstPtr);
+    parallel_for(div_up(size, convertBlockSize), [&](size_t block) {
+        const size_t offset = block * convertBlockSize;
+        jit_convert_call_args args;
+        args.src = srcData + offset * srcPrc.size();
+        args.dst = dstData + offset * dstPrc.size();
+        args.work_amount = std::min(convertBlockSize, size - offset);
+        kernel(&args);
+    });
+}
+
 template<typename srcType, typename dstType>
 void convert(const void *srcPtr, void *dstPtr, const size_t size) {
     if (std::is_same<srcType, dstType>::value) {
@@ -22,8 +398,10 @@ void convert(const void *srcPtr, void *dstPtr, const size_t size) {
         const srcType *srcData = reinterpret_cast<const srcType *>(srcPtr);
         dstType *dstData = reinterpret_cast<dstType *>(dstPtr);
 
-        parallel_for(size, [&](size_t i) {
-            dstData[i] = static_cast<dstType>(srcData[i]);
+        parallel_for(div_up(size, convertBlockSize), [&](size_t block) {
+            const size_t end = std::min(size, (block + 1) * convertBlockSize);
+            for (size_t i = block * convertBlockSize; i < end; i++)
+                dstData[i] = saturate_cast<dstType>(srcData[i]);
         });
     }
 }
@@ -59,10 +437,11 @@ struct ConvertPrecision {
 }   // namespace
 
 #define MKLDNN_CVT(ST, DT) OV_CASE2(Precision::ST, Precision::DT, PrecisionInfo<Precision::ST>::value_type, PrecisionInfo<Precision::DT>::value_type)
+// the BOOL destination is written as bool, so saturate_cast selects the conversion to BOOL rather than to U8
+static_assert(sizeof(bool) == sizeof(PrecisionInfo<Precision::BOOL>::value_type), "BOOL is written as bool");
+#define MKLDNN_CVT_TO_BOOL(ST) OV_CASE2(Precision::ST, Precision::BOOL, PrecisionInfo<Precision::ST>::value_type, bool)
 
 void cpu_convert(const void *srcPtr, void *dstPtr, Precision srcPrc, Precision dstPrc, const size_t size) {
-    using namespace MKLDNNPlugin;
-
     if (srcPtr == nullptr || dstPtr == nullptr)
         IE_THROW() << "cpu_convert has null data pointer";
 
@@ -71,36 +450,41 @@ void cpu_convert(const void *srcPtr, void *dstPtr, Precision srcPrc, Precision d
         return;
     }
 
+    if (auto kernel = getConvertKernel(srcPrc, dstPrc)) {
+        jitConvert(*kernel, srcPtr, dstPtr, srcPrc, dstPrc, size);
+        return;
+    }
+
     ConvertContext ctx = { srcPtr, dstPtr, size, false };
 
     OV_SWITCH(MKLDNNPlugin, ConvertPrecision, ctx, std::tie(srcPrc, dstPrc),
     MKLDNN_CVT(U8, I8),    MKLDNN_CVT(U8, U16),    MKLDNN_CVT(U8, I16),
     MKLDNN_CVT(U8, I32),   MKLDNN_CVT(U8, U64),    MKLDNN_CVT(U8, I64),
-    MKLDNN_CVT(U8, FP32),  MKLDNN_CVT(U8, BF16),   MKLDNN_CVT(U8, BOOL),
+    MKLDNN_CVT(U8, FP32),  MKLDNN_CVT(U8, BF16),   MKLDNN_CVT_TO_BOOL(U8),
     MKLDNN_CVT(I8, U8),    MKLDNN_CVT(I8, U16),    MKLDNN_CVT(I8, I16),
     MKLDNN_CVT(I8, I32),   MKLDNN_CVT(I8, U64),    MKLDNN_CVT(I8, I64),
-    MKLDNN_CVT(I8, FP32),  MKLDNN_CVT(I8, BF16),   MKLDNN_CVT(I8, BOOL),
+    MKLDNN_CVT(I8, FP32),  MKLDNN_CVT(I8, BF16),   MKLDNN_CVT_TO_BOOL(I8),
     MKLDNN_CVT(U16, U8),   MKLDNN_CVT(U16, I8),    MKLDNN_CVT(U16, I16),
     MKLDNN_CVT(U16, I32),  MKLDNN_CVT(U16, U64),   MKLDNN_CVT(U16, I64),
-    MKLDNN_CVT(U16, FP32), MKLDNN_CVT(U16, BF16),  MKLDNN_CVT(U16, BOOL),
+    MKLDNN_CVT(U16, FP32), MKLDNN_CVT(U16, BF16),  MKLDNN_CVT_TO_BOOL(U16),
     MKLDNN_CVT(I16, U8),   MKLDNN_CVT(I16, I8),    MKLDNN_CVT(I16, U16),
     MKLDNN_CVT(I16, I32),  MKLDNN_CVT(I16, U64),   MKLDNN_CVT(I16, I64),
-    MKLDNN_CVT(I16, FP32), MKLDNN_CVT(I16, BF16),  MKLDNN_CVT(I16, BOOL),
+    MKLDNN_CVT(I16, FP32), MKLDNN_CVT(I16, BF16),  MKLDNN_CVT_TO_BOOL(I16),
     MKLDNN_CVT(I32, U8),   MKLDNN_CVT(I32, I8),    MKLDNN_CVT(I32, U16),
     MKLDNN_CVT(I32, I16),  MKLDNN_CVT(I32, U64),   MKLDNN_CVT(I32, I64),
-    MKLDNN_CVT(I32, FP32), MKLDNN_CVT(I32, BF16),  MKLDNN_CVT(I32, BOOL),
+    MKLDNN_CVT(I32, FP32), MKLDNN_CVT(I32, BF16),  MKLDNN_CVT_TO_BOOL(I32),
     MKLDNN_CVT(U64, U8),   MKLDNN_CVT(U64, I8),    MKLDNN_CVT(U64, U16),
     MKLDNN_CVT(U64, I16),  MKLDNN_CVT(U64, I32),   MKLDNN_CVT(U64, I64),
-    MKLDNN_CVT(U64, FP32), MKLDNN_CVT(U64, BF16),  MKLDNN_CVT(U64, BOOL),
+    MKLDNN_CVT(U64, FP32), MKLDNN_CVT(U64, BF16),  MKLDNN_CVT_TO_BOOL(U64),
     MKLDNN_CVT(I64, U8),   MKLDNN_CVT(I64, I8),    MKLDNN_CVT(I64, U16),
     MKLDNN_CVT(I64, I16),  MKLDNN_CVT(I64, I32),   MKLDNN_CVT(I64, U64),
-    MKLDNN_CVT(I64, FP32), MKLDNN_CVT(I64, BF16),  MKLDNN_CVT(I64, BOOL),
+    MKLDNN_CVT(I64, FP32), MKLDNN_CVT(I64, BF16),  MKLDNN_CVT_TO_BOOL(I64),
     MKLDNN_CVT(FP32, U8),  MKLDNN_CVT(FP32, I8),   MKLDNN_CVT(FP32, U16),
     MKLDNN_CVT(FP32, I16), MKLDNN_CVT(FP32, I32),  MKLDNN_CVT(FP32, U64),
-    MKLDNN_CVT(FP32, I64), MKLDNN_CVT(FP32, BF16), MKLDNN_CVT(FP32, BOOL),
+    MKLDNN_CVT(FP32, I64), MKLDNN_CVT(FP32, BF16), MKLDNN_CVT_TO_BOOL(FP32),
     MKLDNN_CVT(BF16, U8),  MKLDNN_CVT(BF16, I8),   MKLDNN_CVT(BF16, U16),
     MKLDNN_CVT(BF16, I16), MKLDNN_CVT(BF16, I32),  MKLDNN_CVT(BF16, U64),
-    MKLDNN_CVT(BF16, I64), MKLDNN_CVT(BF16, FP32), MKLDNN_CVT(BF16, BOOL),
+    MKLDNN_CVT(BF16, I64), MKLDNN_CVT(BF16, FP32), MKLDNN_CVT_TO_BOOL(BF16),
     MKLDNN_CVT(BOOL, U8),  MKLDNN_CVT(BOOL, I8),   MKLDNN_CVT(BOOL, U16),
     MKLDNN_CVT(BOOL, I16), MKLDNN_CVT(BOOL, I32),  MKLDNN_CVT(BOOL, U64),
     MKLDNN_CVT(BOOL, I64), MKLDNN_CVT(BOOL, FP32), MKLDNN_CVT(BOOL, BF16));
@@ -109,4 +493,5 @@ void cpu_convert(const void *srcPtr, void *dstPtr, Precision srcPrc, Precision d
         IE_THROW() << "cpu_convert can't convert from: " << srcPrc << " precision to: " << dstPrc;
 }
 
+#undef MKLDNN_CVT_TO_BOOL
 #undef MKLDNN_CVT
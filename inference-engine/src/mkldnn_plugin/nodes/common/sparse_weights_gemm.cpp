@@ -0,0 +1,270 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sparse_weights_gemm.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include <mkldnn_types.h>
+#include <ie_parallel.hpp>
+#include "utils/general_utils.h"
+
+#include "cpu/x64/jit_generator.hpp"
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+using namespace mkldnn;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_sparse_gemm_call_args, field)
+
+/**
+ * Computes a range of the output channels for several rows of the source. The non zero weights of the output channel
+ * are loaded by vectors together with their input channels, the source values of these channels are gathered
+ * and accumulated, then the accumulators are reduced to the output values
+ */
+template <cpu_isa_t isa>
+struct jit_uni_sparse_gemm_kernel_f32 : public jit_uni_sparse_gemm_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_sparse_gemm_kernel_f32)
+
+    explicit jit_uni_sparse_gemm_kernel_f32(jit_sparse_gemm_config_params jcp)
+        : jit_uni_sparse_gemm_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_values, ptr[reg_params + GET_OFF(values)]);
+        mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+        mov(reg_chunks, ptr[reg_params + GET_OFF(chunks)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_channels, ptr[reg_params + GET_OFF(channels)]);
+
+        Xbyak::Label channel_loop_label;
+        Xbyak::Label chunk_loop_label;
+        Xbyak::Label reduce_label;
+
+        L(channel_loop_label);
+        {
+            for (size_t r = 0; r < jcp_.rows; r++)
+                uni_vpxor(vmm_acc(r), vmm_acc(r), vmm_acc(r));
+
+            mov(reg_chunk.cvt32(), dword[reg_chunks]);
+            test(reg_chunk, reg_chunk);
+            jz(reduce_label, T_NEAR);
+
+            L(chunk_loop_label);
+            {
+                uni_vmovups(vmm_idx, ptr[reg_indices]);
+                uni_vmovups(vmm_val, ptr[reg_values]);
+                for (size_t r = 0; r < jcp_.rows; r++) {
+                    gather_src(r);
+                    uni_vfmadd231ps(vmm_acc(r), vmm_src, vmm_val);
+                }
+                add(reg_indices, vlen);
+                add(reg_values, vlen);
+
+                sub(reg_chunk, 1);
+                jnz(chunk_loop_label, T_NEAR);
+            }
+
+            L(reduce_label);
+            for (size_t r = 0; r < jcp_.rows; r++)
+                reduce_and_store(r);
+
+            add(reg_chunks, sizeof(uint32_t));
+            add(reg_dst, sizeof(float));
+
+            sub(reg_channels, 1);
+            jnz(channel_loop_label, T_NEAR);
+        }
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename conditional<isa == cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_values = r9;
+    Xbyak::Reg64 reg_indices = r10;
+    Xbyak::Reg64 reg_chunks = r11;
+    Xbyak::Reg64 reg_dst = r12;
+    Xbyak::Reg64 reg_channels = r13;
+    Xbyak::Reg64 reg_chunk = r14;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    // 0 .. rows - 1 are the accumulators
+    Vmm vmm_acc(size_t r) const { return Vmm(r); }
+
+    Vmm vmm_idx = Vmm(4);
+    Vmm vmm_val = Vmm(5);
+    Vmm vmm_src = Vmm(6);
+    Vmm vmm_mask = Vmm(7);
+    Xbyak::Ymm ymm_tmp = Xbyak::Ymm(8);
+    Xbyak::Xmm xmm_tmp = Xbyak::Xmm(8);
+    Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+
+    // the gather consumes the mask, so it is set to all ones before every one
+    inline void gather_src(size_t r) {
+        const auto addr = ptr[reg_src + vmm_idx * sizeof(float) + r * jcp_.K * sizeof(float)];
+        if (isa == cpu::x64::avx2) {
+            vpcmpeqd(vmm_mask, vmm_mask, vmm_mask);
+            vgatherdps(vmm_src, addr, vmm_mask);
+        } else {
+            kxnorw(k_mask, k_mask, k_mask);
+            vgatherdps(vmm_src | k_mask, addr);
+        }
+    }
+
+    inline void reduce_and_store(size_t r) {
+        const Xbyak::Ymm ymm_acc = Xbyak::Ymm(vmm_acc(r).getIdx());
+        const Xbyak::Xmm xmm_acc = Xbyak::Xmm(vmm_acc(r).getIdx());
+        if (isa != cpu::x64::avx2) {
+            vextractf64x4(ymm_tmp, Xbyak::Zmm(vmm_acc(r).getIdx()), 1);
+            vaddps(ymm_acc, ymm_acc, ymm_tmp);
+        }
+        vextractf128(xmm_tmp, ymm_acc, 1);
+        vaddps(xmm_acc, xmm_acc, xmm_tmp);
+        vhaddps(xmm_acc, xmm_acc, xmm_acc);
+        vhaddps(xmm_acc, xmm_acc, xmm_acc);
+        vmovss(ptr[reg_dst + r * jcp_.N * sizeof(float)], xmm_acc);
+    }
+};
+
+SparseWeightsGemm::SparseWeightsGemm(size_t N, size_t K, const float* weights) : N(N), K(K) {
+    if (K > static_cast<size_t>(std::numeric_limits<int32_t>::max()) / (maxRows * sizeof(float)))
+        IE_THROW() << "SparseWeightsGemm does not support " << K << " input channels";
+
+    jit_sparse_gemm_config_params jcp = {0, N, K};
+    for (size_t rows = 1; rows <= maxRows; rows++) {
+        jcp.rows = rows;
+        std::shared_ptr<jit_uni_sparse_gemm_kernel> kernel;
+        if (mayiuse(cpu::x64::avx512_common)) {
+            kernel.reset(new jit_uni_sparse_gemm_kernel_f32<cpu::x64::avx512_common>(jcp));
+            step = cpu_isa_traits<cpu::x64::avx512_common>::vlen / sizeof(float);
+        } else if (mayiuse(cpu::x64::avx2)) {
+            kernel.reset(new jit_uni_sparse_gemm_kernel_f32<cpu::x64::avx2>(jcp));
+            step = cpu_isa_traits<cpu::x64::avx2>::vlen / sizeof(float);
+        }
+        if (!kernel)
+            break;
+        kernel->create_ker();
+        kernels.push_back(kernel);
+    }
+
+    chunks.resize(N);
+    parallel_for(N, [&](size_t n) {
+        const float* channelWeights = weights + n * K;
+        const size_t nonZeros = K - std::count(channelWeights, channelWeights + K, 0.f);
+        chunks[n] = static_cast<uint32_t>(div_up(nonZeros, step));
+    });
+
+    offsets.resize(N + 1);
+    offsets[0] = 0;
+    for (size_t n = 0; n < N; n++)
+        offsets[n + 1] = offsets[n] + chunks[n] * step;
+}
+
+float SparseWeightsGemm::getSparsity(const float* weights, size_t size) {
+    if (size == 0)
+        return 0.f;
+
+    const size_t blockSize = 4096;
+    const size_t zeros = parallel_sum(div_up(size, blockSize), static_cast<size_t>(0), [&](size_t b) {
+        const float* begin = weights + b * blockSize;
+        const float* end = weights + std::min(size, (b + 1) * blockSize);
+        return static_cast<size_t>(std::count(begin, end, 0.f));
+    });
+    return static_cast<float>(zeros) / static_cast<float>(size);
+}
+
+size_t SparseWeightsGemm::getPackedWeightsSize() const {
+    return offsets[N] * (sizeof(float) + sizeof(int32_t));
+}
+
+void SparseWeightsGemm::packWeights(const float* weights, uint8_t* packedWeights) const {
+    // [values of all the channels][input channels of all the values]
+    auto values = reinterpret_cast<float*>(packedWeights);
+    auto indices = reinterpret_cast<int32_t*>(packedWeights + offsets[N] * sizeof(float));
+    parallel_for(N, [&](size_t n) {
+        const float* channelWeights = weights + n * K;
+        size_t idx = offsets[n];
+        for (size_t k = 0; k < K; k++) {
+            if (channelWeights[k] != 0.f) {
+                values[idx] = channelWeights[k];
+                indices[idx] = static_cast<int32_t>(k);
+                idx++;
+            }
+        }
+        // the padding gathers the first input channel and multiplies it by zero
+        for (; idx < offsets[n + 1]; idx++) {
+            values[idx] = 0.f;
+            indices[idx] = 0;
+        }
+    });
+}
+
+void SparseWeightsGemm::referenceExecute(const float* values, const int32_t* indices, const uint32_t* chunks, const float* src, float* dst,
+                                         size_t channels, size_t rows) const {
+    for (size_t j = 0; j < channels; j++) {
+        const size_t count = chunks[j] * step;
+        for (size_t r = 0; r < rows; r++) {
+            const float* rowSrc = src + r * K;
+            float acc = 0.f;
+            for (size_t i = 0; i < count; i++)
+                acc += values[i] * rowSrc[indices[i]];
+            dst[r * N + j] = acc;
+        }
+        values += count;
+        indices += count;
+    }
+}
+
+void SparseWeightsGemm::execute(const uint8_t* packedWeights, const float* src, float* dst, const float* bias, size_t M) const {
+    auto values = reinterpret_cast<const float*>(packedWeights);
+    auto indices = reinterpret_cast<const int32_t*>(packedWeights + offsets[N] * sizeof(float));
+
+    // the chunks of the rows are the inner dimension, so a thread reuses the block of the weights from the cache
+    const size_t blocksNum = div_up(N, channelsBlock);
+    const size_t rowChunksNum = div_up(M, maxRows);
+    parallel_for2d(blocksNum, rowChunksNum, [&](size_t b, size_t c) {
+        const size_t rows = std::min(maxRows, M - c * maxRows);
+        const size_t n0 = b * channelsBlock;
+        const size_t channels = std::min(channelsBlock, N - n0);
+        const float* chunkSrc = src + c * maxRows * K;
+        float* chunkDst = dst + c * maxRows * N + n0;
+
+        if (kernels.empty()) {
+            referenceExecute(values + offsets[n0], indices + offsets[n0], chunks.data() + n0, chunkSrc, chunkDst, channels, rows);
+        } else {
+            jit_sparse_gemm_call_args args;
+            args.src = chunkSrc;
+            args.values = values + offsets[n0];
+            args.indices = indices + offsets[n0];
+            args.chunks = chunks.data() + n0;
+            args.dst = chunkDst;
+            args.channels = channels;
+            (*kernels[rows - 1])(&args);
+        }
+
+        if (bias) {
+            for (size_t r = 0; r < rows; r++) {
+                for (size_t j = 0; j < channels; j++)
+                    chunkDst[r * N + j] += bias[n0 + j];
+            }
+        }
+    });
+}
@@ -0,0 +1,97 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+struct jit_sparse_gemm_config_params {
+    size_t rows;
+    size_t N;
+    size_t K;
+};
+
+struct jit_sparse_gemm_call_args {
+    const float *src;
+    const float *values;
+    const int32_t *indices;
+    const uint32_t *chunks;
+    float *dst;
+    size_t channels;
+};
+
+struct jit_uni_sparse_gemm_kernel {
+    void (*ker_)(const jit_sparse_gemm_call_args *);
+
+    void operator()(const jit_sparse_gemm_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_sparse_gemm_kernel(jit_sparse_gemm_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_sparse_gemm_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_sparse_gemm_config_params jcp_;
+};
+
+/**
+ * Matrix multiplication of the FP32 activations by the sparse FP32 weights: dst[M, N] = src[M, K] * W^T + bias.
+ * Only the non zero weights are kept (compressed sparse rows: the values and the input channels of every output
+ * channel), so the pruned layers read and multiply several times less weights than the dense inner product.
+ * The kernel gathers the source values by the indices of the input channels, so it needs AVX2 at least,
+ * the reference implementation is used otherwise
+ */
+class SparseWeightsGemm {
+public:
+    /**
+     * @param weights the dense weights laid out as [N, K]
+     */
+    SparseWeightsGemm(size_t N, size_t K, const float* weights);
+
+    /**
+     * @return the share of the zero values among the weights
+     */
+    static float getSparsity(const float* weights, size_t size);
+
+    /**
+     * The packed weights are kept outside, so the instances of the network created for the different streams
+     * can share them through the weights cache
+     */
+    size_t getPackedWeightsSize() const;
+    void packWeights(const float* weights, uint8_t* packedWeights) const;
+
+    void execute(const uint8_t* packedWeights, const float* src, float* dst, const float* bias, size_t M) const;
+
+    bool withJit() const {
+        return !kernels.empty();
+    }
+
+private:
+    void referenceExecute(const float* values, const int32_t* indices, const uint32_t* chunks, const float* src, float* dst,
+                          size_t channels, size_t rows) const;
+
+    static const size_t maxRows = 4;
+    static const size_t channelsBlock = 64;
+
+    size_t N;
+    size_t K;
+    // the non zero weights of every output channel are padded with zeros to the multiple of the vector length
+    size_t step = 8;
+    // [N], the number of the vectors of the output channel
+    std::vector<uint32_t> chunks;
+    // [N + 1], the offset of the first value of the output channel
+    std::vector<size_t> offsets;
+
+    std::vector<std::shared_ptr<jit_uni_sparse_gemm_kernel>> kernels;
+};
+
+}  // namespace MKLDNNPlugin
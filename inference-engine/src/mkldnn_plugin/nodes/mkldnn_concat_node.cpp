@@ -365,7 +365,7 @@ void MKLDNNConcatNode::createPrimitive() {
     }
 
     auto primitive_desc = concat::primitive_desc(desc, static_cast<int>(axis), srcs_d, getEngine());
-    prim.reset(new concat(primitive_desc));
+    createCachedPrimitive<concat>(primitive_desc);
 }
 
 size_t MKLDNNConcatNode::inverseOrder(const SizeVector& order, size_t axis) {
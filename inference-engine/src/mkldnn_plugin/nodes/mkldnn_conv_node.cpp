@@ -466,7 +466,11 @@ void MKLDNNConvolutionNode::createPrimitive() {
     auto prim_desc = createPrimitiveDescriptor<convolution_forward::primitive_desc,
             convolution_forward::desc>(attr);
 
-    prim.reset(new convolution_forward(prim_desc));
+    // the zero points are not the part of the key of the primitive cache
+    if (inputZeroPoints.empty() && weightsZeroPoints.empty() && outputCompensation.empty())
+        createCachedPrimitive<convolution_forward>(prim_desc, attr);
+    else
+        prim.reset(new convolution_forward(prim_desc));
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -329,7 +329,7 @@ void MKLDNNDeconvolutionNode::createPrimitive() {
         auto prim_desc = createPrimitiveDescriptor<deconvolution_forward::primitive_desc,
                 deconvolution_forward::desc>(attr);
 
-        prim.reset(new deconvolution_forward(prim_desc));
+        createCachedPrimitive<deconvolution_forward>(prim_desc, attr);
 
         auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
         auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -338,7 +338,7 @@ void MKLDNNDeconvolutionNode::createPrimitive() {
         auto prim_desc = createPrimitiveDescriptor<convolution_backward_data::primitive_desc,
                 convolution_backward_data::desc, convolution_forward::primitive_desc>(attr);
 
-        prim.reset(new convolution_backward_data(prim_desc));
+        createCachedPrimitive<convolution_backward_data>(prim_desc, attr);
 
         auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
         auto weights = getParentEdgeAt(1)->getMemory().GetPrimitive();
@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
+#include <set>
 #include <vector>
 #include <string>
 #include <mkldnn_types.h>
@@ -10,9 +12,194 @@
 #include "mkldnn_embedding_bag_sum_node.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "common/cpu_convert.h"
+#include "emitters/jit_load_store_emitters.hpp"
+#include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
+#include <cpu/x64/jit_generator.hpp>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_embedding_bag_row_call_args, field)
+
+namespace MKLDNNPlugin {
+
+struct jit_embedding_bag_row_config_params {
+    Precision src_prc;
+    bool with_shift;
+};
+
+struct jit_embedding_bag_row_call_args {
+    const void *src;
+    float *dst;
+    const void *prefetch;
+    float scale;
+    float shift;
+    size_t work_amount;
+};
+
+struct jit_uni_embedding_bag_row_kernel {
+    void (*ker_)(const jit_embedding_bag_row_call_args *);
+
+    void operator()(const jit_embedding_bag_row_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_embedding_bag_row_kernel(jit_embedding_bag_row_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_embedding_bag_row_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_embedding_bag_row_config_params jcp_;
+};
+
+/**
+ * Accumulates a row of the table to the FP32 accumulator: dst += src * scale + shift.
+ * The row of an upcoming index is prefetched along the way, so its loading overlaps the accumulation of the current one
+ */
+template <cpu_isa_t isa>
+struct jit_uni_embedding_bag_row_kernel_f32 : public jit_uni_embedding_bag_row_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_embedding_bag_row_kernel_f32)
+
+    explicit jit_uni_embedding_bag_row_kernel_f32(jit_embedding_bag_row_config_params jcp)
+        : jit_uni_embedding_bag_row_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        load_emitter.reset(new jit_load_emitter(this, isa, nullptr));
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_prefetch, ptr[reg_params + GET_OFF(prefetch)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        uni_vbroadcastss(vmm_scale, ptr[reg_params + GET_OFF(scale)]);
+        if (jcp_.with_shift)
+            uni_vbroadcastss(vmm_shift, ptr[reg_params + GET_OFF(shift)]);
+
+        load_pool_gpr_idxs = {static_cast<size_t>(reg_load_mask.getIdx()), static_cast<size_t>(reg_load_table.getIdx())};
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label exit_label;
+
+        L(main_loop_label);
+        {
+            cmp(reg_work_amount, step);
+            jl(tail_loop_label, T_NEAR);
+
+            prefetcht0(ptr[reg_prefetch]);
+            worker(step);
+
+            add(reg_src, step * jcp_.src_prc.size());
+            add(reg_prefetch, step * jcp_.src_prc.size());
+            add(reg_dst, step * sizeof(float));
+            sub(reg_work_amount, step);
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        L(tail_loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            jle(exit_label, T_NEAR);
+
+            worker(1);
+
+            add(reg_src, jcp_.src_prc.size());
+            add(reg_dst, sizeof(float));
+            sub(reg_work_amount, 1);
+            jmp(tail_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+
+        load_emitter->emit_data();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int step = vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_prefetch = r10;
+    Xbyak::Reg64 reg_work_amount = r11;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Xbyak::Reg64 reg_load_table = r15;
+    Xbyak::Reg64 reg_load_mask = rbp;
+
+    Vmm vmm_src = Vmm(0);
+    Vmm vmm_dst = Vmm(1);
+    Vmm vmm_scale = Vmm(2);
+    Vmm vmm_shift = Vmm(3);
+
+    std::unique_ptr<jit_load_emitter> load_emitter = nullptr;
+    std::vector<size_t> load_pool_gpr_idxs;
+
+    inline void worker(int elt_num) {
+        load_emitter->emit_code({static_cast<size_t>(reg_src.getIdx())}, {static_cast<size_t>(vmm_src.getIdx())},
+            std::make_shared<load_emitter_context>(jcp_.src_prc, Precision::FP32, elt_num),
+            {}, {load_pool_gpr_idxs});
+
+        Xbyak::Xmm xmm_dst = Xbyak::Xmm(vmm_dst.getIdx());
+        if (elt_num == step)
+            uni_vmovups(vmm_dst, ptr[reg_dst]);
+        else
+            uni_vmovss(xmm_dst, ptr[reg_dst]);
+
+        uni_vfmadd231ps(vmm_dst, vmm_src, vmm_scale);
+        if (jcp_.with_shift)
+            uni_vaddps(vmm_dst, vmm_dst, vmm_shift);
+
+        if (elt_num == step)
+            uni_vmovups(ptr[reg_dst], vmm_dst);
+        else
+            uni_vmovss(ptr[reg_dst], xmm_dst);
+    }
+};
+
+}  // namespace MKLDNNPlugin
+
+namespace {
+
+// Number of the indices the rows are prefetched ahead of the accumulated one
+const size_t prefetchDistance = 8lu;
+
+template <typename T>
+void accumulateRow(float* dst, const T* src, float scale, float shift, size_t size) {
+    for (size_t i = 0lu; i < size; i++) {
+        dst[i] += static_cast<float>(src[i]) * scale + shift;
+    }
+}
+
+void accumulateRowRef(float* dst, const uint8_t* src, const Precision& srcPrc, float scale, float shift, size_t size) {
+    switch (srcPrc) {
+        case Precision::FP32: return accumulateRow(dst, reinterpret_cast<const float*>(src), scale, shift, size);
+        case Precision::BF16: return accumulateRow(dst, reinterpret_cast<const bfloat16_t*>(src), scale, shift, size);
+        case Precision::I8: return accumulateRow(dst, reinterpret_cast<const int8_t*>(src), scale, shift, size);
+        case Precision::U8: return accumulateRow(dst, src, scale, shift, size);
+        default: IE_THROW() << "EmbeddingBagSum layer does not support table precision '" << srcPrc.name() << "'";
+    }
+}
+
+}  // namespace
 
 MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
             const std::shared_ptr<ngraph::Node>& op,
@@ -42,6 +229,52 @@ MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
     }
 }
 
+void MKLDNNEmbeddingBagSumNode::fuseDequantization(const Precision& tablePrecision, std::vector<float> scales, std::vector<float> shifts) {
+    if (!one_of(tablePrecision, Precision::I8, Precision::U8))
+        IE_THROW() << "Layer EmbeddingBagSum with name '" << _layerName << "' can't fuse dequantization of "
+                   << tablePrecision.name() << " table";
+    _quantizedTablePrecision = tablePrecision;
+    _scales = std::move(scales);
+    _shifts = std::move(shifts);
+}
+
+MKLDNNEmbeddingBagSumNode::Precisions MKLDNNEmbeddingBagSumNode::getSupportedPrecisions(const Precision& originalTablePrecision,
+                                                                                      const Precision& originalOutputPrecision) const {
+    std::string logPrefix = std::string("Layer EmbeddingBagSum with name '") + _layerName + "' ";
+    static const std::set<Precision> supportedPrecisions =
+            {Precision::FP32, Precision::BF16, Precision::I8, Precision::U8, Precision::I32};
+
+    auto tablePrecision = _quantizedTablePrecision != Precision::UNSPECIFIED ? _quantizedTablePrecision : originalTablePrecision;
+    if (supportedPrecisions.find(tablePrecision) == supportedPrecisions.end())
+        IE_THROW() << logPrefix << "has unsupported precision: " << tablePrecision.name();
+
+    const bool withBF16 = mayiuse(avx512_core);
+    if (tablePrecision == Precision::BF16 && !withBF16)
+        tablePrecision = Precision::FP32;
+
+    if (_quantizedTablePrecision == Precision::UNSPECIFIED && !tablePrecision.is_float())
+        return {tablePrecision, tablePrecision, tablePrecision};
+
+    const auto outputPrecision = originalOutputPrecision == Precision::BF16 && withBF16 ? Precision::BF16 : Precision::FP32;
+    return {tablePrecision, Precision::FP32, outputPrecision};
+}
+
+void MKLDNNEmbeddingBagSumNode::createRowKernel(const Precision& tablePrecision) {
+    if (!tablePrecision.is_float() && _quantizedTablePrecision == Precision::UNSPECIFIED)
+        return;
+
+    jit_embedding_bag_row_config_params jcp = { tablePrecision, !_shifts.empty() };
+    if (mayiuse(cpu::x64::avx512_common)) {
+        _rowKernel.reset(new jit_uni_embedding_bag_row_kernel_f32<cpu::x64::avx512_common>(jcp));
+    } else if (mayiuse(cpu::x64::avx2)) {
+        _rowKernel.reset(new jit_uni_embedding_bag_row_kernel_f32<cpu::x64::avx2>(jcp));
+    } else if (mayiuse(cpu::x64::sse41)) {
+        _rowKernel.reset(new jit_uni_embedding_bag_row_kernel_f32<cpu::x64::sse41>(jcp));
+    }
+    if (_rowKernel)
+        _rowKernel->create_ker();
+}
+
 template<typename T>
 void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsData, T* dstData,
                                             const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims) {
@@ -114,13 +347,91 @@ void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsDa
     parallel_nt(0, threadBody);
 }
 
+void MKLDNNEmbeddingBagSumNode::processDataFP32(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData,
+                                                const Precision &srcPrc, const Precision &dstPrc,
+                                                const SizeVector& inDataDims, const SizeVector& outDataDims) {
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+
+    initFromInputs();
+
+    const size_t outputBagsNum = outDataDims[0];
+    const size_t tableRowsNum = inDataDims[0];
+    const size_t rowSize = _embDepth * srcPrc.size();
+    const bool perRowScales = _scales.size() > 1lu;
+    const bool perRowShifts = _shifts.size() > 1lu;
+    const float* weights = reinterpret_cast<const float*>(weightsData);
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(outputBagsNum, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        // The bags are accumulated in FP32 and converted to the output precision when completed
+        std::vector<float> accumulator(dstPrc == Precision::FP32 ? 0lu : _embDepth);
+
+        size_t indicesSize = 0lu;
+        const int* indices = nullptr;
+        int weightsIdx = 0lu;
+        bool withWeights = _withWeights;
+
+        for (size_t obi = start; obi < end; obi++) {
+            uint8_t* dst = dstData + obi * _embDepth * dstPrc.size();
+            float* acc = dstPrc == Precision::FP32 ? reinterpret_cast<float*>(dst) : accumulator.data();
+            std::fill(acc, acc + _embDepth, 0.f);
+
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            if (indices != nullptr) {
+                withWeights = withWeights & _withWeights;
+
+                for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                    const size_t row = static_cast<size_t>(indices[inIdx]);
+                    if (row >= tableRowsNum) {
+                        IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+                    }
+
+                    size_t prefetchRow = row;
+                    if (inIdx + prefetchDistance < indicesSize && static_cast<size_t>(indices[inIdx + prefetchDistance]) < tableRowsNum)
+                        prefetchRow = static_cast<size_t>(indices[inIdx + prefetchDistance]);
+
+                    float scale = _scales.empty() ? 1.f : _scales[perRowScales ? row : 0lu];
+                    float shift = _shifts.empty() ? 0.f : _shifts[perRowShifts ? row : 0lu];
+                    if (withWeights) {
+                        scale *= weights[weightsIdx];
+                        shift *= weights[weightsIdx];
+                        weightsIdx++;
+                    }
+
+                    if (_rowKernel) {
+                        auto args = jit_embedding_bag_row_call_args();
+                        args.src = srcData + row * rowSize;
+                        args.dst = acc;
+                        args.prefetch = srcData + prefetchRow * rowSize;
+                        args.scale = scale;
+                        args.shift = shift;
+                        args.work_amount = _embDepth;
+                        (*_rowKernel)(&args);
+                    } else {
+                        accumulateRowRef(acc, srcData + row * rowSize, srcPrc, scale, shift, _embDepth);
+                    }
+                }
+            }
+
+            if (dstPrc != Precision::FP32)
+                cpu_convert(acc, dst, Precision::FP32, dstPrc, _embDepth);
+        }
+    };
+
+    parallel_nt(0, threadBody);
+}
+
 void MKLDNNEmbeddingBagSumNode::execute(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData, const InferenceEngine::Precision &srcPrc,
-                                        const InferenceEngine::SizeVector& inDims, const InferenceEngine::SizeVector& outDims) {
+                                        const InferenceEngine::Precision &dstPrc, const InferenceEngine::SizeVector& inDims,
+                                        const InferenceEngine::SizeVector& outDims) {
+    if (srcPrc.is_float() || _quantizedTablePrecision != Precision::UNSPECIFIED)
+        return processDataFP32(srcData, weightsData, dstData, srcPrc, dstPrc, inDims, outDims);
+
     switch (srcPrc) {
-        case Precision::FP32: {
-            return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
-                    reinterpret_cast<const float*>(weightsData), reinterpret_cast<float*>(dstData), inDims, outDims);
-        }
         case Precision::I8: {
             return processData<PrecisionTrait<Precision::I8>::value_type>(reinterpret_cast<const int8_t*>(srcData),
                     reinterpret_cast<const int8_t*>(weightsData), reinterpret_cast<int8_t*>(dstData), inDims, outDims);
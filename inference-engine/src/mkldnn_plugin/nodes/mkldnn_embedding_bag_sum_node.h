@@ -12,6 +12,8 @@
 
 namespace MKLDNNPlugin {
 
+struct jit_uni_embedding_bag_row_kernel;
+
 class MKLDNNEmbeddingBagSumNode {
 public:
     MKLDNNEmbeddingBagSumNode(
@@ -22,7 +24,13 @@ public:
             size_t defaultIndexIdx);
 
     void execute(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData, const InferenceEngine::Precision &srcPrc,
-                 const InferenceEngine::SizeVector& inDims, const InferenceEngine::SizeVector& outDims);
+                 const InferenceEngine::Precision &dstPrc, const InferenceEngine::SizeVector& inDims, const InferenceEngine::SizeVector& outDims);
+
+    /**
+     * Fuses the dequantization of the quantized table: the rows are computed as (row * scale + shift).
+     * The scales and the shifts contain a value per row or a single value for the whole table, no shifts means zero
+     */
+    void fuseDequantization(const InferenceEngine::Precision& tablePrecision, std::vector<float> scales, std::vector<float> shifts);
 
     ~MKLDNNEmbeddingBagSumNode() = default;
 
@@ -35,9 +43,26 @@ protected:
             int& weightsIdx,
             bool& withWeights) = 0;
 
+    struct Precisions {
+        InferenceEngine::Precision table;
+        InferenceEngine::Precision weights;
+        InferenceEngine::Precision output;
+    };
+
+    /**
+     * The integer tables are accumulated in their own precision, as the operation defines. The floating point and
+     * the quantized tables are accumulated in FP32 and the output is FP32 or BF16
+     */
+    Precisions getSupportedPrecisions(const InferenceEngine::Precision& originalTablePrecision,
+                                      const InferenceEngine::Precision& originalOutputPrecision) const;
+    void createRowKernel(const InferenceEngine::Precision& tablePrecision);
+
     template<typename T>
     void processData(const T* srcData, const T* weightsData, T* dstData,
                      const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims);
+    void processDataFP32(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData,
+                         const InferenceEngine::Precision &srcPrc, const InferenceEngine::Precision &dstPrc,
+                         const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims);
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -47,6 +72,13 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    // Fused dequantization of the table
+    InferenceEngine::Precision _quantizedTablePrecision = InferenceEngine::Precision::UNSPECIFIED;
+    std::vector<float> _scales;
+    std::vector<float> _shifts;
+
+    std::shared_ptr<jit_uni_embedding_bag_row_kernel> _rowKernel;
 };
 
 }  // namespace MKLDNNPlugin
@@ -5,14 +5,17 @@
 #include "mkldnn_fullyconnected_node.h"
 #include "mkldnn_eltwise_node.h"
 #include "mkldnn_fake_quantize_node.h"
+#include "mkldnn_input_node.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include <ngraph/opsets/opset1.hpp>
+#include <cmath>
 #include <string>
 #include <vector>
 #include <mkldnn_extension_utils.h>
 #include <mkldnn.hpp>
 #include "utils/general_utils.h"
 #include <cpu_memory_desc_utils.h>
+#include <cpu/x64/cpu_isa_traits.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -73,6 +76,10 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     if (getChildEdges().empty())
         IE_THROW()<< errorPrefix << " has incorrect number of output edges";
 
+    // the layer with the compressed or sparse weights is executed by its own kernel
+    if (withWeightsDecompression() || withSparseWeights())
+        return;
+
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(DATA_ID));
     auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getOriginalOutputPrecisionAtPort(DATA_ID));
 
@@ -121,7 +128,135 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!withWeightsDecompression() && !withSparseWeights()) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    // the kernel of the sparse weights gathers the source, so it has no SSE4.1 version
+    impl_desc_type implType = impl_desc_type::ref_any;
+    if (mkldnn::impl::cpu::x64::mayiuse(mkldnn::impl::cpu::x64::avx512_common))
+        implType = impl_desc_type::jit_avx512;
+    else if (mkldnn::impl::cpu::x64::mayiuse(mkldnn::impl::cpu::x64::avx2))
+        implType = impl_desc_type::jit_avx2;
+    else if (mkldnn::impl::cpu::x64::mayiuse(mkldnn::impl::cpu::x64::sse41) && withWeightsDecompression())
+        implType = impl_desc_type::jit_sse42;
+
+    const auto weightsPrecision = withWeightsDecompression() ? decompressionParams->precision : Precision::FP32;
+    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, Precision::FP32},
+                                                       {LayoutType::ncsp, weightsPrecision}});
+    if (withBiases)
+        inDataConfigurators.push_back({LayoutType::ncsp, Precision::FP32});
+
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, Precision::FP32}}, implType);
+}
+
+void MKLDNNFullyConnectedNode::fuseWeightsDecompression(const CompressedWeightsParams& params) {
+    decompressionParams = std::make_shared<CompressedWeightsParams>(params);
+}
+
+void MKLDNNFullyConnectedNode::createCompressedGemm() {
+    if (compressedGemm)
+        return;
+
+    const auto weightsData = static_cast<const uint8_t*>(getParentEdgeAt(WEIGHTS_ID)->getMemory().GetPtr());
+    compressedGemm = std::make_shared<CompressedWeightsGemm>(*decompressionParams, weightsData);
+
+    auto packWeights = [&, this] () {
+        MKLDNNMemoryPtr memory(new MKLDNNMemory(getEngine()));
+        memory->Create(MKLDNNMemoryDesc({compressedGemm->getPackedWeightsSize()}, memory::data_type::u8, memory::format_tag::x));
+        compressedGemm->packWeights(weightsData, static_cast<uint8_t*>(memory->GetPtr()));
+        return memory;
+    };
+
+    // the weights are shared by the streams, so are the packed ones
+    if (weightCache) {
+        char ptr[32];
+        snprintf(ptr, sizeof ptr, "%p", weightsData);
+        packedWeights = *weightCache->findOrCreate(getName() + "_packed_" + ptr, packWeights);
+    } else {
+        packedWeights = packWeights();
+    }
+}
+
+void MKLDNNFullyConnectedNode::executeCompressedGemm() {
+    const auto& srcMemory = getParentEdgeAt(DATA_ID)->getMemory();
+    const auto src = static_cast<const float*>(srcMemory.GetPtr());
+    const auto bias = withBiases ? static_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemory().GetPtr()) : nullptr;
+    auto dst = static_cast<float*>(getChildEdgeAt(0)->getMemory().GetPtr());
+
+    const size_t M = srcMemory.GetElementsCount() / decompressionParams->K;
+    compressedGemm->execute(static_cast<const uint8_t*>(packedWeights->GetPtr()), src, dst, bias, M);
+}
+
+void MKLDNNFullyConnectedNode::useSparseWeights(float threshold) {
+    // the kernel computes the plain FP32 layer without the post operations
+    if (withWeightsDecompression() || !fusedWith.empty() ||
+        getOriginalInputPrecisionAtPort(DATA_ID) != Precision::FP32 ||
+        getOriginalInputPrecisionAtPort(WEIGHTS_ID) != Precision::FP32 ||
+        getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+        return;
+
+    auto weightsNode = getParentEdgeAt(WEIGHTS_ID)->getParent();
+    auto *inputNode = dynamic_cast<MKLDNNInputNode *>(weightsNode.get());
+    if (weightsNode->getType() != Input || !weightsNode->isConstant() || !inputNode || !inputNode->getMemoryPtr())
+        return;
+
+    const auto& memory = *inputNode->getMemoryPtr();
+    weightsSparsity = SparseWeightsGemm::getSparsity(static_cast<const float*>(memory.GetPtr()), memory.GetElementsCount());
+    sparseWeights = weightsSparsity >= threshold;
+}
+
+void MKLDNNFullyConnectedNode::createSparseGemm() {
+    if (sparseGemm)
+        return;
+
+    const auto& weightsMemory = getParentEdgeAt(WEIGHTS_ID)->getMemory();
+    const auto weightsData = static_cast<const float*>(weightsMemory.GetPtr());
+    const size_t N = getParentEdgeAt(WEIGHTS_ID)->getShape().getStaticDims()[0];
+    const size_t K = weightsMemory.GetElementsCount() / N;
+    sparseGemm = std::make_shared<SparseWeightsGemm>(N, K, weightsData);
+
+    auto packWeights = [&, this] () {
+        MKLDNNMemoryPtr memory(new MKLDNNMemory(getEngine()));
+        memory->Create(MKLDNNMemoryDesc({std::max<size_t>(sparseGemm->getPackedWeightsSize(), 1)}, memory::data_type::u8, memory::format_tag::x));
+        sparseGemm->packWeights(weightsData, static_cast<uint8_t*>(memory->GetPtr()));
+        return memory;
+    };
+
+    if (weightCache) {
+        char ptr[32];
+        snprintf(ptr, sizeof ptr, "%p", weightsData);
+        packedWeights = *weightCache->findOrCreate(getName() + "_sparse_" + ptr, packWeights);
+    } else {
+        packedWeights = packWeights();
+    }
+}
+
+void MKLDNNFullyConnectedNode::executeSparseGemm() {
+    const auto& srcMemory = getParentEdgeAt(DATA_ID)->getMemory();
+    const auto src = static_cast<const float*>(srcMemory.GetPtr());
+    const auto bias = withBiases ? static_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemory().GetPtr()) : nullptr;
+    auto dst = static_cast<float*>(getChildEdgeAt(0)->getMemory().GetPtr());
+
+    const size_t K = getParentEdgeAt(WEIGHTS_ID)->getMemory().GetElementsCount() / getParentEdgeAt(WEIGHTS_ID)->getShape().getStaticDims()[0];
+    const size_t M = srcMemory.GetElementsCount() / K;
+    sparseGemm->execute(static_cast<const uint8_t*>(packedWeights->GetPtr()), src, dst, bias, M);
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
+    if (withWeightsDecompression()) {
+        createCompressedGemm();
+        return;
+    }
+    if (withSparseWeights()) {
+        createSparseGemm();
+        return;
+    }
+
     if (prim)
         return;
 
@@ -130,7 +265,7 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
     prim_desc = std::make_shared<inner_product_forward::primitive_desc>(
             createPrimitiveDescriptor<inner_product_forward::primitive_desc, inner_product_forward::desc>(*attr));
 
-    prim.reset(new inner_product_forward(*prim_desc));
+    createCachedPrimitive<inner_product_forward>(*prim_desc, *attr);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -142,7 +277,11 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
 }
 
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
-    if (prim) {
+    if (compressedGemm) {
+        executeCompressedGemm();
+    } else if (sparseGemm) {
+        executeSparseGemm();
+    } else if (prim) {
         auto reshapeMemory = [this](int argType) {
             auto param = primArgs.find(argType);
             if (param != primArgs.end()) {
@@ -165,6 +304,9 @@ void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
 }
 
 bool MKLDNNFullyConnectedNode::canFuse(const MKLDNNNodePtr& node) const {
+    // the post operations are not supported by the kernels of the compressed and sparse weights
+    if (withWeightsDecompression() || withSparseWeights())
+        return false;
     return canFuseSimpleOperation(node);
 }
 
@@ -190,6 +332,14 @@ void MKLDNNFullyConnectedNode::setPostOps(mkldnn::primitive_attr &attr, bool ini
     attr.set_post_ops(ops);
 }
 
+std::string MKLDNNFullyConnectedNode::getPrimitiveDescriptorType() {
+    auto str_type = MKLDNNNode::getPrimitiveDescriptorType();
+    // e.g. jit_avx512_FP32_sparse87, the share of the zero weights in percents
+    if (withSparseWeights())
+        str_type += "_sparse" + std::to_string(static_cast<int>(std::round(weightsSparsity * 100)));
+    return str_type;
+}
+
 bool MKLDNNFullyConnectedNode::created() const {
     return getType() == FullyConnected;
 }
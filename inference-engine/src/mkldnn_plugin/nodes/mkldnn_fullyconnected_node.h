@@ -6,6 +6,8 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include "common/compressed_weights_gemm.h"
+#include "common/sparse_weights_gemm.h"
 #include <memory>
 #include <string>
 #include <vector>
@@ -18,6 +20,7 @@ public:
 
     std::vector<mkldnn::memory::format_tag> getAvailableFormatsForDims(const Shape &dims) const override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
@@ -38,11 +41,30 @@ public:
     std::unique_ptr<MKLDNNMemoryDesc> getDstMemDesc(mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx) override;
 
     InferenceEngine::Precision getRuntimePrecision() const override;
+    std::string getPrimitiveDescriptorType() override;
 
     bool canFuse(const MKLDNNNodePtr& node) const override;
 
     static bool isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept;
 
+    /**
+     * Fuses the decompression of the I8/U8 weights: the weights stay compressed in memory and the layer is executed
+     * by the kernel that decompresses them on the fly, the activations stay in FP32
+     */
+    void fuseWeightsDecompression(const CompressedWeightsParams& params);
+    bool withWeightsDecompression() const {
+        return decompressionParams != nullptr;
+    }
+
+    /**
+     * Switches the FP32 layer with the constant weights to the kernel of the sparse weights if the share of the zero
+     * weights is not less than the threshold. Must be called before the fusing of the post operations
+     */
+    void useSparseWeights(float threshold);
+    bool withSparseWeights() const {
+        return sparseWeights;
+    }
+
 protected:
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
 
@@ -58,6 +80,18 @@ private:
 
     bool withBiases = false;
 
+    std::shared_ptr<CompressedWeightsParams> decompressionParams;
+    std::shared_ptr<CompressedWeightsGemm> compressedGemm;
+    MKLDNNMemoryPtr packedWeights;
+    void createCompressedGemm();
+    void executeCompressedGemm();
+
+    bool sparseWeights = false;
+    float weightsSparsity = 0.f;
+    std::shared_ptr<SparseWeightsGemm> sparseGemm;
+    void createSparseGemm();
+    void executeSparseGemm();
+
     std::string errorPrefix;
     static const size_t DATA_ID = 0;
     static const size_t WEIGHTS_ID = 1;
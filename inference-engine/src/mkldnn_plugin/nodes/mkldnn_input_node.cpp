@@ -19,6 +19,7 @@
 #include "common/cpu_memcpy.h"
 #include "common/cpu_convert.h"
 #include "utils/cpu_utils.hpp"
+#include "utils/mapped_file.hpp"
 #include <cpu/x64/jit_generator.hpp>
 
 using namespace mkldnn;
@@ -349,6 +350,53 @@ void MKLDNNInputNode::cloneBlobIfRequired() {
     }
 }
 
+void MKLDNNInputNode::mapToFile() {
+    if (!memoryPtr)
+        return;
+
+    auto mapBlob = [&, this] () {
+        struct MappedMemory {
+            MappedMemory(const mkldnn::engine& eng, const MKLDNNMemory& src) : file(src.GetPtr(), src.GetSize()), memory(eng) {
+                memory.Create(src.GetDesc(), file.data(), false);
+            }
+            MappedFile file;
+            MKLDNNMemory memory;
+        };
+        auto mapped = std::make_shared<MappedMemory>(getEngine(), *memoryPtr);
+        // the memory owns the mapping
+        return MKLDNNMemoryPtr(mapped, &mapped->memory);
+    };
+
+    if (weightCache) {
+        char ptr[32];
+        snprintf(ptr, sizeof ptr, "%p", memoryPtr->GetPtr());
+        MKLDNNMemoryPtr mapped = *weightCache->findOrCreate(getName() + "_mapped_" + ptr, mapBlob);
+        memoryPtr = std::const_pointer_cast<const MKLDNNMemory>(mapped);
+    } else {
+        memoryPtr = std::const_pointer_cast<const MKLDNNMemory>(mapBlob());
+    }
+    // the data is not needed anymore, the network replaces the Constant by the one sharing the mapped memory
+    constOp.reset();
+}
+
+std::shared_ptr<MKLDNNInputNode> MKLDNNInputNode::cloneConstant(const std::string &name) {
+    if (!memoryPtr)
+        IE_THROW() << "Cannot clone the node " << getName() << " without the constant data";
+
+    auto node = std::make_shared<MKLDNNInputNode>(outputShapes[0], getOriginalOutputPrecisionAtPort(0), name, "Input",
+                                                  getEngine(), weightCache);
+    node->constant = ConstantType::Const;
+    node->constOp = constOp;
+    node->memoryPtr = memoryPtr;
+    node->originalLayers = originalLayers;
+    return node;
+}
+
+void MKLDNNInputNode::shareConstant(const MKLDNNInputNode &other) {
+    memoryPtr = other.memoryPtr;
+    constOp = other.constOp;
+}
+
 MKLDNNInputNode::MKLDNNInputNode(const Shape& shape, const InferenceEngine::Precision &prc, const std::string &name,
                                  const std::string &type, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
         : MKLDNNNode(type, name, eng, cache) {
@@ -370,6 +418,10 @@ MKLDNNMemoryCPtr MKLDNNInputNode::getMemoryPtr() const {
     return memoryPtr;
 }
 
+std::shared_ptr<ngraph::op::Constant> MKLDNNInputNode::getConstOp() const {
+    return constOp;
+}
+
 void MKLDNNInputNode::getSupportedDescriptors() {
     if (getType() == Input) {
         if (!getParentEdges().empty())
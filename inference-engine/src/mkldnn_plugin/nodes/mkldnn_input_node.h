@@ -25,6 +25,26 @@ public:
     void withMeanImage();
     MKLDNNMemoryCPtr getMemoryPtr() const;
 
+    /**
+     * The Constant the node is created from, nullptr if the node is not a constant or its data is mapped to file
+     */
+    std::shared_ptr<ngraph::op::Constant> getConstOp() const;
+
+    /**
+     * Moves the constant data to a memory mapped temporary file, so the OS keeps only the hot pages resident
+     */
+    void mapToFile();
+
+    /**
+     * Creates the constant node sharing the data of this one, so a consumer of the shared constant gets its own node
+     */
+    std::shared_ptr<MKLDNNInputNode> cloneConstant(const std::string &name);
+
+    /**
+     * Takes the constant data of the other node, e.g. the data mapped to file by the node cloned from the same constant
+     */
+    void shareConstant(const MKLDNNInputNode &other);
+
 private:
     void cloneBlobIfRequired();
 
@@ -114,7 +114,7 @@ void MKLDNNLrnNode::createPrimitive() {
 
     auto prim_desc = createPrimitiveDescriptor<mkldnn::lrn_forward::primitive_desc, mkldnn::lrn_forward::desc>();
 
-    prim.reset(new mkldnn::lrn_forward(prim_desc));
+    createCachedPrimitive<mkldnn::lrn_forward>(prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -44,19 +44,44 @@ void MKLDNNReferenceNode::initSupportedPrimitiveDescriptors() {
     addSupportedPrimDesc(inputConfigurators, outputConfigurators, impl_desc_type::ref);
 }
 
-void MKLDNNReferenceNode::createPrimitive() {}
+std::atomic<size_t> MKLDNNReferenceNode::hostTensorsCount{0};
 
-void MKLDNNReferenceNode::execute(mkldnn::stream strm) {
-    ngraph::HostTensorVector inputs;
+size_t MKLDNNReferenceNode::getHostTensorsCount() {
+    return hostTensorsCount.load();
+}
+
+ngraph::HostTensorPtr MKLDNNReferenceNode::makeHostTensor(const ngraph::element::Type& type, const ngraph::Shape& shape, void* data) {
+    hostTensorsCount++;
+    return std::make_shared<ngraph::HostTensor>(type, shape, data);
+}
+
+void MKLDNNReferenceNode::bindHostTensor(ngraph::HostTensorPtr& tensor, void* data) {
+    // the wrapper doesn't allow to change the pointer, it is rare though: the memory of the edges is allocated
+    // once by the graph and is reallocated only when e.g. the output blob is set to the request
+    if (tensor->get_data_ptr() != data)
+        tensor = makeHostTensor(tensor->get_element_type(), tensor->get_shape(), data);
+}
+
+void MKLDNNReferenceNode::createPrimitive() {
+    inputs.clear();
     for (size_t i = 0; i < inputShapes.size(); i++) {
         void *srcDataPtr = getParentEdgesAtPort(i)[0]->getMemory().GetPtr();
-        inputs.push_back(std::make_shared<ngraph::HostTensor>(ngraphOp->get_input_element_type(i), ngraphOp->get_input_shape(i), srcDataPtr));
+        inputs.push_back(makeHostTensor(ngraphOp->get_input_element_type(i), ngraphOp->get_input_shape(i), srcDataPtr));
     }
 
-    ngraph::HostTensorVector outputs;
+    outputs.clear();
     for (size_t i = 0; i < outputShapes.size(); i++) {
         void *dstDataPtr = getChildEdgesAtPort(i)[0]->getMemory().GetPtr();
-        outputs.push_back(std::make_shared<ngraph::HostTensor>(ngraphOp->get_output_element_type(i), ngraphOp->get_output_shape(i), dstDataPtr));
+        outputs.push_back(makeHostTensor(ngraphOp->get_output_element_type(i), ngraphOp->get_output_shape(i), dstDataPtr));
+    }
+}
+
+void MKLDNNReferenceNode::execute(mkldnn::stream strm) {
+    for (size_t i = 0; i < inputs.size(); i++) {
+        bindHostTensor(inputs[i], getParentEdgesAtPort(i)[0]->getMemory().GetPtr());
+    }
+    for (size_t i = 0; i < outputs.size(); i++) {
+        bindHostTensor(outputs[i], getChildEdgesAtPort(i)[0]->getMemory().GetPtr());
     }
 
     if (!ngraphOp->evaluate(outputs, inputs)) {
@@ -6,6 +6,8 @@
 
 //#include <ie_common.h>
 #include <mkldnn_node.h>
+#include <ngraph/runtime/host_tensor.hpp>
+#include <atomic>
 //#include <string>
 
 namespace MKLDNNPlugin {
@@ -20,9 +22,24 @@ public:
     void execute(mkldnn::stream strm) override;
     bool created() const override;
 
+    /**
+     * @return the number of the host tensors created by the reference nodes of the process. The tensors are created
+     * by createPrimitive() and re-created by execute() only when the memory of the port is reallocated
+     */
+    static size_t getHostTensorsCount();
+
 private:
+    ngraph::HostTensorPtr makeHostTensor(const ngraph::element::Type& type, const ngraph::Shape& shape, void* data);
+    void bindHostTensor(ngraph::HostTensorPtr& tensor, void* data);
+
     const std::shared_ptr<ngraph::Node> ngraphOp;
     const std::string additionalErrorMessage;
+
+    // the tensors wrapping the memory of the ports, the element types and the shapes are resolved once
+    ngraph::HostTensorVector inputs;
+    ngraph::HostTensorVector outputs;
+
+    static std::atomic<size_t> hostTensorsCount;
 };
 
 }  // namespace MKLDNNPlugin
@@ -120,7 +120,7 @@ void MKLDNNReorderNode::createReorderPrimitive(const mkldnn::memory::desc &srcDe
         auto info = pd.impl_info_str();
         supportedPrimitiveDescriptors[0].setImplementationType(parse_impl_name(info));
 
-        prim.reset(new mkldnn::reorder(pd));
+        createCachedPrimitive<mkldnn::reorder>(pd, attr);
         return true;
     };
 
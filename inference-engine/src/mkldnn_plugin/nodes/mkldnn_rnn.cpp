@@ -683,7 +683,7 @@ void MKLDNNRNN::createDescriptor(const std::vector<const MemoryDesc*> &inputDesc
 
 void MKLDNNRNN::createPrimitive() {
     auto pd = descs[0].createPrimitiveDescriptorIterator(getEngine());
-    prim.reset(new mkldnn::primitive(pd));
+    createCachedPrimitive<mkldnn::primitive>(pd);
 }
 
 void MKLDNNRNN::execute(mkldnn::stream strm) {
@@ -83,7 +83,7 @@ void MKLDNNSoftMaxNode::createPrimitive() {
             break;
     }
 
-    prim.reset(new softmax_forward(prim_desc));
+    createCachedPrimitive<softmax_forward>(prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -24,6 +24,7 @@ public:
         readParam(blobDumpNodeType, "OV_CPU_BLOB_DUMP_NODE_TYPE");
         readParam(blobDumpNodeName, "OV_CPU_BLOB_DUMP_NODE_NAME");
         readParam(execGraphPath, "OV_CPU_EXEC_GRAPH_PATH");
+        readParam(memoryStatsPath, "OV_CPU_MEMORY_STATS_PATH");
     }
 
     std::string blobDumpDir;
@@ -33,6 +34,7 @@ public:
     std::string blobDumpNodeType;
     std::string blobDumpNodeName;
     std::string execGraphPath;
+    std::string memoryStatsPath;
 
 private:
     void readParam(std::string& param, const char* envVar) {
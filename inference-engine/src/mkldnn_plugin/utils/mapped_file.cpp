@@ -0,0 +1,98 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mapped_file.hpp"
+
+#include <ie_common.h>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+# define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cstdio>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+
+namespace MKLDNNPlugin {
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const void* data, size_t size) : _size(size) {
+    char dir[MAX_PATH + 1], path[MAX_PATH + 1];
+    if (!GetTempPathA(MAX_PATH + 1, dir) || !GetTempFileNameA(dir, "emb", 0, path))
+        IE_THROW() << "Cannot create temporary file for the memory mapping";
+
+    HANDLE file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                              FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        IE_THROW() << "Cannot open temporary file " << path << " for the memory mapping";
+    _file = file;
+
+    auto src = static_cast<const uint8_t*>(data);
+    for (size_t written = 0; written < size;) {
+        DWORD chunk = static_cast<DWORD>(std::min<size_t>(size - written, 1lu << 30)), done = 0;
+        if (!WriteFile(file, src + written, chunk, &done, nullptr) || done == 0) {
+            CloseHandle(file);
+            IE_THROW() << "Cannot write temporary file " << path << " for the memory mapping";
+        }
+        written += done;
+    }
+
+    _mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    _data = _mapping ? MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, size) : nullptr;
+    if (!_data) {
+        if (_mapping)
+            CloseHandle(_mapping);
+        CloseHandle(file);
+        IE_THROW() << "Cannot map temporary file " << path << " to memory";
+    }
+}
+
+MappedFile::~MappedFile() {
+    UnmapViewOfFile(_data);
+    CloseHandle(_mapping);
+    CloseHandle(_file);
+}
+
+#else
+
+MappedFile::MappedFile(const void* data, size_t size) : _size(size) {
+    // the file is unlinked right away, so it is removed when the mapping is released
+    FILE* file = tmpfile();
+    if (!file)
+        IE_THROW() << "Cannot create temporary file for the memory mapping";
+    const int fd = fileno(file);
+
+    auto src = static_cast<const uint8_t*>(data);
+    for (size_t written = 0; written < size;) {
+        auto done = write(fd, src + written, size - written);
+        if (done <= 0) {
+            fclose(file);
+            IE_THROW() << "Cannot write temporary file for the memory mapping";
+        }
+        written += static_cast<size_t>(done);
+    }
+
+    void* ptr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    fclose(file);
+    if (ptr == MAP_FAILED)
+        IE_THROW() << "Cannot map temporary file to memory";
+    _data = ptr;
+    // the rows of the tables are looked up in a random order, so the read ahead only wastes the memory
+    madvise(_data, size, MADV_RANDOM);
+}
+
+MappedFile::~MappedFile() {
+    munmap(_data, _size);
+}
+
+#endif
+
+}  // namespace MKLDNNPlugin
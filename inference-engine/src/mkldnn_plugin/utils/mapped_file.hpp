@@ -0,0 +1,44 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Read only copy of the data placed to a temporary file and mapped to memory. The pages are backed by the file,
+ * so the OS reads them on the first access and may evict them under memory pressure instead of keeping the whole
+ * data resident. The file is removed with the mapping
+ */
+class MappedFile {
+public:
+    typedef std::shared_ptr<MappedFile> Ptr;
+
+    MappedFile(const void* data, size_t size);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const void* data() const {
+        return _data;
+    }
+
+    size_t size() const {
+        return _size;
+    }
+
+private:
+    void* _data = nullptr;
+    size_t _size = 0;
+#ifdef _WIN32
+    void* _file = nullptr;
+    void* _mapping = nullptr;
+#endif
+};
+
+}  // namespace MKLDNNPlugin
@@ -57,6 +57,10 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     _config{config},
     _needPerfCounters{needPerfCounters} {
     _taskExecutor.reset();
+    // the policy is reported by the GetConfig even if it was not set explicitly
+    auto itPolicy = _config.emplace(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+                                    std::string{MultiDeviceConfigParams::MULTI_PRIORITY}).first;
+    _latencyAwareScheduling = itPolicy->second.as<std::string>() == MultiDeviceConfigParams::MULTI_LATENCY_AWARE;
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
@@ -76,6 +80,8 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
             itNumRequests->numRequestsPerDevices == -1) ? optimalNum : itNumRequests->numRequestsPerDevices;
         auto& workerRequests = _workerRequests[device];
         auto& idleWorkerRequests = _idleWorkerRequests[device];
+        auto* deviceStatisticsPtr = &_deviceStatistics[device];
+        deviceStatisticsPtr->_numWorkerRequests = numRequests;
         workerRequests.resize(numRequests);
         _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<ThreadSafeQueue<Task>>(new ThreadSafeQueue<Task>);
         auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
@@ -85,9 +91,13 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
             auto* workerRequestPtr = &workerRequest;
             IE_ASSERT(idleWorkerRequests.try_push(workerRequestPtr) == true);
             workerRequest._inferRequest->SetCallback(
-                [workerRequestPtr, this, device, idleWorkerRequestsPtr] (std::exception_ptr exceptionPtr) mutable {
+                [workerRequestPtr, this, device, idleWorkerRequestsPtr, deviceStatisticsPtr] (std::exception_ptr exceptionPtr) mutable {
                     IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                     workerRequestPtr->_exceptionPtr = exceptionPtr;
+                    if (nullptr == exceptionPtr) {
+                        deviceStatisticsPtr->Update(std::chrono::steady_clock::now() - workerRequestPtr->_startTime);
+                    }
+                    deviceStatisticsPtr->_numRequestsInFlight--;
                     {
                         auto capturedTask = std::move(workerRequestPtr->_task);
                         capturedTask();
@@ -112,6 +122,26 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
         std::lock_guard<std::mutex> lock(_mutex);
         return _devicePriorities;
     }();
+    if (_latencyAwareScheduling && preferred_device.empty()) {
+        // the statistics are updated concurrently, so the predictions are taken once and the snapshot is sorted
+        std::vector<std::pair<double, DeviceInformation>> predictions;
+        predictions.reserve(devices.size());
+        for (auto&& device : devices) {
+            auto itStats = _deviceStatistics.find(device.deviceName);
+            predictions.emplace_back(_deviceStatistics.end() == itStats ? 0.0 : itStats->second.PredictedCompletionMs(),
+                                     std::move(device));
+        }
+        // the stable sort keeps the priorities order for the devices with equal predictions
+        // (e.g. for the devices that have not completed any request yet)
+        std::stable_sort(predictions.begin(), predictions.end(),
+            [](const std::pair<double, DeviceInformation>& a, const std::pair<double, DeviceInformation>& b) {
+                return a.first < b.first;
+            });
+        devices.clear();
+        for (auto&& prediction : predictions) {
+            devices.push_back(std::move(prediction.second));
+        }
+    }
     for (auto&& device : devices) {
         if (!preferred_device.empty() && (device.deviceName != preferred_device))
             continue;
@@ -120,9 +150,16 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
         if (idleWorkerRequests.try_pop(workerRequestPtr)) {
             IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
             _thisWorkerInferRequest = workerRequestPtr;
-            {
+            // the request is counted before the task starts it, as the completion callback may fire at any moment after
+            auto& deviceStatistics = _deviceStatistics[device.deviceName];
+            deviceStatistics._numRequestsInFlight++;
+            workerRequestPtr->_startTime = std::chrono::steady_clock::now();
+            try {
                 auto capturedTask = std::move(inferPipelineTask);
                 capturedTask();
+            } catch (...) {
+                deviceStatistics._numRequestsInFlight--;
+                throw;
             }
             idleGuard.Release();
             return;
@@ -266,11 +303,28 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(NETWORK_NAME),
-            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            MULTI_METRIC_KEY(DEVICE_THROUGHPUT),
+            MULTI_METRIC_KEY(DEVICE_QUEUE_DEPTH)
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY };
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else if (name == MULTI_METRIC_KEY(DEVICE_THROUGHPUT)) {
+        std::map<std::string, float> throughput;
+        for (auto&& stats : _deviceStatistics) {
+            const auto averageLatencyMs = stats.second._averageLatencyMs.load(std::memory_order_relaxed);
+            throughput[stats.first] = averageLatencyMs > 0.0 ?
+                static_cast<float>(1000.0 * stats.second._numWorkerRequests / averageLatencyMs) : 0.f;
+        }
+        IE_SET_METRIC_RETURN(MULTI_DEVICE_THROUGHPUT, throughput);
+    } else if (name == MULTI_METRIC_KEY(DEVICE_QUEUE_DEPTH)) {
+        std::map<std::string, unsigned int> queueDepth;
+        for (auto&& stats : _deviceStatistics) {
+            queueDepth[stats.first] = stats.second._numRequestsInFlight.load(std::memory_order_relaxed);
+        }
+        IE_SET_METRIC_RETURN(MULTI_DEVICE_QUEUE_DEPTH, queueDepth);
     } else {
         IE_THROW() << "Unsupported Network metric: " << name;
     }
@@ -5,7 +5,11 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
@@ -37,8 +41,6 @@ using DeviceMap = std::unordered_map<DeviceName, T>;
 #if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
 template <typename T>
 using ThreadSafeQueue = tbb::concurrent_queue<T>;
-template <typename T>
-using ThreadSafeBoundedQueue = tbb::concurrent_bounded_queue<T>;
 #else
 template <typename T>
 class ThreadSafeQueue {
@@ -61,38 +63,143 @@ protected:
     std::queue<T>   _queue;
     std::mutex      _mutex;
 };
+#endif
+
+/**
+ * @brief Lock-free bounded multi-producer/multi-consumer queue (array-based, with per-cell sequence numbers).
+ * It keeps the idle worker requests, so the number of elements never exceeds the capacity passed to set_capacity.
+ * A push (pop) that meets the cell not yet released by the concurrent pop (push) waits for it rather than fails,
+ * so an idle request returned by the completion callback is never lost.
+ * @note set_capacity with a non-zero value must be called before the queue is shared between threads,
+ *       set_capacity(0) can be called at any moment and makes all subsequent try_push/try_pop calls fail
+ */
 template <typename T>
 class ThreadSafeBoundedQueue {
 public:
     ThreadSafeBoundedQueue() = default;
+    ThreadSafeBoundedQueue(const ThreadSafeBoundedQueue&) = delete;
+    ThreadSafeBoundedQueue& operator=(const ThreadSafeBoundedQueue&) = delete;
+
     bool try_push(T value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (_capacity) {
-            _queue.push(std::move(value));
+        if (!_accepting.load(std::memory_order_acquire)) {
+            return false;
+        }
+        auto pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& cell = _cells[pos & _mask];
+            const auto seq = cell._sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell._value = std::move(value);
+                    cell._sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                // the cell may still be read by the consumer that has already claimed it,
+                // the queue is full only if all the cells are claimed by the producers
+                const auto numClaimed = static_cast<std::intptr_t>(pos - _dequeuePos.load(std::memory_order_acquire));
+                if (numClaimed > static_cast<std::intptr_t>(_mask)) {
+                    return false;
+                }
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
         }
-        return _capacity;
     }
     bool try_pop(T& value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (_capacity && !_queue.empty()) {
-            value = std::move(_queue.front());
-            _queue.pop();
-            return true;
-        } else {
+        if (!_accepting.load(std::memory_order_acquire)) {
             return false;
         }
+        auto pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& cell = _cells[pos & _mask];
+            const auto seq = cell._sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    value = std::move(cell._value);
+                    cell._sequence.store(pos + _mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                // the cell may still be written by the producer that has already claimed it,
+                // the queue is empty only if none of the cells is claimed by the producers
+                const auto numClaimed = static_cast<std::intptr_t>(_enqueuePos.load(std::memory_order_acquire) - pos);
+                if (numClaimed <= 0) {
+                    return false;
+                }
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            } else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
     }
     void set_capacity(std::size_t newCapacity) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        _capacity = newCapacity;
+        if (0 == newCapacity) {
+            _accepting.store(false, std::memory_order_release);
+            return;
+        }
+        std::size_t size = 1;
+        while (size < newCapacity) {
+            size <<= 1;
+        }
+        _cells.reset(new Cell[size]);
+        for (std::size_t i = 0; i < size; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+        _mask = size - 1;
+        _enqueuePos.store(0, std::memory_order_relaxed);
+        _dequeuePos.store(0, std::memory_order_relaxed);
+        _accepting.store(true, std::memory_order_release);
+    }
+    // the value is approximate when the queue is being modified concurrently
+    std::size_t size() const {
+        const auto enqueuePos = _enqueuePos.load(std::memory_order_relaxed);
+        const auto dequeuePos = _dequeuePos.load(std::memory_order_relaxed);
+        return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
     }
 
 protected:
-    std::queue<T>   _queue;
-    std::mutex      _mutex;
-    bool            _capacity = false;
+    static constexpr std::size_t cacheLineSize = 64;
+    struct Cell {
+        std::atomic<std::size_t>    _sequence = {0};
+        T                           _value = {};
+    };
+    std::unique_ptr<Cell[]>     _cells;
+    std::size_t                 _mask = 0;
+    std::atomic<bool>           _accepting = {false};
+    char                        _pad0[cacheLineSize];
+    std::atomic<std::size_t>    _enqueuePos = {0};
+    char                        _pad1[cacheLineSize];
+    std::atomic<std::size_t>    _dequeuePos = {0};
+    char                        _pad2[cacheLineSize];
+};
+
+/**
+ * @brief Per-device statistics collected by the MULTI to drive the latency-aware scheduling and the metrics
+ */
+struct DeviceStatistics {
+    // weight of the latest sample in the moving-average latency
+    static constexpr double latencySmoothingFactor = 0.1;
+    void Update(std::chrono::steady_clock::duration latency) {
+        const double sample = std::chrono::duration<double, std::milli>(latency).count();
+        double average = _averageLatencyMs.load(std::memory_order_relaxed);
+        double updated;
+        do {
+            updated = (average <= 0.0) ? sample : average + latencySmoothingFactor * (sample - average);
+        } while (!_averageLatencyMs.compare_exchange_weak(average, updated, std::memory_order_relaxed));
+    }
+    // expected completion time (ms) of one more request, zero for the devices without any completed requests yet
+    double PredictedCompletionMs() const {
+        return _averageLatencyMs.load(std::memory_order_relaxed) *
+               (_numRequestsInFlight.load(std::memory_order_relaxed) + 1) / std::max(_numWorkerRequests, 1u);
+    }
+    std::atomic<double>         _averageLatencyMs = {0.0};
+    std::atomic<unsigned int>   _numRequestsInFlight = {0};
+    unsigned int                _numWorkerRequests = 0;
 };
-#endif
 
 class MultiDeviceExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault,
                                      public InferenceEngine::ITaskExecutor {
@@ -102,6 +209,7 @@ public:
         InferenceEngine::SoIInferRequestInternal  _inferRequest;
         InferenceEngine::Task                     _task;
         std::exception_ptr                        _exceptionPtr = nullptr;
+        std::chrono::steady_clock::time_point     _startTime;
     };
     using NotBusyWorkerRequests = ThreadSafeBoundedQueue<WorkerInferRequest*>;
 
@@ -132,6 +240,8 @@ public:
     const std::vector<DeviceInformation>                        _devicePrioritiesInitial;
     DeviceMap<InferenceEngine::SoExecutableNetworkInternal>     _networksPerDevice;
     ThreadSafeQueue<InferenceEngine::Task>                      _inferPipelineTasks;
+    DeviceMap<DeviceStatistics>                                 _deviceStatistics;
+    bool                                                        _latencyAwareScheduling = false;
     DeviceMap<std::unique_ptr<ThreadSafeQueue<InferenceEngine::Task>>> _inferPipelineTasksDeviceSpecific;
     DeviceMap<NotBusyWorkerRequests>                            _idleWorkerRequests;
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
@@ -28,7 +28,15 @@ namespace {
         }
         return config;
     }
-    std::vector<std::string> supported_configKeys = {MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES};
+    std::vector<std::string> supported_configKeys = {MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                      MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY};
+    void checkSchedulingPolicy(const std::string& policy) {
+        if (policy != MultiDeviceConfigParams::MULTI_PRIORITY && policy != MultiDeviceConfigParams::MULTI_LATENCY_AWARE) {
+            IE_THROW() << "Unsupported value for " << MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY << ": " << policy
+                       << ". Expected " << MultiDeviceConfigParams::MULTI_PRIORITY << " or "
+                       << MultiDeviceConfigParams::MULTI_LATENCY_AWARE;
+        }
+    }
 }  // namespace
 
 std::map<std::string, std::string> MultiDeviceInferencePlugin::GetSupportedConfig(
@@ -105,6 +113,9 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetConfig(const std::stri
         } else {
             return { it->second };
         }
+    } else if (name == MULTI_CONFIG_KEY(SCHEDULING_POLICY)) {
+        auto it = _config.find(MULTI_CONFIG_KEY(SCHEDULING_POLICY));
+        return { _config.end() == it ? std::string{MultiDeviceConfigParams::MULTI_PRIORITY} : it->second };
     } else {
         IE_THROW() << "Unsupported config key: " << name;
     }
@@ -113,6 +124,8 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetConfig(const std::stri
 void MultiDeviceInferencePlugin::SetConfig(const std::map<std::string, std::string> & config) {
     for (auto && kvp : config) {
         const auto& name = kvp.first;
+        if (name == MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY)
+            checkSchedulingPolicy(kvp.second);
         if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), name))
             _config[name] = kvp.second;
         else
@@ -178,6 +191,11 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(c
     // collect the settings that are applicable to the devices we are loading the network to
     std::unordered_map<std::string, InferenceEngine::Parameter> multiNetworkConfig;
     multiNetworkConfig.insert(*priorities);
+    auto schedulingPolicy = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (schedulingPolicy != fullConfig.end()) {
+        checkSchedulingPolicy(schedulingPolicy->second);
+        multiNetworkConfig.insert(*schedulingPolicy);
+    }
 
     DeviceMap<SoExecutableNetworkInternal> executableNetworkPerDevice;
     std::mutex load_mutex;
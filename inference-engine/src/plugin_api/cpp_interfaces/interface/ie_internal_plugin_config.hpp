@@ -45,6 +45,74 @@ DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
  */
 DECLARE_CONFIG_KEY(FORCE_DISABLE_CACHE);
 
+/**
+ * @brief Alignment in bytes of the activation tensors placed by the CPU plugin memory planner.
+ *        A power of two, not less than 32 (default). E.g. 64 for cache lines, 4096 for pages
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_MEMORY_ALIGNMENT);
+
+/**
+ * @brief Heuristic used by the CPU plugin to place the activation tensors in memory
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_MEMORY_PLANNER);
+DECLARE_CONFIG_VALUE(GREEDY_BY_SIZE);
+DECLARE_CONFIG_VALUE(BEST_FIT);
+DECLARE_CONFIG_VALUE(GREEDY_BY_BREADTH);
+DECLARE_CONFIG_VALUE(MIN_FOOTPRINT);
+
+/**
+ * @brief Size in bytes starting from which the CPU plugin keeps the constant embedding tables in memory mapped
+ *        temporary files, so only the hot rows stay resident. 0 (default) keeps all the tables in memory
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_EMBEDDING_TABLE_MMAP_THRESHOLD);
+
+/**
+ * @brief Enables (YES) the execution of the FullyConnected layers with the I8/U8 (and int4) weights decompressed
+ *        by Convert and Multiply (and Subtract) on the fly: the weights stay compressed in memory and the activations
+ *        stay in FP32. Targets the small batch inference limited by the memory bandwidth. NO (default) decompresses
+ *        the weights on load
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_DECOMPRESSION);
+
+/**
+ * @brief The share of the zero weights (a floating point number from 0 to 1) starting from which the CPU plugin
+ *        executes the FP32 FullyConnected layers by the kernel of the sparse weights: only the non zero weights
+ *        are kept and multiplied. 1 (default) executes all the layers with the dense weights
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SPARSE_WEIGHTS_THRESHOLD);
+
+/**
+ * @brief Enables (YES) the inference of the CPU plugin network with the input shapes other than the loaded ones
+ *        (of the same rank). On the first inference with the new shapes, the graph of the stream re-runs the shape
+ *        inference and re-creates the primitives, which are reused through the primitive cache. The activation memory
+ *        grows only when the new shapes need more. NO (default) accepts only the loaded shapes
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_INPUT_SHAPES);
+
+/**
+ * @brief Usage of the huge pages by the activation memory of the CPU plugin graphs: MADVISE advises the memory
+ *        to be backed by the transparent huge pages, HUGETLB takes it from the reserved huge pages (falling back
+ *        to MADVISE if there are not enough of them). NO (default) uses the default pages
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_HUGE_PAGES);
+DECLARE_CONFIG_VALUE(MADVISE);
+DECLARE_CONFIG_VALUE(HUGETLB);
+
+/**
+ * @brief Enables (YES) the binding of the activation memory of the CPU plugin graphs to the NUMA node of the stream
+ *        the graph is created for, so the memory is not placed on another node by the first touch. NO (default)
+ *        follows the memory policy of the process
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_NUMA_MEMORY_BINDING);
+
 }  // namespace PluginConfigInternalParams
 
 }  // namespace InferenceEngine
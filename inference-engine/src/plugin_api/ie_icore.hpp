@@ -135,6 +135,14 @@ public:
      */
     virtual bool DeviceSupportsImportExport(const std::string& deviceName) const = 0;
 
+    /**
+     * @brief Checks whether the compiled networks cache is enabled (via the CACHE_DIR config key of the Core)
+     *
+     * @return True if the networks loaded via ICore::LoadNetwork to the devices with IMPORT_EXPORT_SUPPORT
+     * are stored to (and imported from) the cache, False otherwise.
+     */
+    virtual bool IsCacheEnabled() const = 0;
+
     /**
      * @brief Default virtual destructor
      */
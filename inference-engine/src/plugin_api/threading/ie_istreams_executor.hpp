@@ -11,6 +11,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "ie_parameter.hpp"
@@ -83,6 +84,13 @@ public:
          */
         static Config MakeDefaultMultiThreaded(const Config& initial, const bool fp_intesive = true);
 
+        /**
+         * @brief Distributes the streams between the core types the same way the streams executors do
+         * @return The number of streams per core type (`BIG`, `LITTLE` or `ANY` if the cores are not distinguished),
+         * the Big cores go first
+         */
+        std::vector<std::pair<std::string, int>> GetStreamsPerCoreType() const;
+
         std::string _name;          //!< Used by `ITT` to name executor threads
         int _streams = 1;           //!< Number of streams.
         int _threadsPerStream = 0;  //!< Number of threads per stream that executes `ie_parallel` calls
@@ -4,6 +4,9 @@
 
 #include <gtest/gtest.h>
 
+#include <sstream>
+#include <string>
+
 #ifdef SELECTIVE_BUILD_ANALYZER
 # define SELECTIVE_BUILD_ANALYZER_ON
 # undef SELECTIVE_BUILD_ANALYZER
@@ -101,6 +104,29 @@ TEST(ConditionalCompilationTests, FactoryAnalysys) {
     delete node2;
 }
 
+TEST(ConditionalCompilationTests, ProfileAnalysys) {
+    int n = 0;
+    OV_SCOPE(CCTests, ProfileScope) n = 42;
+    OV_SWITCH(CCTests, TestTemplateClass, n, 1,
+    OV_CASE(0, int),
+    OV_CASE(1, bool));
+    EXPECT_EQ(n, 43);
+
+    openvino::cc::Factory<int, TestNodeBase*(int)> testFactory("ProfileFactory");
+    testFactory.registerNodeIfRequired(CCTests, TestNode0, 0, TestNode<0>);
+    testFactory.registerNodeIfRequired(CCTests, TestNode1, 1, TestNode<1>);
+    delete testFactory.createNodeIfRegistered(CCTests, 1, 42);
+
+    std::stringstream profile;
+    openvino::cc::internal::profile::instance().write(profile);
+    const std::string rows = profile.str();
+    EXPECT_NE(rows.find("SIMPLE_CCTests,ProfileScope\n"), std::string::npos);
+    EXPECT_NE(rows.find("SWITCH_CCTests,\"TestTemplateClass$OV_CASE ( 1, bool )\"\n"), std::string::npos);
+    EXPECT_NE(rows.find("FACTORY_CCTests,REG$ProfileFactory$0$TestNode0\n"), std::string::npos);
+    EXPECT_NE(rows.find("FACTORY_CCTests,CREATE$ProfileFactory$1\n"), std::string::npos);
+    EXPECT_EQ(rows.find("FACTORY_CCTests,CREATE$ProfileFactory$0\n"), std::string::npos);
+}
+
 #undef SELECTIVE_BUILD_ANALYZER
 
 #ifdef SELECTIVE_BUILD_ANALYZER_ON
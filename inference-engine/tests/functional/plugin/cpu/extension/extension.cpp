@@ -2,9 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstdio>
 #include <gtest/gtest.h>
 #include <ie_core.hpp>
 #include <ngraph/ngraph.hpp>
+#include <ngraph/opsets/opset1.hpp>
 #include <onnx_import/onnx_utils.hpp>
 #include <file_utils.h>
 #include <common_test_utils/test_assertions.hpp>
@@ -412,3 +414,63 @@ TEST(Extension, OnnxModelWithCustomReluDocsExample) {
     infer_model(ie, custom_relu_model(), input_values, expected);
     unregister_custom_relu_operator();
 }
+
+class BrokenReluKernel : public InferenceEngine::ILayerExecImpl {
+public:
+    InferenceEngine::StatusCode
+    init(InferenceEngine::LayerConfig& /*config*/, InferenceEngine::ResponseDesc* /*resp*/) noexcept override {
+        return InferenceEngine::StatusCode::OK;
+    }
+
+    InferenceEngine::StatusCode getSupportedConfigurations(std::vector<InferenceEngine::LayerConfig>& /*conf*/,
+                                                            InferenceEngine::ResponseDesc* resp) noexcept override {
+        std::snprintf(resp->msg, sizeof(resp->msg), "broken_relu kernel has no configurations");
+        return InferenceEngine::GENERAL_ERROR;
+    }
+
+    InferenceEngine::StatusCode
+    execute(std::vector<InferenceEngine::Blob::Ptr>& /*inputs*/, std::vector<InferenceEngine::Blob::Ptr>& /*outputs*/,
+            InferenceEngine::ResponseDesc* /*resp*/) noexcept override {
+        return InferenceEngine::GENERAL_ERROR;
+    }
+};
+
+class BrokenReluExtension : public InferenceEngine::IExtension {
+public:
+    void GetVersion(const InferenceEngine::Version*& versionInfo) const noexcept override {}
+
+    void Unload() noexcept override {}
+
+    std::vector<std::string> getImplTypes(const std::shared_ptr<ngraph::Node>& node) override {
+        if (node->get_friendly_name() != "broken_relu")
+            return {};
+        return {"CPU"};
+    }
+
+    InferenceEngine::ILayerImpl::Ptr getImplementation(const std::shared_ptr<ngraph::Node>& node, const std::string& implType) override {
+        return std::make_shared<BrokenReluKernel>();
+    }
+};
+
+// The nodes of the independent branches are built in parallel, the error of the node is reported by the LoadNetwork
+TEST(Extension, LoadNetworkFailsWithErrorOfNodeBuiltInParallel) {
+    auto data = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 8, 16, 16});
+    ngraph::OutputVector branches;
+    for (int i = 0; i < 8; i++) {
+        auto relu = std::make_shared<ngraph::opset1::Relu>(data);
+        relu->set_friendly_name(i == 5 ? "broken_relu" : "relu_" + std::to_string(i));
+        branches.push_back(std::make_shared<ngraph::opset1::Sigmoid>(relu));
+    }
+    auto concat = std::make_shared<ngraph::opset1::Concat>(branches, 1);
+    auto function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(concat)},
+                                                       ngraph::ParameterVector{data});
+
+    InferenceEngine::Core ie;
+    ie.AddExtension(std::make_shared<BrokenReluExtension>());
+    try {
+        ie.LoadNetwork(InferenceEngine::CNNNetwork(function), "CPU");
+        FAIL() << "The network with the broken node is loaded";
+    } catch (const InferenceEngine::Exception& error) {
+        ASSERT_NE(std::string::npos, std::string{error.what()}.find("broken_relu kernel has no configurations")) << error.what();
+    }
+}
@@ -4,6 +4,9 @@
 
 #include "behavior/core_integration.hpp"
 
+#include <functional>
+#include <blob_factory.hpp>
+
 using namespace BehaviorTestsDefinitions;
 
 using namespace InferenceEngine::PluginConfigParams;
@@ -57,6 +60,54 @@ INSTANTIATE_TEST_SUITE_P(
         smoke_IEClassGetMetricTest, IEClassGetMetricTest_RANGE_FOR_STREAMS,
         ::testing::Values("CPU"));
 
+using IEClassGetMetricTest_CPU_PRIMITIVE_CACHE = IEClassBaseTestP;
+
+TEST_P(IEClassGetMetricTest_CPU_PRIMITIVE_CACHE, GetMetricNoThrow) {
+    using Statistics = std::tuple<unsigned long long, unsigned long long, unsigned long long, unsigned long long>;
+    Core ie;
+    Parameter p;
+    unsigned long long hits = 0, misses = 0, size = 0, capacity = 0;
+
+    ie.LoadNetwork(simpleNetwork, deviceName);
+    ASSERT_NO_THROW(p = ie.GetMetric(deviceName, METRIC_KEY(CPU_PRIMITIVE_CACHE)));
+    std::tie(hits, misses, size, capacity) = p.as<Statistics>();
+    const auto hitsBefore = hits;
+
+    // the second network takes its primitives from the cache
+    ie.LoadNetwork(simpleNetwork, deviceName);
+    ASSERT_NO_THROW(p = ie.GetMetric(deviceName, METRIC_KEY(CPU_PRIMITIVE_CACHE)));
+    std::tie(hits, misses, size, capacity) = p.as<Statistics>();
+    ASSERT_GT(hits, hitsBefore);
+    ASSERT_LE(size, capacity);
+    ASSERT_METRIC_SUPPORTED(METRIC_KEY(CPU_PRIMITIVE_CACHE));
+}
+
+TEST_P(IEClassGetMetricTest_CPU_PRIMITIVE_CACHE, LoadNetworkSetsCapacity) {
+    using Statistics = std::tuple<unsigned long long, unsigned long long, unsigned long long, unsigned long long>;
+    Core ie;
+    Parameter p;
+    unsigned long long hits = 0, misses = 0, size = 0, capacity = 0;
+    ASSERT_NO_THROW(p = ie.GetMetric(deviceName, METRIC_KEY(CPU_PRIMITIVE_CACHE)));
+    std::tie(hits, misses, size, capacity) = p.as<Statistics>();
+    const auto capacityBefore = capacity;
+
+    ie.LoadNetwork(simpleNetwork, deviceName, {{CONFIG_KEY(CPU_PRIMITIVE_CACHE_CAPACITY), "1"}});
+    ASSERT_NO_THROW(p = ie.GetMetric(deviceName, METRIC_KEY(CPU_PRIMITIVE_CACHE)));
+    std::tie(hits, misses, size, capacity) = p.as<Statistics>();
+    ASSERT_EQ(1ull, capacity);
+    ASSERT_LE(size, 1ull);
+
+    // the capacity is process wide, so it is restored for the rest of the tests
+    ie.SetConfig({{CONFIG_KEY(CPU_PRIMITIVE_CACHE_CAPACITY), std::to_string(capacityBefore)}}, deviceName);
+    ASSERT_NO_THROW(p = ie.GetMetric(deviceName, METRIC_KEY(CPU_PRIMITIVE_CACHE)));
+    std::tie(hits, misses, size, capacity) = p.as<Statistics>();
+    ASSERT_EQ(capacityBefore, capacity);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+        smoke_IEClassGetMetricTest, IEClassGetMetricTest_CPU_PRIMITIVE_CACHE,
+        ::testing::Values("CPU"));
+
 INSTANTIATE_TEST_SUITE_P(
         smoke_IEClassGetMetricTest, IEClassGetMetricTest_ThrowUnsupported,
         ::testing::Values("CPU", "MULTI", "HETERO", "AUTO"));
@@ -101,6 +152,119 @@ INSTANTIATE_TEST_SUITE_P(
         smoke_IEClassExecutableNetworkGetMetricTest, IEClassExecutableNetworkGetMetricTest_ThrowsUnsupported,
         ::testing::Values("CPU", "MULTI:CPU", "HETERO:CPU", "AUTO:CPU"));
 
+using IEClassExecutableNetworkGetMetricTest_STREAMS_LAYOUT = IEClassBaseTestP;
+
+TEST_P(IEClassExecutableNetworkGetMetricTest_STREAMS_LAYOUT, GetMetricNoThrow) {
+    Core ie;
+    Parameter p;
+
+    ExecutableNetwork exeNetwork = ie.LoadNetwork(simpleNetwork, deviceName,
+        {{CONFIG_KEY(CPU_THROUGHPUT_STREAMS), CONFIG_VALUE(CPU_THROUGHPUT_AUTO)}});
+
+    ASSERT_NO_THROW(p = exeNetwork.GetMetric(EXEC_NETWORK_METRIC_KEY(STREAMS_LAYOUT)));
+    std::vector<std::string> layout = p;
+    ASSERT_FALSE(layout.empty());
+
+    unsigned int streams = 0;
+    // every entry is "<core type>:<number of streams>x<threads per stream>"
+    for (auto&& coreTypeStreams : layout) {
+        const auto colon = coreTypeStreams.find(':');
+        ASSERT_NE(std::string::npos, colon);
+        ASSERT_GT(colon, 0u);
+        const auto x = coreTypeStreams.find('x', colon);
+        ASSERT_NE(std::string::npos, x);
+        const auto coreTypeStreamsNum = std::stoul(coreTypeStreams.substr(colon + 1, x - colon - 1));
+        ASSERT_GT(coreTypeStreamsNum, 0ul);
+        ASSERT_GT(std::stoul(coreTypeStreams.substr(x + 1)), 0ul);
+        streams += coreTypeStreamsNum;
+    }
+    ASSERT_EQ(streams, exeNetwork.GetMetric(EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+    ASSERT_EXEC_METRIC_SUPPORTED(EXEC_NETWORK_METRIC_KEY(STREAMS_LAYOUT));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+        smoke_IEClassExecutableNetworkGetMetricTest, IEClassExecutableNetworkGetMetricTest_STREAMS_LAYOUT,
+        ::testing::Values("CPU"));
+
+using IEClassExecutableNetworkGetMetricTest_ZERO_COPY_OUTPUTS = IEClassBaseTestP;
+
+// Infers the network with the user output blobs of the descriptors made from the network ones,
+// returns the numbers of the zero-copy and all the pulled outputs
+std::tuple<unsigned int, unsigned int> inferWithUserOutputs(const CNNNetwork& network, const std::string& deviceName,
+                                                            const std::function<TensorDesc(const TensorDesc&)>& makeDesc,
+                                                            unsigned int inferences) {
+    Core ie;
+    ExecutableNetwork exeNetwork = ie.LoadNetwork(network, deviceName);
+    auto request = exeNetwork.CreateInferRequest();
+    for (const auto& output : exeNetwork.GetOutputsInfo()) {
+        auto blob = make_blob_with_precision(makeDesc(output.second->getTensorDesc()));
+        blob->allocate();
+        request.SetBlob(output.first, blob);
+    }
+    for (unsigned int i = 0; i < inferences; ++i) {
+        request.Infer();
+    }
+
+    Parameter p;
+    EXPECT_NO_THROW(p = exeNetwork.GetMetric(EXEC_NETWORK_METRIC_KEY(ZERO_COPY_OUTPUTS)));
+    return p.as<std::tuple<unsigned int, unsigned int>>();
+}
+
+TEST_P(IEClassExecutableNetworkGetMetricTest_ZERO_COPY_OUTPUTS, GetMetricNoThrow) {
+    Core ie;
+    Parameter p;
+
+    ExecutableNetwork exeNetwork = ie.LoadNetwork(simpleNetwork, deviceName);
+    auto request = exeNetwork.CreateInferRequest();
+    const unsigned int inferences = 3;
+    for (unsigned int i = 0; i < inferences; ++i) {
+        request.Infer();
+    }
+
+    ASSERT_NO_THROW(p = exeNetwork.GetMetric(EXEC_NETWORK_METRIC_KEY(ZERO_COPY_OUTPUTS)));
+    unsigned int zeroCopyOutputs = 0, pulledOutputs = 0;
+    std::tie(zeroCopyOutputs, pulledOutputs) = p.as<std::tuple<unsigned int, unsigned int>>();
+    ASSERT_EQ(pulledOutputs, inferences * simpleNetwork.getOutputsInfo().size());
+    ASSERT_LE(zeroCopyOutputs, pulledOutputs);
+    ASSERT_EXEC_METRIC_SUPPORTED(EXEC_NETWORK_METRIC_KEY(ZERO_COPY_OUTPUTS));
+}
+
+TEST_P(IEClassExecutableNetworkGetMetricTest_ZERO_COPY_OUTPUTS, CompatibleUserOutputsAreNotCopied) {
+    const unsigned int inferences = 3;
+    const auto expected = std::make_tuple(inferences * static_cast<unsigned int>(simpleNetwork.getOutputsInfo().size()),
+                                          inferences * static_cast<unsigned int>(simpleNetwork.getOutputsInfo().size()));
+
+    // the same descriptor as the network output
+    ASSERT_EQ(expected, inferWithUserOutputs(simpleNetwork, deviceName, [](const TensorDesc& desc) {
+        return desc;
+    }, inferences));
+
+    // the BLOCKED layout describing the same memory as the plain layout of the network output
+    ASSERT_EQ(expected, inferWithUserOutputs(simpleNetwork, deviceName, [](const TensorDesc& desc) {
+        TensorDesc blocked(desc.getPrecision(), desc.getDims(), desc.getBlockingDesc());
+        EXPECT_EQ(Layout::BLOCKED, blocked.getLayout());
+        return blocked;
+    }, inferences));
+}
+
+TEST_P(IEClassExecutableNetworkGetMetricTest_ZERO_COPY_OUTPUTS, IncompatibleUserOutputsAreCopied) {
+    const unsigned int inferences = 3;
+    for (const auto& output : simpleNetwork.getOutputsInfo()) {
+        ASSERT_EQ(Layout::NCHW, output.second->getTensorDesc().getLayout());
+    }
+
+    // the channels last memory of the user blob differs from the plain memory of the network output
+    const auto counts = inferWithUserOutputs(simpleNetwork, deviceName, [](const TensorDesc& desc) {
+        return TensorDesc(desc.getPrecision(), desc.getDims(), Layout::NHWC);
+    }, inferences);
+    ASSERT_EQ(0u, std::get<0>(counts));
+    ASSERT_EQ(inferences * simpleNetwork.getOutputsInfo().size(), std::get<1>(counts));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+        smoke_IEClassExecutableNetworkGetMetricTest, IEClassExecutableNetworkGetMetricTest_ZERO_COPY_OUTPUTS,
+        ::testing::Values("CPU"));
+
 //
 // Executable Network GetConfig / SetConfig
 //
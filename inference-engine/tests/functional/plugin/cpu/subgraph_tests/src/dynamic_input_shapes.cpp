@@ -0,0 +1,188 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/data_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include <blob_factory.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+using DynamicInputShapesParams = std::tuple<
+        std::vector<size_t>,    // inferred sequence lengths
+        size_t>;                // loaded sequence length
+
+/* The request of the network loaded with the dynamic input shapes infers the sequences of other lengths,
+   the output blob follows the shape of the input
+
+    Parameter [1, L, K]   Constant [K, N]
+              \              /
+                  MatMul        Constant [N]
+                       \          /
+                           Add
+                            |
+                           Relu
+*/
+class DynamicInputShapesTest : public testing::WithParamInterface<DynamicInputShapesParams>,
+                             virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<DynamicInputShapesParams> obj) {
+        std::vector<size_t> inferredLengths;
+        size_t loadedLength;
+        std::tie(inferredLengths, loadedLength) = obj.param;
+
+        std::ostringstream result;
+        result << "inferredLengths=" << CommonTestUtils::vec2str(inferredLengths) << "_";
+        result << "loadedLength=" << loadedLength;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[PluginConfigParams::KEY_ENFORCE_BF16] = PluginConfigParams::NO;
+
+        configuration[PluginConfigInternalParams::KEY_CPU_DYNAMIC_INPUT_SHAPES] = PluginConfigParams::YES;
+        const auto loadedLength = std::get<1>(this->GetParam());
+
+        weightsValues = CommonTestUtils::generate_float_numbers(K * N, -1.f, 1.f);
+        biasValues = CommonTestUtils::generate_float_numbers(N, -1.f, 1.f);
+        function = makeFunction(loadedLength);
+    }
+
+    std::shared_ptr<Function> makeFunction(size_t length) const {
+        auto params = builder::makeParams(element::f32, {{1, length, K}});
+        params[0]->set_friendly_name("sequence");
+        auto weights = opset1::Constant::create(element::f32, Shape{K, N}, weightsValues);
+        auto matMul = std::make_shared<opset1::MatMul>(params[0], weights);
+        auto bias = opset1::Constant::create(element::f32, Shape{N}, biasValues);
+        auto add = std::make_shared<opset1::Add>(matMul, bias);
+        auto relu = std::make_shared<opset1::Relu>(add);
+        return std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(relu)}, params, "DynamicInputShapes");
+    }
+
+    void Infer() override {
+        inferRequest = executableNetwork.CreateInferRequest();
+        const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+        const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+
+        // the lengths alternate with the loaded one to re-create the graph back and forth
+        auto lengths = std::get<0>(this->GetParam());
+        lengths.push_back(std::get<1>(this->GetParam()));
+        const std::vector<size_t> reversed(lengths.rbegin(), lengths.rend());
+        lengths.insert(lengths.end(), reversed.begin(), reversed.end());
+        for (size_t i = 0; i < lengths.size(); i++) {
+            function = makeFunction(lengths[i]);
+
+            inputs = {makeSequence(lengths[i], static_cast<int>(i))};
+            inferRequest.SetBlob(inputName, inputs[0]);
+            inferRequest.Infer();
+
+            ASSERT_EQ(SizeVector({1, lengths[i], N}), inferRequest.GetBlob(outputName)->getTensorDesc().getDims());
+            LayerTestsCommon::Validate();
+        }
+    }
+
+    static Blob::Ptr makeSequence(size_t length, int seed) {
+        auto blob = make_blob_with_precision(TensorDesc(Precision::FP32, {1, length, K}, Layout::CHW));
+        blob->allocate();
+        CommonTestUtils::fill_data_random<Precision::FP32>(blob, 10, -5, 1, seed);
+        return blob;
+    }
+
+    void Validate() override {
+        // the outputs are validated by Infer() for every length
+    }
+
+    static constexpr size_t K = 24;
+    static constexpr size_t N = 40;
+    std::vector<float> weightsValues;
+    std::vector<float> biasValues;
+};
+
+TEST_P(DynamicInputShapesTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+TEST_P(DynamicInputShapesTest, DifferentRankIsRejected) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    inferRequest = executableNetwork.CreateInferRequest();
+    auto blob = make_blob_with_precision(TensorDesc(Precision::FP32, {1, 1, 3, K}, Layout::NCHW));
+    blob->allocate();
+    ASSERT_ANY_THROW(inferRequest.SetBlob(executableNetwork.GetInputsInfo().begin()->first, blob));
+}
+
+TEST_P(DynamicInputShapesTest, UserOutputIsKept) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    inferRequest = executableNetwork.CreateInferRequest();
+    const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+    const auto length = std::get<0>(this->GetParam()).front();
+    auto output = make_blob_with_precision(TensorDesc(Precision::FP32, {1, length, N}, Layout::CHW));
+    output->allocate();
+    inferRequest.SetBlob(outputName, output);
+
+    // the user blob of the other output shape isn't replaced silently
+    inferRequest.SetBlob(inputName, makeSequence(std::get<1>(this->GetParam()), 0));
+    ASSERT_THROW(inferRequest.Infer(), ParameterMismatch);
+
+    inferRequest.SetBlob(inputName, makeSequence(length, 0));
+    inferRequest.Infer();
+    ASSERT_EQ(output, inferRequest.GetBlob(outputName));
+}
+
+TEST_P(DynamicInputShapesTest, RequestsOfStreamsInferOtherShapes) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = "2";
+    LoadNetwork();
+    const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+    const auto& lengths = std::get<0>(this->GetParam());
+    std::vector<InferRequest> requests;
+    for (size_t i = 0; i < lengths.size(); i++) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+        requests.back().SetBlob(inputName, makeSequence(lengths[i], static_cast<int>(i)));
+        requests.back().StartAsync();
+    }
+    for (size_t i = 0; i < lengths.size(); i++) {
+        requests[i].Wait(InferRequest::WaitMode::RESULT_READY);
+        ASSERT_EQ(SizeVector({1, lengths[i], N}), requests[i].GetBlob(outputName)->getTensorDesc().getDims());
+    }
+}
+
+TEST(DynamicInputShapesConfigTest, DynamicBatchIsRejected) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto params = builder::makeParams(element::f32, {{1, 5, 24}});
+    auto relu = std::make_shared<opset1::Relu>(params[0]);
+    CNNNetwork network(std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(relu)}, params));
+    auto ie = PluginCache::get().ie();
+    ASSERT_ANY_THROW(ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                     {{PluginConfigInternalParams::KEY_CPU_DYNAMIC_INPUT_SHAPES, PluginConfigParams::YES},
+                                      {PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::YES}}));
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_DynamicInputShapes, DynamicInputShapesTest,
+                         ::testing::Combine(
+                                 ::testing::Values(std::vector<size_t>{7}, std::vector<size_t>{7, 3, 16, 25}),
+                                 ::testing::Values(5, 16)),
+                         DynamicInputShapesTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,177 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include <ngraph/runtime/shared_buffer.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+enum class EmbeddingType {
+    OffsetsSum,
+    PackedSum,
+    SegmentsSum
+};
+
+using EmbeddingBagQuantizedTableParams = std::tuple<
+        EmbeddingType,          // embedding operation
+        element::Type,          // table precision
+        bool,                   // with zero points
+        bool>;                  // table is mapped to file
+
+/* The dequantization of the quantized table is fused into the embedding node
+
+    Constant[I8/U8]
+          |
+    Convert[FP32]    Constant[FP32] (per row zero points)
+           \          /
+           Subtract[FP32]    Constant[FP32] (per row scales)
+                   \          /
+                   Multiply[FP32]         Parameter[FP32] (per sample weights)
+                          \                /
+                   EmbeddingBag*Sum / EmbeddingSegmentsSum
+*/
+class EmbeddingBagQuantizedTableTest : public testing::WithParamInterface<EmbeddingBagQuantizedTableParams>,
+                                       virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<EmbeddingBagQuantizedTableParams> obj) {
+        EmbeddingType type;
+        element::Type tablePrc;
+        bool withZeroPoints, mapped;
+        std::tie(type, tablePrc, withZeroPoints, mapped) = obj.param;
+
+        std::ostringstream result;
+        result << (type == EmbeddingType::OffsetsSum ? "OffsetsSum" : type == EmbeddingType::PackedSum ? "PackedSum" : "SegmentsSum") << "_";
+        result << "tablePRC=" << tablePrc << "_";
+        result << "ZP=" << withZeroPoints << "_";
+        result << "mapped=" << mapped;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        EmbeddingType type;
+        element::Type tablePrc;
+        bool withZeroPoints, mapped;
+        std::tie(type, tablePrc, withZeroPoints, mapped) = this->GetParam();
+        if (mapped)
+            configuration[PluginConfigInternalParams::KEY_CPU_EMBEDDING_TABLE_MMAP_THRESHOLD] = "1";
+
+        const size_t rows = 20, depth = 37;
+        const std::vector<int32_t> indices = {0, 19, 7, 7, 3, 12, 18, 5, 1, 9, 2, 4};
+
+        std::shared_ptr<Node> table = builder::makeConstant<int32_t>(tablePrc, {rows, depth}, {}, true, 100, tablePrc == element::i8 ? -100 : 0);
+        table = std::make_shared<opset1::Convert>(table, element::f32);
+        if (withZeroPoints) {
+            auto zeroPoints = builder::makeConstant<float>(element::f32, {rows, 1}, {}, true, 10, -10);
+            table = std::make_shared<opset1::Subtract>(table, zeroPoints);
+        }
+        auto scales = builder::makeConstant<float>(element::f32, {rows, 1}, {}, true, 0.1f, 0.001f);
+        table = std::make_shared<opset1::Multiply>(table, scales);
+
+        std::shared_ptr<Node> embedding;
+        ParameterVector params;
+        if (type == EmbeddingType::PackedSum) {
+            params = builder::makeParams(element::f32, {{4, 3}});
+            auto indicesNode = opset1::Constant::create(element::i32, {4, 3}, indices);
+            embedding = std::make_shared<opset3::EmbeddingBagPackedSum>(table, indicesNode, params[0]);
+        } else if (type == EmbeddingType::OffsetsSum) {
+            params = builder::makeParams(element::f32, {{indices.size()}});
+            auto indicesNode = opset1::Constant::create(element::i32, {indices.size()}, indices);
+            auto offsetsNode = opset1::Constant::create(element::i32, {4}, {0, 2, 2, 9});
+            auto defaultIndexNode = opset1::Constant::create(element::i32, {}, {11});
+            embedding = std::make_shared<opset3::EmbeddingBagOffsetsSum>(table, indicesNode, offsetsNode, defaultIndexNode, params[0]);
+        } else {
+            params = builder::makeParams(element::f32, {{indices.size()}});
+            auto indicesNode = opset1::Constant::create(element::i32, {indices.size()}, indices);
+            auto segmentIdsNode = opset1::Constant::create(element::i32, {indices.size()}, {0, 0, 0, 1, 1, 1, 1, 3, 3, 3, 3, 3});
+            auto numSegmentsNode = opset1::Constant::create(element::i32, {}, {5});
+            auto defaultIndexNode = opset1::Constant::create(element::i32, {}, {11});
+            embedding = std::make_shared<opset3::EmbeddingSegmentsSum>(table, indicesNode, segmentIdsNode, numSegmentsNode,
+                                                                       defaultIndexNode, params[0]);
+        }
+
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(embedding)}, params, "EmbeddingBagQuantizedTable");
+    }
+};
+
+TEST_P(EmbeddingBagQuantizedTableTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+    CheckNodeOfTypeCount(executableNetwork, "Eltwise", 0);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagQuantizedTable, EmbeddingBagQuantizedTableTest,
+                         ::testing::Combine(
+                                 ::testing::Values(EmbeddingType::OffsetsSum, EmbeddingType::PackedSum, EmbeddingType::SegmentsSum),
+                                 ::testing::Values(element::i8, element::u8),
+                                 ::testing::Bool(),
+                                 ::testing::Bool()),
+                         EmbeddingBagQuantizedTableTest::getTestCaseName);
+
+} // namespace
+
+// The data of the table mapped to file is not kept by the executable network
+TEST(EmbeddingBagMappedTableTest, ConstantDataIsReleased) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const size_t rows = 20, depth = 37;
+    const std::vector<int32_t> indices = {0, 19, 7, 7, 3, 12};
+    const std::vector<int32_t> offsets = {0, 2, 2, 5};
+
+    auto tableData = std::make_shared<std::vector<float>>(rows * depth);
+    for (size_t i = 0; i < tableData->size(); i++)
+        (*tableData)[i] = static_cast<float>(static_cast<int>(i % 23) - 11) / 8.f;
+    const std::vector<float> table = *tableData;
+    std::weak_ptr<std::vector<float>> tableDataRef = tableData;
+
+    ExecutableNetwork execNetwork;
+    {
+        auto buffer = std::make_shared<runtime::SharedBuffer<std::shared_ptr<std::vector<float>>>>(
+                reinterpret_cast<char*>(tableData->data()), tableData->size() * sizeof(float), tableData);
+        tableData.reset();
+        auto tableNode = std::make_shared<opset1::Constant>(element::f32, Shape{rows, depth}, buffer);
+        auto indicesNode = std::make_shared<opset1::Parameter>(element::i32, Shape{indices.size()});
+        auto offsetsNode = opset1::Constant::create(element::i32, {offsets.size()}, offsets);
+        auto embedding = std::make_shared<opset3::EmbeddingBagOffsetsSum>(tableNode, indicesNode, offsetsNode);
+        auto function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(embedding)},
+                                                   ParameterVector{indicesNode}, "EmbeddingBagMappedTable");
+
+        Core core;
+        execNetwork = core.LoadNetwork(CNNNetwork(function), CommonTestUtils::DEVICE_CPU,
+                                       {{PluginConfigInternalParams::KEY_CPU_EMBEDDING_TABLE_MMAP_THRESHOLD, "1"}});
+    }
+    EXPECT_TRUE(tableDataRef.expired());
+
+    auto request = execNetwork.CreateInferRequest();
+    auto input = request.GetBlob(execNetwork.GetInputsInfo().begin()->first);
+    std::copy(indices.begin(), indices.end(), input->buffer().as<int32_t*>());
+    request.Infer();
+    auto output = request.GetBlob(execNetwork.GetOutputsInfo().begin()->first);
+    ASSERT_EQ(offsets.size() * depth, output->size());
+    auto outputData = output->cbuffer().as<const float*>();
+    for (size_t bag = 0; bag < offsets.size(); bag++) {
+        const size_t end = bag + 1 < offsets.size() ? offsets[bag + 1] : indices.size();
+        for (size_t d = 0; d < depth; d++) {
+            float expected = 0.f;
+            for (size_t i = offsets[bag]; i < end; i++)
+                expected += table[indices[i] * depth + d];
+            EXPECT_FLOAT_EQ(expected, outputData[bag * depth + d]) << "bag " << bag << " element " << d;
+        }
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
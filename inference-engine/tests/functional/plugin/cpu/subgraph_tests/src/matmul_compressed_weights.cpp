@@ -0,0 +1,119 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using MatMulCompressedWeightsParams = std::tuple<
+        element::Type,          // weights precision
+        bool,                   // transpose_b
+        size_t,                 // number of the groups
+        bool,                   // with zero points
+        size_t>;                // batch
+
+/* The decompression of the weights is fused into the FullyConnected node
+
+    Constant[I8/U8]
+          |
+    Convert[FP32]    Constant[FP32] (zero points)
+           \          /
+           Subtract[FP32]    Constant[FP32] (scales per output channel and group)
+                   \          /
+                   Multiply[FP32]
+                        |
+    Parameter      Reshape (grouped weights)
+           \          /
+             MatMul
+*/
+class MatMulCompressedWeightsTest : public testing::WithParamInterface<MatMulCompressedWeightsParams>,
+                                    virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MatMulCompressedWeightsParams> obj) {
+        element::Type weightsPrc;
+        bool transposeB, withZeroPoints;
+        size_t groups, batch;
+        std::tie(weightsPrc, transposeB, groups, withZeroPoints, batch) = obj.param;
+
+        std::ostringstream result;
+        result << "weightsPRC=" << weightsPrc << "_";
+        result << "transposeB=" << transposeB << "_";
+        result << "groups=" << groups << "_";
+        result << "ZP=" << withZeroPoints << "_";
+        result << "batch=" << batch;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[PluginConfigInternalParams::KEY_CPU_WEIGHTS_DECOMPRESSION] = PluginConfigParams::YES;
+
+        element::Type weightsPrc;
+        bool transposeB, withZeroPoints;
+        size_t groups, batch;
+        std::tie(weightsPrc, transposeB, groups, withZeroPoints, batch) = this->GetParam();
+
+        const size_t N = 35, K = 64;
+        auto params = builder::makeParams(element::f32, {{batch, K}});
+
+        // the groups are laid out along the input channels
+        std::vector<size_t> weightsShape, paramsShape;
+        if (groups == 1) {
+            weightsShape = transposeB ? std::vector<size_t>{N, K} : std::vector<size_t>{K, N};
+            paramsShape = transposeB ? std::vector<size_t>{N, 1} : std::vector<size_t>{1, N};
+        } else {
+            weightsShape = transposeB ? std::vector<size_t>{N, groups, K / groups} : std::vector<size_t>{groups, K / groups, N};
+            paramsShape = transposeB ? std::vector<size_t>{N, groups, 1} : std::vector<size_t>{groups, 1, N};
+        }
+
+        std::shared_ptr<Node> weights = builder::makeConstant<int32_t>(weightsPrc, weightsShape, {}, true, 100, weightsPrc == element::i8 ? -100 : 0);
+        weights = std::make_shared<opset1::Convert>(weights, element::f32);
+        if (withZeroPoints) {
+            auto zeroPoints = builder::makeConstant<float>(element::f32, paramsShape, {}, true, 10, -10);
+            weights = std::make_shared<opset1::Subtract>(weights, zeroPoints);
+        }
+        auto scales = builder::makeConstant<float>(element::f32, paramsShape, {}, true, 0.1f, 0.001f);
+        weights = std::make_shared<opset1::Multiply>(weights, scales);
+        if (groups != 1) {
+            auto shape = opset1::Constant::create(element::i64, {2}, transposeB ? std::vector<size_t>{N, K} : std::vector<size_t>{K, N});
+            weights = std::make_shared<opset1::Reshape>(weights, shape, false);
+        }
+
+        auto matMul = std::make_shared<opset1::MatMul>(params[0], weights, false, transposeB);
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(matMul)}, params, "MatMulCompressedWeights");
+    }
+};
+
+TEST_P(MatMulCompressedWeightsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+    CheckNodeOfTypeCount(executableNetwork, "Eltwise", 0);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights, MatMulCompressedWeightsTest,
+                         ::testing::Combine(
+                                 ::testing::Values(element::i8, element::u8),
+                                 ::testing::Bool(),
+                                 ::testing::Values(1, 4),
+                                 ::testing::Bool(),
+                                 ::testing::Values(1, 7)),
+                         MatMulCompressedWeightsTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
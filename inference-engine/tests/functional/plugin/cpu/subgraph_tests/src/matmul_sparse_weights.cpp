@@ -0,0 +1,108 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using MatMulSparseWeightsParams = std::tuple<
+        float,                  // share of the zero weights
+        std::string,            // threshold of the sparse kernel
+        bool,                   // transpose_b
+        size_t>;                // batch
+
+/* The FullyConnected layer with the pruned weights is executed by the kernel of the sparse weights
+   when the share of the zero weights is not less than the threshold
+
+    Parameter    Constant[FP32] (pruned weights)
+           \          /
+             MatMul
+*/
+class MatMulSparseWeightsTest : public testing::WithParamInterface<MatMulSparseWeightsParams>,
+                                virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MatMulSparseWeightsParams> obj) {
+        float sparsity;
+        std::string threshold;
+        bool transposeB;
+        size_t batch;
+        std::tie(sparsity, threshold, transposeB, batch) = obj.param;
+
+        std::ostringstream result;
+        result << "sparsity=" << sparsity << "_";
+        result << "threshold=" << threshold << "_";
+        result << "transposeB=" << transposeB << "_";
+        result << "batch=" << batch;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[PluginConfigParams::KEY_PERF_COUNT] = PluginConfigParams::YES;
+        // the sparse kernel is implemented for FP32 only
+        configuration[PluginConfigParams::KEY_ENFORCE_BF16] = PluginConfigParams::NO;
+
+        float sparsity;
+        std::string threshold;
+        bool transposeB;
+        size_t batch;
+        std::tie(sparsity, threshold, transposeB, batch) = this->GetParam();
+        configuration[PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD] = threshold;
+        expectSparse = sparsity >= std::stof(threshold) && std::stof(threshold) < 1.f;
+
+        const size_t N = 70, K = 96;
+        auto params = builder::makeParams(element::f32, {{batch, K}});
+
+        std::vector<float> weightsValues(N * K);
+        const auto randomValues = CommonTestUtils::generate_float_numbers(N * K, -1.f, 1.f);
+        const size_t nonZeros = static_cast<size_t>(N * K * (1.f - sparsity));
+        for (size_t i = 0; i < nonZeros; i++) {
+            // spread the non zero weights over the tensor
+            weightsValues[(i * 7919) % (N * K)] = randomValues[i];
+        }
+        auto weights = opset1::Constant::create(element::f32, transposeB ? Shape{N, K} : Shape{K, N}, weightsValues);
+
+        auto matMul = std::make_shared<opset1::MatMul>(params[0], weights, false, transposeB);
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(matMul)}, params, "MatMulSparseWeights");
+    }
+
+    bool expectSparse = false;
+};
+
+TEST_P(MatMulSparseWeightsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+
+    bool isSparse = false;
+    for (const auto& counter : inferRequest.GetPerformanceCounts()) {
+        if (std::string(counter.second.layer_type) == "FullyConnected")
+            isSparse = std::string(counter.second.exec_type).find("_sparse") != std::string::npos;
+    }
+    ASSERT_EQ(expectSparse, isSparse);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulSparseWeights, MatMulSparseWeightsTest,
+                         ::testing::Combine(
+                                 ::testing::Values(0.5f, 0.9f),
+                                 ::testing::Values("0.8", "1"),
+                                 ::testing::Bool(),
+                                 ::testing::Values(1, 7)),
+                         MatMulSparseWeightsTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,77 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+using MemoryPlacementParams = std::tuple<
+        std::string,            // huge pages
+        std::string>;           // NUMA memory binding
+
+/* The activations are bigger than a huge page, so the graph workspace is mapped with the requested placement.
+   The huge pages and the NUMA binding are not guaranteed by the system, so only the results are compared
+
+    Parameter [1, 16, 128, 128]
+              |
+             Relu    Constant [1, 16, 1, 1]
+                \      /
+                Multiply
+                   |
+                Sigmoid
+*/
+class MemoryPlacementTest : public testing::WithParamInterface<MemoryPlacementParams>,
+                            virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MemoryPlacementParams> obj) {
+        std::string hugePages, numaBinding;
+        std::tie(hugePages, numaBinding) = obj.param;
+
+        std::ostringstream result;
+        result << "hugePages=" << hugePages << "_";
+        result << "numaBinding=" << numaBinding;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[PluginConfigParams::KEY_ENFORCE_BF16] = PluginConfigParams::NO;
+        std::tie(configuration[PluginConfigInternalParams::KEY_CPU_HUGE_PAGES],
+                 configuration[PluginConfigInternalParams::KEY_CPU_NUMA_MEMORY_BINDING]) = this->GetParam();
+
+        auto params = builder::makeParams(element::f32, {{1, 16, 128, 128}});
+        auto relu = std::make_shared<opset1::Relu>(params[0]);
+        auto scale = builder::makeConstant<float>(element::f32, {1, 16, 1, 1}, {}, true);
+        auto multiply = std::make_shared<opset1::Multiply>(relu, scale);
+        auto sigmoid = std::make_shared<opset1::Sigmoid>(multiply);
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(sigmoid)}, params, "MemoryPlacement");
+    }
+};
+
+TEST_P(MemoryPlacementTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_MemoryPlacement, MemoryPlacementTest,
+                         ::testing::Combine(
+                                 ::testing::Values(PluginConfigParams::NO,
+                                                   PluginConfigInternalParams::MADVISE,
+                                                   PluginConfigInternalParams::HUGETLB),
+                                 ::testing::Values(PluginConfigParams::NO, PluginConfigParams::YES)),
+                         MemoryPlacementTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
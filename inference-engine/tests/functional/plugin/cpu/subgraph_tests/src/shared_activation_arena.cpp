@@ -0,0 +1,92 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+/* Two networks of the different activation sizes are loaded to the single stream with the shared activation arena,
+   their inferences interleave and overwrite the activations of each other in the arena
+
+    Parameter [1, C, H, W]
+              |
+             Relu    Constant [1, C, 1, 1]
+                \      /
+                Multiply
+                   |
+                Sigmoid
+*/
+class SharedActivationArenaTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[PluginConfigParams::KEY_ENFORCE_BF16] = PluginConfigParams::NO;
+        configuration[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = "1";
+        configuration[PluginConfigParams::KEY_CPU_SHARED_ACTIVATION_ARENA] = PluginConfigParams::YES;
+    }
+
+    static std::shared_ptr<Function> makeFunction(const std::vector<size_t>& shape) {
+        auto params = builder::makeParams(element::f32, {shape});
+        auto relu = std::make_shared<opset1::Relu>(params[0]);
+        auto scale = builder::makeConstant<float>(element::f32, {1, shape[1], 1, 1}, {}, true);
+        auto multiply = std::make_shared<opset1::Multiply>(relu, scale);
+        auto sigmoid = std::make_shared<opset1::Sigmoid>(multiply);
+        return std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(sigmoid)}, params, "SharedActivationArena");
+    }
+
+    // the allocated memory of the arenas and the memory the networks would take without them
+    std::tuple<unsigned long long, unsigned long long> arenasMemory() {
+        return core->GetMetric(targetDevice, METRIC_KEY(CPU_ACTIVATION_ARENAS_MEMORY))
+                   .as<std::tuple<unsigned long long, unsigned long long>>();
+    }
+};
+
+TEST_F(SharedActivationArenaTest, NetworksOfStreamShareArena) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ASSERT_EQ(std::make_tuple(0ull, 0ull), arenasMemory());
+
+    std::vector<std::pair<std::shared_ptr<Function>, ExecutableNetwork>> networks;
+    function = makeFunction({1, 16, 64, 64});
+    LoadNetwork();
+    networks.emplace_back(function, executableNetwork);
+
+    unsigned long long allocated = 0, requested = 0;
+    std::tie(allocated, requested) = arenasMemory();
+    const auto firstRequested = requested;
+    ASSERT_GT(firstRequested, 0ull);
+    ASSERT_EQ(firstRequested, allocated);
+
+    function = makeFunction({1, 8, 48, 48});
+    LoadNetwork();
+    networks.emplace_back(function, executableNetwork);
+
+    // the arena keeps the maximum of the activation memory of the networks, not the sum
+    std::tie(allocated, requested) = arenasMemory();
+    ASSERT_GT(requested, firstRequested);
+    ASSERT_EQ(std::max(firstRequested, requested - firstRequested), allocated);
+
+    for (int i = 0; i < 3; i++) {
+        for (const auto& network : networks) {
+            std::tie(function, executableNetwork) = network;
+            inputs.clear();
+            GenerateInputs();
+            Infer();
+            Validate();
+        }
+    }
+
+    // the memory is returned once the networks are released
+    networks.clear();
+    executableNetwork = {};
+    inferRequest = {};
+    ASSERT_EQ(std::make_tuple(0ull, 0ull), arenasMemory());
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,139 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+enum class SharedConstantsFusion {
+    ConvolutionAndBias,
+    FullyConnectedAndWeightsDecompression,
+    EmbeddingBagAndDequantization
+};
+
+/* The branches have the constants of the same content, which are merged by the ConstantDeduplication.
+   The constant inputs are still fused into the nodes of both branches.
+
+                  Parameter
+                 /         \
+    Branch(Constants)     Branch(Constants)
+                 \         /
+                   Concat
+*/
+class SharedConstantsFusingTest : public testing::WithParamInterface<SharedConstantsFusion>,
+                                  virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<SharedConstantsFusion> obj) {
+        switch (obj.param) {
+            case SharedConstantsFusion::ConvolutionAndBias: return "ConvolutionAndBias";
+            case SharedConstantsFusion::FullyConnectedAndWeightsDecompression: return "FullyConnectedAndWeightsDecompression";
+            default: return "EmbeddingBagAndDequantization";
+        }
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        fusion = this->GetParam();
+
+        ParameterVector params;
+        std::function<std::shared_ptr<Node>()> makeBranch;
+        if (fusion == SharedConstantsFusion::ConvolutionAndBias) {
+            const size_t channels = 8;
+            params = builder::makeParams(element::f32, {{1, channels, 10, 10}});
+            const auto weights = values(channels * channels * 3 * 3, 0.1f);
+            const auto bias = values(channels, 1.f);
+            makeBranch = [=]() -> std::shared_ptr<Node> {
+                auto conv = std::make_shared<opset1::Convolution>(params[0],
+                                                                  opset1::Constant::create(element::f32, {channels, channels, 3, 3}, weights),
+                                                                  Strides{1, 1}, CoordinateDiff{1, 1}, CoordinateDiff{1, 1}, Strides{1, 1});
+                return std::make_shared<opset1::Add>(conv, opset1::Constant::create(element::f32, {1, channels, 1, 1}, bias));
+            };
+        } else if (fusion == SharedConstantsFusion::FullyConnectedAndWeightsDecompression) {
+            configuration[PluginConfigInternalParams::KEY_CPU_WEIGHTS_DECOMPRESSION] = PluginConfigParams::YES;
+            const size_t N = 35, K = 64;
+            params = builder::makeParams(element::f32, {{3, K}});
+            const auto weights = values(N * K, 1.f, 100);
+            const auto zeroPoints = values(N, 1.f, 10);
+            const auto scales = values(N, 0.01f);
+            makeBranch = [=]() -> std::shared_ptr<Node> {
+                std::shared_ptr<Node> decompressed = std::make_shared<opset1::Convert>(
+                        opset1::Constant::create(element::i8, {N, K}, weights), element::f32);
+                decompressed = std::make_shared<opset1::Subtract>(decompressed, opset1::Constant::create(element::f32, {N, 1}, zeroPoints));
+                decompressed = std::make_shared<opset1::Multiply>(decompressed, opset1::Constant::create(element::f32, {N, 1}, scales));
+                return std::make_shared<opset1::MatMul>(params[0], decompressed, false, true);
+            };
+        } else {
+            const size_t rows = 20, depth = 37;
+            const std::vector<int32_t> indices = {0, 19, 7, 7, 3, 12, 18, 5, 1, 9, 2, 4};
+            params = builder::makeParams(element::f32, {{indices.size()}});
+            const auto table = values(rows * depth, 1.f, 100);
+            const auto zeroPoints = values(rows, 1.f, 10);
+            const auto scales = values(rows, 0.01f);
+            makeBranch = [=]() -> std::shared_ptr<Node> {
+                std::shared_ptr<Node> decompressed = std::make_shared<opset1::Convert>(
+                        opset1::Constant::create(element::i8, {rows, depth}, table), element::f32);
+                decompressed = std::make_shared<opset1::Subtract>(decompressed, opset1::Constant::create(element::f32, {rows, 1}, zeroPoints));
+                decompressed = std::make_shared<opset1::Multiply>(decompressed, opset1::Constant::create(element::f32, {rows, 1}, scales));
+                return std::make_shared<opset3::EmbeddingBagOffsetsSum>(decompressed,
+                                                                        opset1::Constant::create(element::i32, {indices.size()}, indices),
+                                                                        opset1::Constant::create(element::i32, {4}, {0, 2, 2, 9}),
+                                                                        opset1::Constant::create(element::i32, {}, {11}),
+                                                                        params[0]);
+            };
+        }
+
+        auto concat = std::make_shared<opset1::Concat>(OutputVector{makeBranch(), makeBranch()}, 1);
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(concat)}, params, "SharedConstantsFusing");
+    }
+
+    // The values of the constant in [-range, range] with the given step, the same for both branches
+    static std::vector<float> values(size_t size, float step, int range = 5) {
+        std::vector<float> result(size);
+        for (size_t i = 0; i < size; i++)
+            result[i] = step * static_cast<float>(static_cast<int>((i * 7) % (2 * range + 1)) - range);
+        return result;
+    }
+
+    SharedConstantsFusion fusion;
+};
+
+TEST_P(SharedConstantsFusingTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    switch (fusion) {
+        case SharedConstantsFusion::ConvolutionAndBias:
+            CheckNodeOfTypeCount(executableNetwork, "Convolution", 2);
+            break;
+        case SharedConstantsFusion::FullyConnectedAndWeightsDecompression:
+            CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 2);
+            CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+            break;
+        default:
+            CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+            break;
+    }
+    CheckNodeOfTypeCount(executableNetwork, "Eltwise", 0);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_SharedConstantsFusing, SharedConstantsFusingTest,
+                         ::testing::Values(SharedConstantsFusion::ConvolutionAndBias,
+                                           SharedConstantsFusion::FullyConnectedAndWeightsDecompression,
+                                           SharedConstantsFusion::EmbeddingBagAndDequantization),
+                         SharedConstantsFusingTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -32,6 +32,7 @@ public:
     MOCK_CONST_METHOD2(GetMetric, InferenceEngine::Parameter(const std::string&, const std::string&));
     MOCK_CONST_METHOD0(GetAvailableDevices, std::vector<std::string>());
     MOCK_CONST_METHOD1(DeviceSupportsImportExport, bool(const std::string&)); // NOLINT not a cast to bool
+    MOCK_CONST_METHOD0(IsCacheEnabled, bool());
 
     ~MockICore() = default;
 };
@@ -0,0 +1,119 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+
+#include "auto_exec_network.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iexecutable_network_internal.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iinfer_request_internal.hpp"
+
+using testing::_;
+using testing::NiceMock;
+using testing::Return;
+
+using namespace InferenceEngine;
+
+class AutoExecutableNetworkTests : public ::testing::Test {
+protected:
+    std::shared_ptr<NiceMock<MockIExecutableNetworkInternal>> cpuNetwork;
+    std::shared_ptr<NiceMock<MockIExecutableNetworkInternal>> acceleratorNetwork;
+    std::shared_ptr<NiceMock<MockIInferRequestInternal>> cpuRequest;
+    std::shared_ptr<NiceMock<MockIInferRequestInternal>> acceleratorRequest;
+    std::promise<SoExecutableNetworkInternal> acceleratorPromise;
+    AutoPlugin::AutoExecutableNetwork::Ptr autoNetwork;
+
+    void SetUp() override {
+        cpuNetwork = std::make_shared<NiceMock<MockIExecutableNetworkInternal>>();
+        acceleratorNetwork = std::make_shared<NiceMock<MockIExecutableNetworkInternal>>();
+        cpuRequest = std::make_shared<NiceMock<MockIInferRequestInternal>>();
+        acceleratorRequest = std::make_shared<NiceMock<MockIInferRequestInternal>>();
+        ON_CALL(*cpuNetwork, CreateInferRequest()).WillByDefault(Return(cpuRequest));
+        ON_CALL(*acceleratorNetwork, CreateInferRequest()).WillByDefault(Return(acceleratorRequest));
+
+        std::promise<SoExecutableNetworkInternal> cpuPromise;
+        cpuPromise.set_value({{}, cpuNetwork});
+        autoNetwork = std::make_shared<AutoPlugin::AutoExecutableNetwork>(cpuPromise.get_future(),
+                                                                          acceleratorPromise.get_future(),
+                                                                          false);
+    }
+
+    void TearDown() override {
+        autoNetwork.reset();
+        cpuNetwork.reset();
+        acceleratorNetwork.reset();
+    }
+};
+
+TEST_F(AutoExecutableNetworkTests, requestIsHotSwappedToAcceleratorNetwork) {
+    auto request = autoNetwork->CreateInferRequest();
+    EXPECT_CALL(*cpuRequest, Infer()).Times(1);
+    request->Infer();
+
+    acceleratorPromise.set_value({{}, acceleratorNetwork});
+    EXPECT_CALL(*acceleratorNetwork, CreateInferRequest()).Times(1);
+    EXPECT_CALL(*cpuRequest, Infer()).Times(0);
+    EXPECT_CALL(*acceleratorRequest, Infer()).Times(2);
+    request->Infer();
+    request->Infer();
+}
+
+TEST_F(AutoExecutableNetworkTests, cpuNetworkIsReleasedAfterAllRequestsAreSwapped) {
+    auto request = autoNetwork->CreateInferRequest();
+    std::weak_ptr<MockIExecutableNetworkInternal> cpuNetworkRef = cpuNetwork;
+    cpuNetwork.reset();
+
+    acceleratorPromise.set_value({{}, acceleratorNetwork});
+    // the request is not swapped yet and keeps the CPU network alive
+    auto newRequest = autoNetwork->CreateInferRequest();
+    EXPECT_FALSE(cpuNetworkRef.expired());
+
+    request->Infer();
+    EXPECT_TRUE(cpuNetworkRef.expired());
+}
+
+TEST_F(AutoExecutableNetworkTests, newRequestsAreCreatedOnAcceleratorNetwork) {
+    acceleratorPromise.set_value({{}, acceleratorNetwork});
+    EXPECT_CALL(*cpuNetwork, CreateInferRequest()).Times(0);
+    EXPECT_CALL(*acceleratorNetwork, CreateInferRequest()).Times(1);
+    auto request = autoNetwork->CreateInferRequest();
+    EXPECT_CALL(*acceleratorRequest, Infer()).Times(1);
+    request->Infer();
+}
+
+TEST_F(AutoExecutableNetworkTests, cpuNetworkIsUsedIfAcceleratorFails) {
+    auto request = autoNetwork->CreateInferRequest();
+    acceleratorPromise.set_exception(std::make_exception_ptr(GeneralError{"accelerator failed"}));
+
+    EXPECT_CALL(*cpuRequest, Infer()).Times(2);
+    EXPECT_NO_THROW(request->Infer());
+    EXPECT_NO_THROW(request->Infer());
+
+    // the CPU network becomes the actual one, so waiting for the accelerator doesn't throw
+    EXPECT_CALL(*cpuNetwork, GetExecGraphInfo()).Times(1);
+    EXPECT_NO_THROW(autoNetwork->GetExecGraphInfo());
+    EXPECT_CALL(*cpuNetwork, CreateInferRequest()).Times(1);
+    EXPECT_NO_THROW(autoNetwork->CreateInferRequest());
+}
+
+TEST_F(AutoExecutableNetworkTests, waitForAcceleratorDoesNotBlockInferenceOnCpu) {
+    auto request = autoNetwork->CreateInferRequest();
+    auto context = std::async(std::launch::async, [&] {
+        return autoNetwork->GetContext();
+    });
+    ASSERT_EQ(std::future_status::timeout, context.wait_for(std::chrono::milliseconds(10)));
+
+    EXPECT_CALL(*cpuRequest, Infer()).Times(1);
+    request->Infer();
+    EXPECT_NO_THROW(autoNetwork->CreateInferRequest());
+    EXPECT_NO_THROW(autoNetwork->GetMetric("NETWORK_NAME"));
+
+    EXPECT_CALL(*acceleratorNetwork, GetContext()).Times(1);
+    acceleratorPromise.set_value({{}, acceleratorNetwork});
+    EXPECT_NO_THROW(context.get());
+}
@@ -0,0 +1,100 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "nodes/common/compressed_weights_gemm.h"
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+
+// precision, values fit 4 bits, transposed, groups, with shifts, M
+using CompressedWeightsGemmParams = std::tuple<Precision, bool, bool, size_t, bool, size_t>;
+
+class CompressedWeightsGemmTest : public ::testing::TestWithParam<CompressedWeightsGemmParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<CompressedWeightsGemmParams>& obj) {
+        Precision precision;
+        bool fits4Bits, transposed, withShifts;
+        size_t groups, M;
+        std::tie(precision, fits4Bits, transposed, groups, withShifts, M) = obj.param;
+        return std::string(precision.name()) + (fits4Bits ? "_4bit" : "_8bit") + (transposed ? "_transposed" : "") +
+               "_groups" + std::to_string(groups) + (withShifts ? "_shifts" : "") + "_M" + std::to_string(M);
+    }
+};
+
+TEST_P(CompressedWeightsGemmTest, MatchesDecompressedWeights) {
+    Precision precision;
+    bool fits4Bits, transposed, withShifts;
+    size_t groups, M;
+    std::tie(precision, fits4Bits, transposed, groups, withShifts, M) = GetParam();
+
+    const size_t N = 37, K = 64;
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-2.f, 2.f);
+
+    const int minValue = precision == Precision::I8 ? (fits4Bits ? -8 : -128) : 0;
+    const int maxValue = precision == Precision::I8 ? (fits4Bits ? 7 : 127) : (fits4Bits ? 15 : 255);
+    std::uniform_int_distribution<int> valuesDist(minValue, maxValue);
+
+    CompressedWeightsParams params;
+    params.precision = precision;
+    params.N = N;
+    params.K = K;
+    params.groups = groups;
+    params.transposed = transposed;
+
+    std::vector<int> values(N * K);
+    std::vector<uint8_t> weights(N * K);
+    for (size_t n = 0; n < N; n++) {
+        for (size_t k = 0; k < K; k++) {
+            values[n * K + k] = valuesDist(gen);
+            weights[transposed ? k * N + n : n * K + k] = static_cast<uint8_t>(values[n * K + k]);
+        }
+    }
+    for (size_t i = 0; i < N * groups; i++) {
+        params.scales.push_back(dist(gen));
+        if (withShifts)
+            params.shifts.push_back(dist(gen));
+    }
+
+    std::vector<float> src(M * K), bias(N), dst(M * N);
+    for (auto& value : src)
+        value = dist(gen);
+    for (auto& value : bias)
+        value = dist(gen);
+
+    CompressedWeightsGemm gemm(params, weights.data());
+    ASSERT_EQ(fits4Bits ? 4 : 8, gemm.getBits());
+
+    std::vector<uint8_t> packedWeights(gemm.getPackedWeightsSize());
+    gemm.packWeights(weights.data(), packedWeights.data());
+    gemm.execute(packedWeights.data(), src.data(), dst.data(), bias.data(), M);
+
+    const size_t groupSize = K / groups;
+    for (size_t m = 0; m < M; m++) {
+        for (size_t n = 0; n < N; n++) {
+            double ref = bias[n];
+            for (size_t k = 0; k < K; k++) {
+                const size_t idx = n * groups + k / groupSize;
+                ref += src[m * K + k] * (values[n * K + k] * params.scales[idx] + (withShifts ? params.shifts[idx] : 0.f));
+            }
+            ASSERT_NEAR(ref, dst[m * N + n], 1e-3 * (1 + std::fabs(ref))) << "at row " << m << " channel " << n;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(CompressedWeightsGemm, CompressedWeightsGemmTest,
+                         ::testing::Combine(::testing::Values(Precision::I8, Precision::U8),
+                                            ::testing::Bool(),
+                                            ::testing::Bool(),
+                                            ::testing::Values(1, 4),
+                                            ::testing::Bool(),
+                                            ::testing::Values(1, 3, 9)),
+                         CompressedWeightsGemmTest::getTestCaseName);
@@ -0,0 +1,202 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "nodes/common/cpu_convert.h"
+#include "utils/bfloat16.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+const std::vector<Precision> precisions = {
+    Precision::U8, Precision::I8, Precision::U16, Precision::I16, Precision::I32,
+    Precision::U64, Precision::I64, Precision::FP32, Precision::BF16
+};
+
+void setValue(Precision prc, void *data, size_t i, double value) {
+    switch (prc) {
+        case Precision::U8: reinterpret_cast<uint8_t *>(data)[i] = static_cast<uint8_t>(value); break;
+        case Precision::I8: reinterpret_cast<int8_t *>(data)[i] = static_cast<int8_t>(value); break;
+        case Precision::U16: reinterpret_cast<uint16_t *>(data)[i] = static_cast<uint16_t>(value); break;
+        case Precision::I16: reinterpret_cast<int16_t *>(data)[i] = static_cast<int16_t>(value); break;
+        case Precision::I32: reinterpret_cast<int32_t *>(data)[i] = static_cast<int32_t>(value); break;
+        case Precision::U64: reinterpret_cast<uint64_t *>(data)[i] = static_cast<uint64_t>(value); break;
+        case Precision::I64: reinterpret_cast<int64_t *>(data)[i] = static_cast<int64_t>(value); break;
+        case Precision::FP32: reinterpret_cast<float *>(data)[i] = static_cast<float>(value); break;
+        case Precision::BF16:
+            reinterpret_cast<MKLDNNPlugin::bfloat16_t *>(data)[i] = MKLDNNPlugin::bfloat16_t(static_cast<float>(value));
+            break;
+        default: FAIL() << "Unexpected precision " << prc;
+    }
+}
+
+double getValue(Precision prc, const void *data, size_t i) {
+    switch (prc) {
+        case Precision::U8: return reinterpret_cast<const uint8_t *>(data)[i];
+        case Precision::I8: return reinterpret_cast<const int8_t *>(data)[i];
+        case Precision::U16: return reinterpret_cast<const uint16_t *>(data)[i];
+        case Precision::I16: return reinterpret_cast<const int16_t *>(data)[i];
+        case Precision::I32: return reinterpret_cast<const int32_t *>(data)[i];
+        case Precision::U64: return static_cast<double>(reinterpret_cast<const uint64_t *>(data)[i]);
+        case Precision::I64: return static_cast<double>(reinterpret_cast<const int64_t *>(data)[i]);
+        case Precision::FP32: return reinterpret_cast<const float *>(data)[i];
+        case Precision::BF16: return static_cast<float>(reinterpret_cast<const MKLDNNPlugin::bfloat16_t *>(data)[i]);
+        default: return NAN;
+    }
+}
+
+std::pair<double, double> range(Precision prc) {
+    switch (prc) {
+        case Precision::U8: return {0, 255};
+        case Precision::I8: return {-128, 127};
+        case Precision::U16: return {0, 65535};
+        case Precision::I16: return {-32768, 32767};
+        case Precision::I32: return {-2147483648.0, 2147483647.0};
+        case Precision::U64: return {0, 18446744073709551615.0};
+        case Precision::I64: return {-9223372036854775808.0, 9223372036854775807.0};
+        default: return {-3.0e38, 3.0e38};
+    }
+}
+
+// Reference semantics: the floating point values are truncated toward zero, the out of range values are saturated
+double expected(Precision dstPrc, double value) {
+    if (dstPrc == Precision::FP32)
+        return static_cast<float>(value);
+    if (dstPrc == Precision::BF16)
+        return static_cast<float>(MKLDNNPlugin::bfloat16_t(static_cast<float>(value)));
+    auto dstRange = range(dstPrc);
+    return std::min(std::max(std::trunc(value), dstRange.first), dstRange.second);
+}
+
+}  // namespace
+
+using ConvertParams = std::tuple<Precision, Precision, size_t>;
+
+class CpuConvertTest : public ::testing::TestWithParam<ConvertParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ConvertParams>& obj) {
+        Precision srcPrc, dstPrc;
+        size_t size;
+        std::tie(srcPrc, dstPrc, size) = obj.param;
+        return std::string(srcPrc.name()) + "_to_" + dstPrc.name() + "_size" + std::to_string(size);
+    }
+};
+
+TEST_P(CpuConvertTest, SaturatesAndTruncates) {
+    Precision srcPrc, dstPrc;
+    size_t size;
+    std::tie(srcPrc, dstPrc, size) = GetParam();
+
+    // the source values exceed the destination range, so the saturation is checked as well
+    auto srcRange = range(srcPrc);
+    double lower = std::max(srcRange.first, -1.0e6);
+    double upper = std::min(srcRange.second, 1.0e6);
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(lower, upper);
+
+    std::vector<uint8_t> src(size * srcPrc.size()), dst(size * dstPrc.size());
+    for (size_t i = 0; i < size; i++)
+        setValue(srcPrc, src.data(), i, srcPrc.is_float() ? dist(gen) : std::round(dist(gen)));
+
+    cpu_convert(src.data(), dst.data(), srcPrc, dstPrc, size);
+
+    for (size_t i = 0; i < size; i++) {
+        double value = getValue(srcPrc, src.data(), i);
+        if (dstPrc == Precision::BF16) {
+            // the rounding of the hardware conversion may differ from the software one in the last bit
+            ASSERT_NEAR(expected(dstPrc, value), getValue(dstPrc, dst.data(), i), std::fabs(value) / 128)
+                << "at index " << i << " for value " << value;
+        } else {
+            ASSERT_EQ(expected(dstPrc, value), getValue(dstPrc, dst.data(), i)) << "at index " << i << " for value " << value;
+        }
+    }
+}
+
+TEST(CpuConvertTest, SaturatesFloatToInt32) {
+    std::vector<float> src = {3.0e10f, -3.0e10f, 2147483648.0f, -2147483648.0f, 2.9f, -2.9f, INFINITY, -INFINITY};
+    std::vector<int32_t> dst(src.size());
+    cpu_convert(src.data(), dst.data(), Precision::FP32, Precision::I32, src.size());
+
+    std::vector<int32_t> ref = {2147483647, -2147483647 - 1, 2147483647, -2147483647 - 1, 2, -2, 2147483647, -2147483647 - 1};
+    EXPECT_EQ(ref, dst);
+}
+
+using ConvertToBoolParams = std::tuple<Precision, size_t>;
+
+class CpuConvertToBoolTest : public ::testing::TestWithParam<ConvertToBoolParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ConvertToBoolParams>& obj) {
+        Precision srcPrc;
+        size_t size;
+        std::tie(srcPrc, size) = obj.param;
+        return std::string(srcPrc.name()) + "_to_BOOL_size" + std::to_string(size);
+    }
+};
+
+// Reference semantics is static_cast<bool>: any non-zero value is true, the negative, fractional and NaN values as well
+TEST_P(CpuConvertToBoolTest, NonZeroIsTrue) {
+    Precision srcPrc;
+    size_t size;
+    std::tie(srcPrc, size) = GetParam();
+
+    const auto lower = std::max(range(srcPrc).first, -1.0e18), upper = std::min(range(srcPrc).second, 1.0e18);
+    std::vector<double> values = {0, 1, 7, upper};
+    if (lower < 0)
+        values.insert(values.end(), {-1, lower});
+    if (srcPrc.is_float())
+        values.insert(values.end(), {-0.0, 0.5, -0.5, 2.5, -2.5, 1.0e-3, NAN, INFINITY, -INFINITY});
+
+    std::vector<uint8_t> src(size * srcPrc.size()), dst(size, 0xff);
+    for (size_t i = 0; i < size; i++)
+        setValue(srcPrc, src.data(), i, values[i % values.size()]);
+
+    cpu_convert(src.data(), dst.data(), srcPrc, Precision::BOOL, size);
+
+    for (size_t i = 0; i < size; i++) {
+        double value = getValue(srcPrc, src.data(), i);
+        ASSERT_EQ(value != 0 ? 1 : 0, dst[i]) << "at index " << i << " for value " << value;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(CpuConvert, CpuConvertToBoolTest,
+                         ::testing::Combine(::testing::ValuesIn(precisions),
+                                            ::testing::Values(1, 17, 5003)),
+                         CpuConvertToBoolTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(CpuConvert, CpuConvertTest,
+                         ::testing::Combine(::testing::ValuesIn(precisions),
+                                            ::testing::ValuesIn(precisions),
+                                            ::testing::Values(1, 17, 5003)),
+                         CpuConvertTest::getTestCaseName);
+
+// Microbenchmark of all the conversions, run with --gtest_also_run_disabled_tests
+TEST(CpuConvertTest, DISABLED_Benchmark) {
+    const size_t size = 16 * 1024 * 1024;
+    const int iterations = 20;
+
+    for (auto srcPrc : precisions) {
+        for (auto dstPrc : precisions) {
+            std::vector<uint8_t> src(size * srcPrc.size(), 1), dst(size * dstPrc.size());
+            cpu_convert(src.data(), dst.data(), srcPrc, dstPrc, size);  // warm up and JIT compilation
+
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++)
+                cpu_convert(src.data(), dst.data(), srcPrc, dstPrc, size);
+            std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+
+            double bytes = static_cast<double>(size) * (srcPrc.size() + dstPrc.size()) * iterations;
+            std::cout << srcPrc << " -> " << dstPrc << ": " << time.count() * 1000 / iterations << " ms, "
+                      << bytes / time.count() / 1e9 << " GB/s" << std::endl;
+        }
+    }
+}
@@ -0,0 +1,126 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "mkldnn_activation_arena.hpp"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+constexpr size_t size4K = 1 << 12;
+constexpr size_t size16K = 1 << 14;
+constexpr size_t size64K = 1 << 16;
+constexpr size_t size256K = 1 << 18;
+constexpr size_t size1M = 1 << 20;
+}  // namespace
+
+TEST(ActivationArenaTest, GrowsToMaximumOfReservations) {
+    auto arena = std::make_shared<MKLDNNActivationArena>();
+    ASSERT_EQ(0u, arena->allocatedSize());
+    ASSERT_EQ(0u, arena->requestedSize());
+
+    auto small = arena->reserve(size4K);
+    ASSERT_NE(nullptr, small);
+    auto big = arena->reserve(size1M);
+    ASSERT_NE(nullptr, big);
+    auto medium = arena->reserve(size64K);
+    ASSERT_NE(nullptr, medium);
+
+    EXPECT_EQ(size1M, arena->allocatedSize());
+    EXPECT_EQ(size4K + size1M + size64K, arena->requestedSize());
+
+    // the growth doesn't move the memory the reservations are bound to
+    EXPECT_EQ(small->data(), big->data());
+    EXPECT_EQ(small->data(), medium->data());
+    std::memset(big->data(), 0x5a, size1M);
+    EXPECT_EQ(0x5a, small->data()[size1M - 1]);
+}
+
+TEST(ActivationArenaTest, ReleasesMemoryWithLastReservation) {
+    auto arena = std::make_shared<MKLDNNActivationArena>();
+    auto first = arena->reserve(size64K);
+    auto second = arena->reserve(size256K);
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+
+    second.reset();
+    // the committed memory is kept while the arena has users
+    EXPECT_EQ(size256K, arena->allocatedSize());
+    EXPECT_EQ(size64K, arena->requestedSize());
+
+    first.reset();
+    EXPECT_EQ(0u, arena->allocatedSize());
+    EXPECT_EQ(0u, arena->requestedSize());
+
+    // the released arena is committed again by the next reservation
+    auto next = arena->reserve(size4K);
+    ASSERT_NE(nullptr, next);
+    std::memset(next->data(), 0, size4K);
+    EXPECT_EQ(size4K, arena->allocatedSize());
+}
+
+TEST(ActivationArenaTest, ReservationKeepsArena) {
+    auto arena = std::make_shared<MKLDNNActivationArena>();
+    std::weak_ptr<MKLDNNActivationArena> weakArena = arena;
+    auto reservation = arena->reserve(size4K);
+    ASSERT_NE(nullptr, reservation);
+
+    arena.reset();
+    ASSERT_FALSE(weakArena.expired());
+    std::memset(reservation->data(), 0, size4K);
+
+    reservation.reset();
+    ASSERT_TRUE(weakArena.expired());
+}
+
+TEST(ActivationArenaTest, RejectsSizeBeyondAddressRange) {
+    auto arena = std::make_shared<MKLDNNActivationArena>();
+    ASSERT_EQ(nullptr, arena->reserve(std::numeric_limits<size_t>::max()));
+    EXPECT_EQ(0u, arena->allocatedSize());
+    EXPECT_EQ(0u, arena->requestedSize());
+}
+
+TEST(ActivationArenaTest, ReservationsOwnArenaOneAtATime) {
+    auto arena = std::make_shared<MKLDNNActivationArena>();
+    auto first = arena->reserve(size4K);
+    auto second = arena->reserve(size4K);
+
+    std::atomic<bool> locked{false};
+    std::thread other;
+    {
+        auto lock = first->lock();
+        other = std::thread([&] {
+            auto otherLock = second->lock();
+            locked = true;
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_FALSE(locked);
+    }
+    other.join();
+    EXPECT_TRUE(locked);
+}
+
+TEST(ActivationArenaTest, StreamsHaveOwnArenas) {
+    StreamsActivationArenas arenas;
+    auto first = arenas[0];
+    ASSERT_EQ(first, arenas[0]);
+    auto second = arenas[1];
+    ASSERT_NE(first, second);
+
+    auto firstA = first->reserve(size64K);
+    auto firstB = first->reserve(size4K);
+    auto secondA = second->reserve(size16K);
+    EXPECT_EQ(std::make_pair(size64K + size16K, size64K + size4K + size16K), arenas.memoryUsage());
+
+    firstA.reset();
+    firstB.reset();
+    secondA.reset();
+    EXPECT_EQ(std::make_pair(size_t{0}, size_t{0}), arenas.memoryUsage());
+}
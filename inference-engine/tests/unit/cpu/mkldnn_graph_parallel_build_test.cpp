@@ -0,0 +1,218 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <ngraph/ngraph.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <blob_factory.hpp>
+#include <threading/ie_cpu_streams_executor.hpp>
+
+#include "mkldnn_graph.h"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+const SizeVector inputShape = {1, 8, 16, 16};
+
+/* The independent branches of the input are built at the same level
+ *
+ *                        Parameter
+ *        /          /        |        \          \
+ *   Multiply    MaxPool     Add      Relu      AvgPool
+ *      |           |         |        |           |
+ *   Sigmoid        |       Tanh       |           |
+ *        \          \        |        /          /
+ *                         Concat
+ */
+CNNNetwork makeBranchesNetwork() {
+    auto data = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape(inputShape));
+    data->set_friendly_name("data");
+    auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 8, 1, 1},
+                                                  {0.5f, -1.f, 2.f, 0.25f, 1.5f, -0.5f, 3.f, 1.f});
+    auto multiply = std::make_shared<ngraph::opset1::Multiply>(data, scale);
+    auto sigmoid = std::make_shared<ngraph::opset1::Sigmoid>(multiply);
+    auto maxPool = std::make_shared<ngraph::opset1::MaxPool>(data, ngraph::Strides{1, 1}, ngraph::Shape{1, 1},
+                                                             ngraph::Shape{1, 1}, ngraph::Shape{3, 3});
+    auto shift = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 8, 1, 1},
+                                                  {1.f, 2.f, 3.f, 4.f, -1.f, -2.f, -3.f, -4.f});
+    auto add = std::make_shared<ngraph::opset1::Add>(data, shift);
+    auto tanh = std::make_shared<ngraph::opset1::Tanh>(add);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(data);
+    relu->set_friendly_name("relu_branch");
+    auto avgPool = std::make_shared<ngraph::opset1::AvgPool>(data, ngraph::Strides{1, 1}, ngraph::Shape{1, 1},
+                                                             ngraph::Shape{1, 1}, ngraph::Shape{3, 3}, false);
+    auto concat = std::make_shared<ngraph::opset1::Concat>(ngraph::OutputVector{sigmoid, maxPool, tanh, relu, avgPool}, 1);
+    auto result = std::make_shared<ngraph::opset1::Result>(concat);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{data}));
+}
+
+class FailingKernel : public ILayerExecImpl {
+public:
+    StatusCode init(LayerConfig&, ResponseDesc*) noexcept override {
+        return OK;
+    }
+    StatusCode getSupportedConfigurations(std::vector<LayerConfig>&, ResponseDesc* resp) noexcept override {
+        std::snprintf(resp->msg, sizeof(resp->msg), "relu_branch kernel is broken");
+        return GENERAL_ERROR;
+    }
+    StatusCode execute(std::vector<Blob::Ptr>&, std::vector<Blob::Ptr>&, ResponseDesc*) noexcept override {
+        return GENERAL_ERROR;
+    }
+};
+
+// Replaces the implementation of the relu_branch node with the kernel failing during the graph build
+class FailingKernelExtension : public IExtension {
+public:
+    void GetVersion(const Version*&) const noexcept override {}
+    void Unload() noexcept override {}
+    std::vector<std::string> getImplTypes(const std::shared_ptr<ngraph::Node>& node) override {
+        if (node->get_friendly_name() != "relu_branch")
+            return {};
+        return {"CPU"};
+    }
+    ILayerImpl::Ptr getImplementation(const std::shared_ptr<ngraph::Node>&, const std::string&) override {
+        return std::make_shared<FailingKernel>();
+    }
+};
+
+// Exposes the level-parallel traversal of the graph
+class ParallelBuildGraph : public MKLDNNGraph {
+public:
+    using MKLDNNGraph::ParallelForEachNode;
+};
+
+// The graph is built by a single stream of the given number of threads, as the executable network does
+void createGraph(MKLDNNGraph& graph, const CNNNetwork& network, const MKLDNNExtensionManager::Ptr& extMgr, int threads) {
+    MKLDNNWeightsSharing::Ptr cache;
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"ParallelBuildTest", 1, threads}};
+    executor.runAndWait({[&] {
+        graph.CreateGraph(network, extMgr, cache);
+    }});
+}
+
+std::vector<float> infer(MKLDNNGraph& graph, const CNNNetwork& network) {
+    auto input = make_blob_with_precision(TensorDesc(Precision::FP32, inputShape, Layout::NCHW));
+    input->allocate();
+    auto inputData = input->buffer().as<float*>();
+    for (size_t i = 0; i < input->size(); i++)
+        inputData[i] = static_cast<float>(static_cast<int>(i % 37) - 18) / 4.f;
+
+    const auto& outputInfo = *network.getOutputsInfo().begin();
+    auto output = make_blob_with_precision(outputInfo.second->getTensorDesc());
+    output->allocate();
+
+    graph.PushInputData("data", input);
+    graph.Infer();
+    graph.PullOutputData({{outputInfo.first, output}});
+    auto outputData = output->cbuffer().as<const float*>();
+    return {outputData, outputData + output->size()};
+}
+
+int parallelThreads() {
+    return std::max(4, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+}  // namespace
+
+TEST(MKLDNNGraphParallelBuildTest, SameGraphAndResultsAsSerialBuild) {
+    const CNNNetwork network = makeBranchesNetwork();
+    auto extMgr = std::make_shared<MKLDNNExtensionManager>();
+
+    MKLDNNGraph serialGraph;
+    createGraph(serialGraph, network, extMgr, 1);
+    MKLDNNGraph parallelGraph;
+    createGraph(parallelGraph, network, extMgr, parallelThreads());
+
+    const auto& serialNodes = serialGraph.GetNodes();
+    const auto& parallelNodes = parallelGraph.GetNodes();
+    ASSERT_EQ(serialNodes.size(), parallelNodes.size());
+    for (size_t i = 0; i < serialNodes.size(); i++) {
+        EXPECT_EQ(serialNodes[i]->getName(), parallelNodes[i]->getName());
+        EXPECT_EQ(serialNodes[i]->getTypeStr(), parallelNodes[i]->getTypeStr()) << serialNodes[i]->getName();
+        EXPECT_EQ(serialNodes[i]->getPrimitiveDescriptorType(), parallelNodes[i]->getPrimitiveDescriptorType())
+            << serialNodes[i]->getName();
+    }
+
+    EXPECT_EQ(infer(serialGraph, network), infer(parallelGraph, network));
+}
+
+TEST(MKLDNNGraphParallelBuildTest, ParentsAreProcessedBeforeChildren) {
+    const CNNNetwork network = makeBranchesNetwork();
+    auto extMgr = std::make_shared<MKLDNNExtensionManager>();
+    ParallelBuildGraph graph;
+    createGraph(graph, network, extMgr, parallelThreads());
+
+    std::mutex guard;
+    std::unordered_set<const MKLDNNNode*> processed;
+    size_t numUnprocessedParents = 0;
+    size_t numProcessedTwice = 0;
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"ParallelBuildTest", 1, parallelThreads()}};
+    executor.runAndWait({[&] {
+        graph.ParallelForEachNode([&](const MKLDNNNodePtr& node) {
+            std::lock_guard<std::mutex> lock(guard);
+            for (auto&& parentEdge : node->getParentEdges()) {
+                auto edge = parentEdge.lock();
+                if (edge && !processed.count(edge->getParent().get()))
+                    numUnprocessedParents++;
+            }
+            if (!processed.insert(node.get()).second)
+                numProcessedTwice++;
+        });
+    }});
+    EXPECT_EQ(0u, numUnprocessedParents);
+    EXPECT_EQ(0u, numProcessedTwice);
+    EXPECT_EQ(graph.GetNodes().size(), processed.size());
+}
+
+TEST(MKLDNNGraphParallelBuildTest, ExceptionOfNodeIsRethrown) {
+    const CNNNetwork network = makeBranchesNetwork();
+    auto extMgr = std::make_shared<MKLDNNExtensionManager>();
+    ParallelBuildGraph graph;
+    createGraph(graph, network, extMgr, parallelThreads());
+
+    std::mutex guard;
+    bool concatProcessed = false;
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"ParallelBuildTest", 1, parallelThreads()}};
+    try {
+        executor.runAndWait({[&] {
+            graph.ParallelForEachNode([&](const MKLDNNNodePtr& node) {
+                if (node->getName() == "relu_branch")
+                    throw std::runtime_error("relu_branch failed");
+                std::lock_guard<std::mutex> lock(guard);
+                if (node->getType() == Concatenation)
+                    concatProcessed = true;
+            });
+        }});
+        FAIL() << "The exception of the node is not rethrown";
+    } catch (const std::runtime_error& error) {
+        EXPECT_EQ(std::string{"relu_branch failed"}, error.what());
+    }
+    // the levels after the failed one are not processed
+    EXPECT_FALSE(concatProcessed);
+}
+
+TEST(MKLDNNGraphParallelBuildTest, CreateGraphFailsWithExceptionOfNode) {
+    const CNNNetwork network = makeBranchesNetwork();
+    auto extMgr = std::make_shared<MKLDNNExtensionManager>();
+    extMgr->AddExtension(std::make_shared<FailingKernelExtension>());
+    MKLDNNGraph graph;
+    try {
+        createGraph(graph, network, extMgr, parallelThreads());
+        FAIL() << "The graph with the failing node is created";
+    } catch (const InferenceEngine::Exception& error) {
+        EXPECT_NE(std::string::npos, std::string{error.what()}.find("relu_branch kernel is broken")) << error.what();
+    }
+}
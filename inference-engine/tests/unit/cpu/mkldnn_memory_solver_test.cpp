@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <limits>
 #include <vector>
 #include <gtest/gtest.h>
 #include <ie_common.h>
@@ -273,3 +274,84 @@ TEST(MemSolverTest, BestSolution1) {
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
 
+
+using Strategy = MKLDNNPlugin::MemorySolver::Strategy;
+
+class MemSolverStrategyTest : public ::testing::TestWithParam<Strategy> {};
+
+TEST_P(MemSolverStrategyTest, NoOverlappingOnRandomBoxes) {
+    // Simple LCG to keep the boxes the same from run to run
+    uint32_t seed = 42;
+    auto rand = [&](int max) { seed = seed * 1103515245 + 12345; return static_cast<int>((seed >> 16) % max); };
+
+    const int n = 200;
+    std::vector<Box> boxes;
+    for (int i = 0; i < n; i++) {
+        int start = rand(100);
+        int finish = rand(10) == 0 ? -1 : start + rand(10);
+        boxes.push_back({start, finish, 1 + rand(64), i});
+    }
+
+    MKLDNNPlugin::MemorySolver ms(boxes);
+    int64_t size = ms.solve(GetParam());
+    EXPECT_GE(size, ms.maxDepth());
+
+    for (auto &box : boxes)
+        if (box.finish == -1) box.finish = std::numeric_limits<int>::max();
+
+    for (int i = 0; i < n; i++) {
+        const Box &box1 = boxes[i];
+        int64_t off1 = ms.getOffset(box1.id);
+        ASSERT_GE(off1, 0);
+        ASSERT_LE(off1 + box1.size, size);
+        for (int j = i + 1; j < n; j++) {
+            const Box &box2 = boxes[j];
+            int64_t off2 = ms.getOffset(box2.id);
+            ASSERT_TRUE(box1.finish < box2.start || box1.start > box2.finish ||
+                        off1 + box1.size <= off2 || off1 >= off2 + box2.size) << "Box overlapping is detected";
+        }
+    }
+}
+
+TEST_P(MemSolverStrategyTest, LinearTopologyIsOptimal) {
+    int n = 0;
+    std::vector<Box> boxes;
+    for (int size : {3, 7, 7, 2, 5, 5, 1}) boxes.push_back({n, ++n, size, n});
+
+    MKLDNNPlugin::MemorySolver ms(boxes);
+    EXPECT_EQ(ms.solve(GetParam()), ms.maxDepth());
+}
+
+INSTANTIATE_TEST_SUITE_P(MemSolverStrategies, MemSolverStrategyTest,
+                         ::testing::Values(Strategy::GreedyBySize, Strategy::BestFit,
+                                           Strategy::GreedyByBreadth, Strategy::MinFootprint));
+
+TEST(MemSolverTest, MinFootprintSolvesUnefficiency) {
+    int n = 0;
+    std::vector<Box> boxes{    //  |            __________
+            {6, 7, 3, n++},    //  |   ____    |_3________|
+            {2, 5, 2, n++},    //  |  |_4__|_____ |    |
+            {5, 8, 2, n++},    //  |__|_2________||_1__|___
+            {2, 3, 2, n++},    //      2  3  4  5  6  7  8
+    };
+
+    MKLDNNPlugin::MemorySolver ms(boxes);
+    EXPECT_EQ(ms.solve(Strategy::GreedyBySize), 6);
+    EXPECT_EQ(ms.solve(Strategy::MinFootprint), 5);
+    EXPECT_NE(ms.getStrategy(), Strategy::GreedyBySize);
+}
+
+TEST(MemSolverTest, MinFootprintIsNotWorseThanAnyStrategy) {
+    int n = 0;                //  |         _____________
+    std::vector<Box> boxes{   //  |   _____|___1_________|
+            {4, 8, 1, n++},   //  |  |_2_____|    ____
+            {6, 7, 3, n++},   //  |  |    |      |    |
+            {2, 3, 3, n++},   //  |__|_3__|______|_3__|___
+            {2, 4, 2, n++},   //      2  3  4  5  6  7  8
+    };
+
+    MKLDNNPlugin::MemorySolver ms(boxes);
+    int64_t min_footprint = ms.solve(Strategy::MinFootprint);
+    for (auto strategy : {Strategy::GreedyBySize, Strategy::BestFit, Strategy::GreedyByBreadth})
+        EXPECT_LE(min_footprint, ms.solve(strategy));
+}
@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <gtest/gtest.h>
+
+#include "mkldnn_primitive_cache.hpp"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+struct CountingCreator {
+    std::shared_ptr<mkldnn::primitive> operator()() {
+        created++;
+        return std::make_shared<mkldnn::primitive>();
+    }
+    size_t created = 0;
+};
+
+}  // namespace
+
+TEST(MKLDNNPrimitiveCacheTest, ReturnsCachedPrimitive) {
+    MKLDNNPrimitiveCache cache(4);
+    CountingCreator creator;
+    auto create = [&creator]() { return creator(); };
+
+    auto first = cache.getOrCreate("a", create);
+    auto second = cache.getOrCreate("a", create);
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(1u, creator.created);
+
+    auto statistics = cache.getStatistics();
+    ASSERT_EQ(1u, statistics.hits);
+    ASSERT_EQ(1u, statistics.misses);
+    ASSERT_EQ(1u, statistics.size);
+    ASSERT_EQ(4u, statistics.capacity);
+}
+
+TEST(MKLDNNPrimitiveCacheTest, EvictsLeastRecentlyUsed) {
+    MKLDNNPrimitiveCache cache(2);
+    CountingCreator creator;
+    auto create = [&creator]() { return creator(); };
+
+    auto a = cache.getOrCreate("a", create);
+    cache.getOrCreate("b", create);
+    // "a" becomes the most recently used, so "b" is evicted by "c"
+    cache.getOrCreate("a", create);
+    cache.getOrCreate("c", create);
+    ASSERT_EQ(2u, cache.getStatistics().size);
+
+    ASSERT_EQ(a, cache.getOrCreate("a", create));
+    ASSERT_EQ(3u, creator.created);
+    cache.getOrCreate("b", create);
+    ASSERT_EQ(4u, creator.created);
+}
+
+TEST(MKLDNNPrimitiveCacheTest, EmptyKeyIsNotCached) {
+    MKLDNNPrimitiveCache cache(2);
+    CountingCreator creator;
+    auto create = [&creator]() { return creator(); };
+
+    ASSERT_NE(cache.getOrCreate("", create), cache.getOrCreate("", create));
+    ASSERT_EQ(2u, creator.created);
+    ASSERT_EQ(0u, cache.getStatistics().size);
+}
+
+TEST(MKLDNNPrimitiveCacheTest, ZeroCapacityDisablesCache) {
+    MKLDNNPrimitiveCache cache(2);
+    CountingCreator creator;
+    auto create = [&creator]() { return creator(); };
+
+    auto a = cache.getOrCreate("a", create);
+    cache.setCapacity(0);
+    ASSERT_EQ(0u, cache.getStatistics().size);
+    ASSERT_NE(a, cache.getOrCreate("a", create));
+    ASSERT_EQ(0u, cache.getStatistics().size);
+}
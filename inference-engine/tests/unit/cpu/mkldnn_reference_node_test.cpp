@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <gtest/gtest.h>
+
+#include <ngraph/ngraph.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <blob_factory.hpp>
+
+#include "mkldnn_graph.h"
+#include "nodes/mkldnn_reference_node.h"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+// Reverse has no CPU implementation, so it is executed by the reference node
+CNNNetwork makeReverseNetwork() {
+    auto data = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 3, 4});
+    data->set_friendly_name("data");
+    auto axes = ngraph::opset1::Constant::create(ngraph::element::i32, ngraph::Shape{1}, {1});
+    auto reverse = std::make_shared<ngraph::opset1::Reverse>(data, axes, ngraph::opset1::Reverse::Mode::INDEX);
+    reverse->set_friendly_name("reverse");
+    auto result = std::make_shared<ngraph::opset1::Result>(reverse);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{data}));
+}
+
+}  // namespace
+
+TEST(MKLDNNReferenceNodeTest, HostTensorsAreCreatedOnce) {
+    const CNNNetwork network = makeReverseNetwork();
+    auto extMgr = std::make_shared<MKLDNNExtensionManager>();
+    MKLDNNWeightsSharing::Ptr cache;
+    MKLDNNGraph graph;
+
+    const size_t countBeforeCreate = MKLDNNReferenceNode::getHostTensorsCount();
+    graph.CreateGraph(network, extMgr, cache);
+    size_t referenceNodes = 0;
+    for (const auto& node : graph.GetNodes()) {
+        if (node->getType() == Reference)
+            referenceNodes++;
+    }
+    ASSERT_EQ(1u, referenceNodes);
+    // the data and the axes inputs and the output
+    const size_t countAfterCreate = MKLDNNReferenceNode::getHostTensorsCount();
+    ASSERT_EQ(countBeforeCreate + 3, countAfterCreate);
+
+    auto input = make_blob_with_precision(TensorDesc(Precision::FP32, {2, 3, 4}, Layout::CHW));
+    input->allocate();
+    auto output = make_blob_with_precision(TensorDesc(Precision::FP32, {2, 3, 4}, Layout::CHW));
+    output->allocate();
+    const std::string outputName = network.getOutputsInfo().begin()->first;
+
+    for (int iteration = 0; iteration < 3; iteration++) {
+        auto inputData = input->buffer().as<float*>();
+        for (size_t i = 0; i < input->size(); i++)
+            inputData[i] = static_cast<float>(i + iteration);
+
+        graph.PushInputData("data", input);
+        graph.Infer();
+        graph.PullOutputData({{outputName, output}});
+
+        auto outputData = output->cbuffer().as<const float*>();
+        for (size_t n = 0; n < 2; n++) {
+            for (size_t c = 0; c < 3; c++) {
+                for (size_t w = 0; w < 4; w++) {
+                    ASSERT_EQ(inputData[(n * 3 + 2 - c) * 4 + w], outputData[(n * 3 + c) * 4 + w]);
+                }
+            }
+        }
+    }
+    ASSERT_EQ(countAfterCreate, MKLDNNReferenceNode::getHostTensorsCount());
+}
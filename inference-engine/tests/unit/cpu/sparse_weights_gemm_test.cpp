@@ -0,0 +1,81 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "nodes/common/sparse_weights_gemm.h"
+
+using namespace MKLDNNPlugin;
+
+// sparsity, block of the zeros, M
+using SparseWeightsGemmParams = std::tuple<float, size_t, size_t>;
+
+class SparseWeightsGemmTest : public ::testing::TestWithParam<SparseWeightsGemmParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SparseWeightsGemmParams>& obj) {
+        float sparsity;
+        size_t block, M;
+        std::tie(sparsity, block, M) = obj.param;
+        return "sparsity" + std::to_string(static_cast<int>(sparsity * 100)) + "_block" + std::to_string(block) +
+               "_M" + std::to_string(M);
+    }
+};
+
+TEST_P(SparseWeightsGemmTest, MatchesDenseWeights) {
+    float sparsity;
+    size_t block, M;
+    std::tie(sparsity, block, M) = GetParam();
+
+    const size_t N = 131, K = 96;
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-2.f, 2.f);
+    std::bernoulli_distribution isZero(sparsity);
+
+    // the zeros are set by the blocks of the input channels to model the block sparsity
+    std::vector<float> weights(N * K);
+    for (size_t n = 0; n < N; n++) {
+        for (size_t k = 0; k < K; k += block) {
+            const bool zero = isZero(gen);
+            for (size_t i = k; i < std::min(K, k + block); i++)
+                weights[n * K + i] = zero ? 0.f : dist(gen);
+        }
+    }
+    // the channel without the non zero weights
+    std::fill(weights.begin() + 3 * K, weights.begin() + 4 * K, 0.f);
+
+    std::vector<float> src(M * K), bias(N), dst(M * N);
+    for (auto& value : src)
+        value = dist(gen);
+    for (auto& value : bias)
+        value = dist(gen);
+
+    const float measuredSparsity = SparseWeightsGemm::getSparsity(weights.data(), weights.size());
+    ASSERT_NEAR(sparsity, measuredSparsity, 0.1f);
+
+    SparseWeightsGemm gemm(N, K, weights.data());
+    std::vector<uint8_t> packedWeights(gemm.getPackedWeightsSize());
+    ASSERT_LE(packedWeights.size(), N * K * sizeof(float) * (1.f - measuredSparsity) * 2 + N * 16 * 2 * sizeof(float));
+    gemm.packWeights(weights.data(), packedWeights.data());
+    gemm.execute(packedWeights.data(), src.data(), dst.data(), bias.data(), M);
+
+    for (size_t m = 0; m < M; m++) {
+        for (size_t n = 0; n < N; n++) {
+            double ref = bias[n];
+            for (size_t k = 0; k < K; k++)
+                ref += src[m * K + k] * weights[n * K + k];
+            ASSERT_NEAR(ref, dst[m * N + n], 1e-4 * (1 + std::fabs(ref))) << "at row " << m << " channel " << n;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(SparseWeightsGemm, SparseWeightsGemmTest,
+                         ::testing::Combine(::testing::Values(0.f, 0.7f, 0.9f, 1.f),
+                                            ::testing::Values(1, 4),
+                                            ::testing::Values(1, 3, 9)),
+                         SparseWeightsGemmTest::getTestCaseName);
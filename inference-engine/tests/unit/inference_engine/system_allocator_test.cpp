@@ -4,6 +4,7 @@
 
 #include <memory>
 #include <gtest/gtest.h>
+#include <ie_blob.h>
 
 #include "common_test_utils/test_common.hpp"
 
@@ -62,4 +63,59 @@ TEST_F(SystemAllocatorTests, canLockAndUnlockAllocatedMemory) {
     EXPECT_EQ(ptr[9999], 11);
     allocator->unlock(ptr);
     allocator->free(handle);
-}
\ No newline at end of file
+}
+
+TEST(PlacedMemoryAllocatorTests, canNotCreateWithWrongAlignment) {
+    AllocatorParams params;
+    params.alignment = 48;
+    EXPECT_EQ(CreateAllocator(params), nullptr);
+}
+
+TEST(PlacedMemoryAllocatorTests, canAllocateAligned) {
+    AllocatorParams params;
+    params.alignment = 256;
+    auto allocator = CreateAllocator(params);
+    ASSERT_NE(allocator, nullptr);
+    for (size_t size : {0, 1, 100, 10000}) {
+        void *handle = allocator->alloc(size);
+        ASSERT_NE(handle, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(allocator->lock(handle)) % params.alignment, 0);
+        EXPECT_TRUE(allocator->free(handle));
+    }
+}
+
+TEST(PlacedMemoryAllocatorTests, canAllocateWithHugePagesAndNumaNode) {
+    // the huge pages and the NUMA node placement are not guaranteed by the system, so the memory is only checked
+    // to be usable
+    const size_t size = 5 * 1024 * 1024;
+    for (auto hugePages : {HUGE_PAGES_NONE, HUGE_PAGES_TRANSPARENT, HUGE_PAGES_EXPLICIT}) {
+        AllocatorParams params;
+        params.hugePages = hugePages;
+        params.numaNode = 0;
+        PlacedMemoryAllocator allocator(params);
+        void *handle = allocator.alloc(size);
+        ASSERT_NE(handle, nullptr);
+#ifdef __linux__
+        EXPECT_TRUE(allocator.isMapped(handle));
+#endif
+        auto ptr = reinterpret_cast<char *>(allocator.lock(handle));
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 64, 0);
+        ptr[0] = 1;
+        ptr[size - 1] = 2;
+        EXPECT_EQ(ptr[0] + ptr[size - 1], 3);
+        allocator.unlock(handle);
+        EXPECT_TRUE(allocator.free(handle));
+        EXPECT_FALSE(allocator.isMapped(handle));
+    }
+}
+
+TEST(PlacedMemoryAllocatorTests, canBeUsedByBlob) {
+    AllocatorParams params;
+    params.alignment = 4096;
+    auto blob = make_shared_blob<float>(TensorDesc(Precision::FP32, {2, 3, 100, 100}, Layout::NCHW), CreateAllocator(params));
+    blob->allocate();
+    auto data = blob->buffer().as<float *>();
+    ASSERT_NE(data, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(data) % params.alignment, 0);
+    data[blob->size() - 1] = 1.f;
+}
@@ -0,0 +1,462 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/itt.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace openvino::itt;
+
+namespace {
+
+constexpr size_t bufferSize = 16;
+constexpr size_t depthLimit = 2;
+
+// The trace reads the environment once, on the first task of the process
+const bool traceEnvironment = [] {
+#ifdef _WIN32
+    _putenv_s("OPENVINO_TRACE_BUFFER_SIZE", std::to_string(bufferSize).c_str());
+    _putenv_s("OPENVINO_TRACE_DEPTH", std::to_string(depthLimit).c_str());
+    _putenv_s("OPENVINO_TRACE_FILE", "");
+#else
+    setenv("OPENVINO_TRACE_BUFFER_SIZE", std::to_string(bufferSize).c_str(), 1);
+    setenv("OPENVINO_TRACE_DEPTH", std::to_string(depthLimit).c_str(), 1);
+    unsetenv("OPENVINO_TRACE_FILE");
+#endif
+    return true;
+}();
+
+OV_ITT_DOMAIN(TraceTest);
+
+using Task = ScopedTask<TraceTest>;
+
+// the tasks of the previous runs of a test stay in the buffers, so the task names are unique per run
+std::string taskPrefix;
+
+handle_t taskHandle(const std::string& name) {
+    return handle(taskPrefix + name);
+}
+
+struct Json {
+    enum class Type { Null, Bool, Number, String, Array, Object };
+
+    Type type = Type::Null;
+    bool boolean = false;
+    double number = 0;
+    std::string string;
+    std::vector<Json> array;
+    std::vector<std::pair<std::string, Json>> object;
+
+    const Json& operator[](const std::string& key) const {
+        for (const auto& member : object) {
+            if (member.first == key)
+                return member.second;
+        }
+        throw std::runtime_error("The JSON object has no member " + key);
+    }
+};
+
+// The strict parser of the trace, it fails on the JSON the other tools would reject
+class JsonParser {
+public:
+    explicit JsonParser(std::string text) : text(std::move(text)) {}
+
+    Json parse() {
+        Json value = parseValue();
+        skipSpaces();
+        if (pos != text.size())
+            fail("trailing characters");
+        return value;
+    }
+
+private:
+    [[noreturn]] void fail(const std::string& what) const {
+        throw std::runtime_error("Invalid JSON at " + std::to_string(pos) + ": " + what);
+    }
+
+    void skipSpaces() {
+        while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos])))
+            ++pos;
+    }
+
+    bool consume(char c) {
+        skipSpaces();
+        if (pos < text.size() && text[pos] == c) {
+            ++pos;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char c) {
+        if (!consume(c))
+            fail(std::string("expected ") + c);
+    }
+
+    bool consumeWord(const char* word) {
+        const std::string w = word;
+        if (text.compare(pos, w.size(), w) != 0)
+            return false;
+        pos += w.size();
+        return true;
+    }
+
+    Json parseValue() {
+        skipSpaces();
+        if (pos >= text.size())
+            fail("unexpected end");
+        Json value;
+        if (consume('{')) {
+            value.type = Json::Type::Object;
+            if (!consume('}')) {
+                do {
+                    skipSpaces();
+                    std::string key = parseString();
+                    expect(':');
+                    value.object.emplace_back(std::move(key), parseValue());
+                } while (consume(','));
+                expect('}');
+            }
+        } else if (consume('[')) {
+            value.type = Json::Type::Array;
+            if (!consume(']')) {
+                do {
+                    value.array.push_back(parseValue());
+                } while (consume(','));
+                expect(']');
+            }
+        } else if (text[pos] == '"') {
+            value.type = Json::Type::String;
+            value.string = parseString();
+        } else if (consumeWord("true")) {
+            value.type = Json::Type::Bool;
+            value.boolean = true;
+        } else if (consumeWord("false")) {
+            value.type = Json::Type::Bool;
+        } else if (consumeWord("null")) {
+            value.type = Json::Type::Null;
+        } else {
+            const char* begin = text.c_str() + pos;
+            char* end = nullptr;
+            value.number = std::strtod(begin, &end);
+            if (end == begin)
+                fail("unexpected character");
+            value.type = Json::Type::Number;
+            pos += end - begin;
+        }
+        return value;
+    }
+
+    std::string parseString() {
+        if (pos >= text.size() || text[pos] != '"')
+            fail("expected string");
+        ++pos;
+        std::string result;
+        for (;;) {
+            if (pos >= text.size())
+                fail("unterminated string");
+            const char c = text[pos++];
+            if (c == '"')
+                return result;
+            if (static_cast<unsigned char>(c) < 0x20)
+                fail("unescaped control character");
+            if (c != '\\') {
+                result += c;
+                continue;
+            }
+            if (pos >= text.size())
+                fail("unterminated escape");
+            const char escaped = text[pos++];
+            switch (escaped) {
+            case '"': case '\\': case '/': result += escaped; break;
+            case 'b': result += '\b'; break;
+            case 'f': result += '\f'; break;
+            case 'n': result += '\n'; break;
+            case 'r': result += '\r'; break;
+            case 't': result += '\t'; break;
+            case 'u': {
+                const std::string hex = text.substr(pos, 4);
+                if (hex.size() != 4 || hex.find_first_not_of("0123456789abcdefABCDEF") != std::string::npos)
+                    fail("invalid unicode escape");
+                const unsigned long code = std::stoul(hex, nullptr, 16);
+                // the trace escapes only the control characters
+                if (code >= 0x80)
+                    fail("unexpected non ASCII escape");
+                result += static_cast<char>(code);
+                pos += 4;
+                break;
+            }
+            default:
+                fail("invalid escape");
+            }
+        }
+    }
+
+    std::string text;
+    size_t pos = 0;
+};
+
+struct TraceTask {
+    std::string name;
+    double begin;
+    double end;
+    int64_t tid;
+};
+
+struct TraceData {
+    std::vector<TraceTask> tasks;
+    std::map<int64_t, std::string> threadNames;
+
+    // the tasks of the current run in the order of their completion per thread
+    std::vector<TraceTask> named(const std::string& name) const {
+        const std::string prefix = taskPrefix + name;
+        std::vector<TraceTask> result;
+        for (const auto& task : tasks) {
+            if (task.name.compare(0, prefix.size(), prefix) == 0)
+                result.push_back(task);
+        }
+        return result;
+    }
+};
+
+const Json& member(const Json& object, const std::string& key, Json::Type type) {
+    const Json& value = object[key];
+    if (value.type != type)
+        throw std::runtime_error("The trace member " + key + " has the wrong type");
+    return value;
+}
+
+// Writes the trace with dumpTrace() and parses it, the structure of the Chrome trace format is validated
+TraceData readTrace() {
+    const std::string path = std::string("itt_") + ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".json";
+    if (!dumpTrace(path))
+        throw std::runtime_error("The trace isn't written to " + path);
+    std::stringstream text;
+    {
+        std::ifstream file(path);
+        text << file.rdbuf();
+    }
+    std::remove(path.c_str());
+
+    const Json root = JsonParser(text.str()).parse();
+    if (member(root, "displayTimeUnit", Json::Type::String).string != "ns")
+        throw std::runtime_error("The trace time unit isn't ns");
+
+    TraceData trace;
+    double pid = -1;
+    for (const auto& event : member(root, "traceEvents", Json::Type::Array).array) {
+        const double eventPid = member(event, "pid", Json::Type::Number).number;
+        if (pid >= 0 && pid != eventPid)
+            throw std::runtime_error("The trace events have the different pids");
+        pid = eventPid;
+        const auto tid = static_cast<int64_t>(member(event, "tid", Json::Type::Number).number);
+        const std::string name = member(event, "name", Json::Type::String).string;
+        const std::string phase = member(event, "ph", Json::Type::String).string;
+        if (phase == "M") {
+            if (name != "thread_name")
+                throw std::runtime_error("Unexpected metadata event " + name);
+            trace.threadNames[tid] = member(member(event, "args", Json::Type::Object), "name", Json::Type::String).string;
+        } else if (phase == "X") {
+            if (member(event, "cat", Json::Type::String).string != "TraceTest")
+                throw std::runtime_error("Unexpected category of the task " + name);
+            const double begin = member(event, "ts", Json::Type::Number).number;
+            const double duration = member(event, "dur", Json::Type::Number).number;
+            if (begin < 0 || duration < 0)
+                throw std::runtime_error("Negative time of the task " + name);
+            trace.tasks.push_back({name, begin, begin + duration, tid});
+        } else {
+            throw std::runtime_error("Unexpected event phase " + phase);
+        }
+    }
+    return trace;
+}
+
+// the timestamps are written with the nanosecond precision
+constexpr double timeEpsilon = 1e-3;
+
+void runThread(const std::function<void()>& function) {
+    std::thread(function).join();
+}
+
+}  // namespace
+
+class TraceTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        static int run = 0;
+        taskPrefix = std::to_string(++run) + "/";
+    }
+};
+
+TEST_F(TraceTests, dumpWithoutFileFails) {
+    ASSERT_FALSE(dumpTrace());
+}
+
+TEST_F(TraceTests, nestedTasksOfSeveralThreads) {
+    constexpr size_t threadsCount = 4;
+    constexpr size_t iterations = 3;
+    std::atomic<size_t> finished{0};
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadsCount; ++i) {
+        threads.emplace_back([i, &finished] {
+            threadName("nested_thread_" + std::to_string(i));
+            for (size_t j = 0; j < iterations; ++j) {
+                Task outer{taskHandle("nested_outer")};
+                Task inner{taskHandle("nested_inner")};
+            }
+            // the threads live together, so they don't reuse the buffers of each other
+            ++finished;
+            while (finished != threadsCount)
+                std::this_thread::yield();
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    const auto trace = readTrace();
+    std::map<int64_t, std::vector<TraceTask>> outers, inners;
+    for (const auto& task : trace.named("nested_outer"))
+        outers[task.tid].push_back(task);
+    for (const auto& task : trace.named("nested_inner"))
+        inners[task.tid].push_back(task);
+
+    ASSERT_EQ(threadsCount, outers.size());
+    std::vector<std::string> names;
+    for (const auto& thread : outers) {
+        const auto tid = thread.first;
+        ASSERT_EQ(iterations, thread.second.size());
+        ASSERT_EQ(iterations, inners[tid].size());
+        for (size_t j = 0; j < iterations; ++j) {
+            const auto& outer = thread.second[j];
+            const auto& inner = inners[tid][j];
+            EXPECT_LE(outer.begin, inner.begin + timeEpsilon);
+            EXPECT_LE(inner.end, outer.end + timeEpsilon);
+        }
+        ASSERT_EQ(1u, trace.threadNames.count(tid));
+        names.push_back(trace.threadNames.at(tid));
+    }
+    std::sort(names.begin(), names.end());
+    for (size_t i = 0; i < threadsCount; ++i)
+        EXPECT_EQ("nested_thread_" + std::to_string(i), names[i]);
+}
+
+TEST_F(TraceTests, overflowKeepsLastTasks) {
+    constexpr size_t tasksCount = 2 * bufferSize + bufferSize / 2;
+    runThread([] {
+        for (size_t i = 0; i < tasksCount; ++i)
+            Task task{taskHandle("overflow_" + std::to_string(i))};
+    });
+
+    const auto tasks = readTrace().named("overflow_");
+    ASSERT_EQ(bufferSize, tasks.size());
+    for (size_t i = 0; i < bufferSize; ++i) {
+        EXPECT_EQ(taskPrefix + "overflow_" + std::to_string(tasksCount - bufferSize + i), tasks[i].name);
+        EXPECT_EQ(tasks.front().tid, tasks[i].tid);
+        if (i) {
+            EXPECT_LE(tasks[i - 1].end, tasks[i].begin + timeEpsilon);
+        }
+    }
+}
+
+TEST_F(TraceTests, dumpWhileRecordingSkipsOverwrittenTasks) {
+    struct Threads : std::vector<std::thread> {
+        ~Threads() {
+            stop = true;
+            for (auto& thread : *this)
+                thread.join();
+        }
+        std::atomic<bool> stop{false};
+    } threads;
+    auto& stop = threads.stop;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&stop] {
+            const auto concurrentHandle = taskHandle("concurrent");
+            while (!stop)
+                Task task{concurrentHandle};
+        });
+    }
+
+    for (int i = 0; i < 20; ++i) {
+        std::map<int64_t, std::vector<TraceTask>> threadTasks;
+        for (const auto& task : readTrace().named("concurrent"))
+            threadTasks[task.tid].push_back(task);
+        // the tasks which are copied torn are skipped, so the rest follow each other
+        for (const auto& tasks : threadTasks) {
+            EXPECT_LE(tasks.second.size(), bufferSize);
+            for (size_t j = 1; j < tasks.second.size(); ++j)
+                EXPECT_LE(tasks.second[j - 1].end, tasks.second[j].begin + timeEpsilon);
+        }
+    }
+}
+
+TEST_F(TraceTests, newThreadReusesBufferOfFinishedOne) {
+    runThread([] { Task task{taskHandle("reuse_first")}; });
+    runThread([] { Task task{taskHandle("reuse_second")}; });
+
+    auto trace = readTrace();
+    const auto first = trace.named("reuse_first");
+    const auto second = trace.named("reuse_second");
+    ASSERT_EQ(1u, first.size());
+    ASSERT_EQ(1u, second.size());
+    EXPECT_NE(first[0].tid, second[0].tid);
+
+    // the tasks of the finished threads are kept until the thread reusing the buffer overwrites them
+    runThread([] {
+        for (size_t i = 0; i < bufferSize; ++i)
+            Task task{taskHandle("reuse_third")};
+    });
+    trace = readTrace();
+    EXPECT_EQ(0u, trace.named("reuse_first").size());
+    EXPECT_EQ(0u, trace.named("reuse_second").size());
+    const auto third = trace.named("reuse_third");
+    ASSERT_EQ(bufferSize, third.size());
+    EXPECT_NE(first[0].tid, third[0].tid);
+    EXPECT_NE(second[0].tid, third[0].tid);
+}
+
+TEST_F(TraceTests, tasksDeeperThanLimitAreNotRecorded) {
+    runThread([] {
+        {
+            Task first{taskHandle("depth_1")};
+            Task second{taskHandle("depth_2")};
+            Task third{taskHandle("depth_3")};
+        }
+        Task after{taskHandle("depth_after")};
+    });
+
+    const auto tasks = readTrace().named("depth_");
+    ASSERT_EQ(depthLimit + 1, tasks.size());
+    EXPECT_EQ(taskPrefix + "depth_2", tasks[0].name);
+    EXPECT_EQ(taskPrefix + "depth_1", tasks[1].name);
+    EXPECT_EQ(taskPrefix + "depth_after", tasks[2].name);
+}
+
+TEST_F(TraceTests, namesAreEscaped) {
+    const std::string name = "escaped \"quoted\" \\path\\ /\n\t\r\x01\x1f end";
+    runThread([&name] {
+        threadName(name);
+        Task task{taskHandle(name)};
+    });
+
+    const auto trace = readTrace();
+    const auto tasks = trace.named("escaped ");
+    ASSERT_EQ(1u, tasks.size());
+    EXPECT_EQ(taskPrefix + name, tasks[0].name);
+    EXPECT_EQ(name, trace.threadNames.at(tasks[0].tid));
+}
@@ -0,0 +1,213 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ie_plugin_config.hpp>
+#include <multi-device/multi_device_config.hpp>
+#include "multi_device_exec_network.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iexecutable_network_internal.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iinfer_request_internal.hpp"
+
+using testing::_;
+using testing::Invoke;
+using testing::NiceMock;
+using testing::Return;
+
+using namespace InferenceEngine;
+using namespace MultiDevicePlugin;
+
+class MultiExecutableNetworkTests : public ::testing::Test {
+protected:
+    using Callback = std::function<void(std::exception_ptr)>;
+    std::map<DeviceName, std::shared_ptr<NiceMock<MockIExecutableNetworkInternal>>> networks;
+    // the callbacks of the worker requests in the creation order, i.e. in the order of the MULTI worker requests
+    std::map<DeviceName, std::vector<Callback>> callbacks;
+    std::vector<DeviceInformation> devices = {{"CPU", {}, -1}, {"GPU", {}, -1}};
+
+    void SetUp() override {
+        for (auto&& device : devices) {
+            auto deviceName = device.deviceName;
+            auto network = std::make_shared<NiceMock<MockIExecutableNetworkInternal>>();
+            ON_CALL(*network, CreateInferRequest()).WillByDefault(Invoke([this, deviceName] {
+                auto request = std::make_shared<NiceMock<MockIInferRequestInternal>>();
+                ON_CALL(*request, SetCallback(_)).WillByDefault(Invoke([this, deviceName] (Callback callback) {
+                    callbacks[deviceName].push_back(std::move(callback));
+                }));
+                return request;
+            }));
+            networks[deviceName] = network;
+        }
+    }
+
+    void TearDown() override {
+        callbacks.clear();
+        networks.clear();
+    }
+
+    MultiDeviceExecutableNetwork::Ptr makeMultiNetwork(unsigned int numRequestsPerDevice, const std::string& policy = {}) {
+        DeviceMap<SoExecutableNetworkInternal> networksPerDevice;
+        for (auto&& network : networks) {
+            ON_CALL(*network.second, GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)))
+                .WillByDefault(Return(Parameter{numRequestsPerDevice}));
+            networksPerDevice[network.first] = {{}, network.second};
+        }
+        std::unordered_map<std::string, Parameter> config = {
+            {MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES, std::string{"CPU,GPU"}}};
+        if (!policy.empty()) {
+            config[MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY] = policy;
+        }
+        return std::make_shared<MultiDeviceExecutableNetwork>(networksPerDevice, devices, config);
+    }
+
+    // schedules the task that just occupies the worker request (as the StartAsync would do), returns the device it went to
+    // (the task may be queued and run later, so the results are shared with it)
+    static DeviceName schedule(const MultiDeviceExecutableNetwork::Ptr& multiNetwork,
+                               std::shared_ptr<DeviceName> scheduledTo = std::make_shared<DeviceName>(),
+                               std::shared_ptr<int> numCompleted = std::make_shared<int>(0)) {
+        auto multiNetworkPtr = multiNetwork.get();
+        multiNetwork->ScheduleToWorkerInferRequest([multiNetworkPtr, scheduledTo, numCompleted] {
+            auto workerRequest = MultiDeviceExecutableNetwork::_thisWorkerInferRequest;
+            *scheduledTo = deviceOf(multiNetworkPtr, workerRequest);
+            workerRequest->_task = [numCompleted] {
+                (*numCompleted)++;
+            };
+        });
+        return *scheduledTo;
+    }
+
+    static DeviceName deviceOf(const MultiDeviceExecutableNetwork* multiNetwork,
+                               const MultiDeviceExecutableNetwork::WorkerInferRequest* workerRequest) {
+        for (auto&& requests : multiNetwork->_workerRequests) {
+            if (!requests.second.empty() &&
+                workerRequest >= requests.second.data() && workerRequest < requests.second.data() + requests.second.size()) {
+                return requests.first;
+            }
+        }
+        return {};
+    }
+
+    // completes the worker request (as the device would do) and returns it to the idle ones
+    void complete(const DeviceName& device, std::size_t requestIndex = 0) {
+        callbacks.at(device).at(requestIndex)(nullptr);
+    }
+
+    template <typename T>
+    static std::map<std::string, T> metric(const MultiDeviceExecutableNetwork::Ptr& multiNetwork, const std::string& name) {
+        return multiNetwork->GetMetric(name).as<std::map<std::string, T>>();
+    }
+};
+
+TEST_F(MultiExecutableNetworkTests, schedulingPolicyIsSupportedConfigKey) {
+    auto multiNetwork = makeMultiNetwork(1);
+    auto configKeys = multiNetwork->GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS)).as<std::vector<std::string>>();
+    EXPECT_NE(configKeys.end(), std::find(configKeys.begin(), configKeys.end(),
+                                          MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY));
+    EXPECT_EQ(std::string{MultiDeviceConfigParams::MULTI_PRIORITY},
+              multiNetwork->GetConfig(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY).as<std::string>());
+
+    auto latencyAwareNetwork = makeMultiNetwork(1, MultiDeviceConfigParams::MULTI_LATENCY_AWARE);
+    EXPECT_EQ(std::string{MultiDeviceConfigParams::MULTI_LATENCY_AWARE},
+              latencyAwareNetwork->GetConfig(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY).as<std::string>());
+}
+
+TEST_F(MultiExecutableNetworkTests, priorityPolicyUsesFirstDeviceWithIdleRequest) {
+    auto multiNetwork = makeMultiNetwork(1);
+    EXPECT_EQ("CPU", schedule(multiNetwork));
+    EXPECT_EQ("GPU", schedule(multiNetwork));
+
+    // no idle requests, the task waits for the first completed one
+    auto queuedTo = std::make_shared<DeviceName>();
+    auto numCompleted = std::make_shared<int>(0);
+    EXPECT_EQ("", schedule(multiNetwork, queuedTo, numCompleted));
+    complete("GPU");
+    EXPECT_EQ("GPU", *queuedTo);
+    EXPECT_EQ(0, *numCompleted);
+    complete("GPU");
+    EXPECT_EQ(1, *numCompleted);
+    EXPECT_EQ("GPU", schedule(multiNetwork));
+}
+
+TEST_F(MultiExecutableNetworkTests, queueDepthMetricCountsRequestsInFlight) {
+    auto multiNetwork = makeMultiNetwork(2);
+    const auto queueDepthKey = MULTI_METRIC_KEY(DEVICE_QUEUE_DEPTH);
+    using QueueDepth = std::map<std::string, unsigned int>;
+    EXPECT_EQ((QueueDepth{{"CPU", 0}, {"GPU", 0}}), metric<unsigned int>(multiNetwork, queueDepthKey));
+
+    EXPECT_EQ("CPU", schedule(multiNetwork));
+    EXPECT_EQ("CPU", schedule(multiNetwork));
+    EXPECT_EQ("GPU", schedule(multiNetwork));
+    EXPECT_EQ((QueueDepth{{"CPU", 2}, {"GPU", 1}}), metric<unsigned int>(multiNetwork, queueDepthKey));
+
+    complete("CPU", 1);
+    EXPECT_EQ((QueueDepth{{"CPU", 1}, {"GPU", 1}}), metric<unsigned int>(multiNetwork, queueDepthKey));
+    complete("CPU", 0);
+    complete("GPU", 0);
+    EXPECT_EQ((QueueDepth{{"CPU", 0}, {"GPU", 0}}), metric<unsigned int>(multiNetwork, queueDepthKey));
+
+    auto metrics = multiNetwork->GetMetric(METRIC_KEY(SUPPORTED_METRICS)).as<std::vector<std::string>>();
+    EXPECT_NE(metrics.end(), std::find(metrics.begin(), metrics.end(), queueDepthKey));
+}
+
+TEST_F(MultiExecutableNetworkTests, throughputMetricIsEstimatedFromCompletedRequests) {
+    auto multiNetwork = makeMultiNetwork(2);
+    const auto throughputKey = MULTI_METRIC_KEY(DEVICE_THROUGHPUT);
+    using Throughput = std::map<std::string, float>;
+    EXPECT_EQ((Throughput{{"CPU", 0.f}, {"GPU", 0.f}}), metric<float>(multiNetwork, throughputKey));
+
+    EXPECT_EQ("CPU", schedule(multiNetwork));
+    complete("CPU");
+    auto throughput = metric<float>(multiNetwork, throughputKey);
+    EXPECT_GT(throughput.at("CPU"), 0.f);
+    EXPECT_EQ(0.f, throughput.at("GPU"));
+
+    // the estimate is the number of device requests over the average latency
+    multiNetwork->_deviceStatistics.at("GPU").Update(std::chrono::milliseconds(10));
+    EXPECT_FLOAT_EQ(200.f, metric<float>(multiNetwork, throughputKey).at("GPU"));
+
+    auto metrics = multiNetwork->GetMetric(METRIC_KEY(SUPPORTED_METRICS)).as<std::vector<std::string>>();
+    EXPECT_NE(metrics.end(), std::find(metrics.begin(), metrics.end(), throughputKey));
+}
+
+TEST_F(MultiExecutableNetworkTests, latencyAwarePolicyPrefersFasterDevice) {
+    auto priorityNetwork = makeMultiNetwork(1);
+    priorityNetwork->_deviceStatistics.at("CPU").Update(std::chrono::milliseconds(100));
+    priorityNetwork->_deviceStatistics.at("GPU").Update(std::chrono::milliseconds(10));
+    EXPECT_EQ("CPU", schedule(priorityNetwork));
+
+    auto latencyAwareNetwork = makeMultiNetwork(1, MultiDeviceConfigParams::MULTI_LATENCY_AWARE);
+    latencyAwareNetwork->_deviceStatistics.at("CPU").Update(std::chrono::milliseconds(100));
+    latencyAwareNetwork->_deviceStatistics.at("GPU").Update(std::chrono::milliseconds(10));
+    EXPECT_EQ("GPU", schedule(latencyAwareNetwork));
+    // the faster device is busy, so the slower one is used rather than waiting
+    EXPECT_EQ("CPU", schedule(latencyAwareNetwork));
+}
+
+TEST_F(MultiExecutableNetworkTests, latencyAwarePolicyAccountsForRequestsInFlight) {
+    auto multiNetwork = makeMultiNetwork(2, MultiDeviceConfigParams::MULTI_LATENCY_AWARE);
+    // the predicted completion is the average latency * (requests in flight + 1) / device requests,
+    // i.e. CPU 10 * 1 / 2 = 5ms and GPU 15 * 1 / 2 = 7.5ms for the idle devices
+    multiNetwork->_deviceStatistics.at("CPU").Update(std::chrono::milliseconds(10));
+    multiNetwork->_deviceStatistics.at("GPU").Update(std::chrono::milliseconds(15));
+    EXPECT_EQ("CPU", schedule(multiNetwork));
+    // CPU 10 * 2 / 2 = 10ms vs GPU 7.5ms
+    EXPECT_EQ("GPU", schedule(multiNetwork));
+    // CPU 10ms vs GPU 15 * 2 / 2 = 15ms
+    EXPECT_EQ("CPU", schedule(multiNetwork));
+}
+
+TEST_F(MultiExecutableNetworkTests, latencyAwarePolicyKeepsPriorityOrderForUnmeasuredDevices) {
+    auto multiNetwork = makeMultiNetwork(1, MultiDeviceConfigParams::MULTI_LATENCY_AWARE);
+    EXPECT_EQ("CPU", schedule(multiNetwork));
+    EXPECT_EQ("GPU", schedule(multiNetwork));
+}
@@ -0,0 +1,119 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "multi_device_exec_network.hpp"
+
+using MultiDevicePlugin::ThreadSafeBoundedQueue;
+
+TEST(ThreadSafeBoundedQueueTests, rejectsPushBeyondCapacity) {
+    ThreadSafeBoundedQueue<int> queue;
+    queue.set_capacity(4);
+    for (int i = 0; i < 4; i++) {
+        ASSERT_TRUE(queue.try_push(i));
+    }
+    EXPECT_EQ(4u, queue.size());
+    EXPECT_FALSE(queue.try_push(4));
+
+    int value = -1;
+    ASSERT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(0, value);
+    EXPECT_TRUE(queue.try_push(4));
+    EXPECT_FALSE(queue.try_push(5));
+}
+
+TEST(ThreadSafeBoundedQueueTests, capacityIsRoundedUpToPowerOfTwo) {
+    ThreadSafeBoundedQueue<int> queue;
+    queue.set_capacity(5);
+    for (int i = 0; i < 8; i++) {
+        ASSERT_TRUE(queue.try_push(i));
+    }
+    EXPECT_FALSE(queue.try_push(8));
+}
+
+TEST(ThreadSafeBoundedQueueTests, popsInPushOrderAcrossWrapAround) {
+    ThreadSafeBoundedQueue<int> queue;
+    queue.set_capacity(2);
+    int value = -1;
+    EXPECT_FALSE(queue.try_pop(value));
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(queue.try_push(2 * i));
+        ASSERT_TRUE(queue.try_push(2 * i + 1));
+        ASSERT_TRUE(queue.try_pop(value));
+        EXPECT_EQ(2 * i, value);
+        ASSERT_TRUE(queue.try_pop(value));
+        EXPECT_EQ(2 * i + 1, value);
+        EXPECT_FALSE(queue.try_pop(value));
+    }
+    EXPECT_EQ(0u, queue.size());
+}
+
+TEST(ThreadSafeBoundedQueueTests, zeroCapacityStopsPushAndPop) {
+    ThreadSafeBoundedQueue<int> queue;
+    int value = -1;
+    EXPECT_FALSE(queue.try_push(0));
+    EXPECT_FALSE(queue.try_pop(value));
+
+    queue.set_capacity(4);
+    ASSERT_TRUE(queue.try_push(0));
+    queue.set_capacity(0);
+    EXPECT_FALSE(queue.try_push(1));
+    EXPECT_FALSE(queue.try_pop(value));
+}
+
+// the threads pass the fixed set of values (like the idle worker requests) through the queue,
+// every value must be owned by at most one thread at a time and none of the values may be lost or duplicated
+TEST(ThreadSafeBoundedQueueTests, concurrentPushPopKeepsEveryValueOnce) {
+    constexpr int numValues = 8;
+    constexpr int numThreads = 8;
+    constexpr int numIterations = 20000;
+    ThreadSafeBoundedQueue<int> queue;
+    queue.set_capacity(numValues);
+    for (int i = 0; i < numValues; i++) {
+        ASSERT_TRUE(queue.try_push(i));
+    }
+
+    std::vector<std::atomic<bool>> owned(numValues);
+    for (auto&& o : owned) {
+        o = false;
+    }
+    std::atomic<int> numDoubleOwnerships{0};
+    std::atomic<int> numFailedPushes{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; t++) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < numIterations; i++) {
+                int value = -1;
+                while (!queue.try_pop(value)) {
+                    std::this_thread::yield();
+                }
+                if (owned[value].exchange(true)) {
+                    numDoubleOwnerships++;
+                }
+                owned[value] = false;
+                if (!queue.try_push(value)) {
+                    numFailedPushes++;
+                }
+            }
+        });
+    }
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(0, numDoubleOwnerships);
+    EXPECT_EQ(0, numFailedPushes);
+
+    ASSERT_EQ(static_cast<std::size_t>(numValues), queue.size());
+    std::vector<int> counts(numValues, 0);
+    int value = -1;
+    while (queue.try_pop(value)) {
+        counts[value]++;
+    }
+    EXPECT_EQ(std::vector<int>(numValues, 1), counts);
+}
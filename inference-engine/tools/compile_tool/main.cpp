@@ -5,10 +5,16 @@
 #include <cstdlib>
 #include <iostream>
 #include <fstream>
+#include <sstream>
+#include <iomanip>
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <map>
+#include <set>
 #include <vector>
 #include <string>
 
@@ -26,10 +32,12 @@ static constexpr char help_message[] =
                                              "Optional. Print the usage message.";
 
 static constexpr char model_message[] =
-                                             "Required. Path to the XML model.";
+                                             "Required. Path to the XML model.\n"
+"                                             Not used in the batch mode (see -manifest).";
 
 static constexpr char targetDeviceMessage[] =
                                              "Required. Specify a target device for which executable network will be compiled.\n"
+"                                             Not used in the batch mode (see -manifest).\n"
 "                                             Use \"-d HETERO:<comma-separated_devices_list>\" format to specify HETERO plugin.\n"
 "                                             Use \"-d MULTI:<comma-separated_devices_list>\" format to specify MULTI plugin.\n"
 "                                             The application looks for a suitable plugin for the specified device.";
@@ -67,6 +75,26 @@ static constexpr char iol_message[] =
 "                                             Notice that quotes are required.\n"
 "                                             Overwrites layout from il and ol options for specified layers.";
 
+// Batch compilation
+static constexpr char manifest_message[] =
+                                             "Required for the batch mode. Path to the manifest file with the networks to compile.\n"
+"                                             Each line describes one network: \"<model_xml> <device> [<option>=<value> ...]\",\n"
+"                                             where options are: config, shape, ip, op, iop, il, ol, iol.\n"
+"                                             Example: \"model.xml CPU shape=data[1,3,224,224] iop=data:U8\".\n"
+"                                             Option values must not contain spaces. Lines starting with '#' are skipped.";
+
+static constexpr char cache_dir_message[] =
+                                             "Required for the batch mode. Path to the directory to store the compiled networks to.\n"
+"                                             The directory can be used as the CACHE_DIR of the Inference Engine Core.";
+
+static constexpr char jobs_message[] =
+                                             "Optional. Number of networks compiled in parallel in the batch mode.\n"
+"                                             Default value: number of the hardware threads.";
+
+static constexpr char report_message[] =
+                                             "Optional. Path to the CSV report with the compilation time and the peak memory per network.\n"
+"                                             Default value: \"<cache_dir>/compile_report.csv\".";
+
 // MYRIAD-specific
 static constexpr char number_of_shaves_message[] =
                                              "Optional. Specifies number of shaves.\n"
@@ -99,6 +127,10 @@ DEFINE_string(iop, "", iop_message);
 DEFINE_string(il, "", inputs_layout_message);
 DEFINE_string(ol, "", outputs_layout_message);
 DEFINE_string(iol, "", iol_message);
+DEFINE_string(manifest, "", manifest_message);
+DEFINE_string(cache_dir, "", cache_dir_message);
+DEFINE_uint32(j, 0, jobs_message);
+DEFINE_string(report, "", report_message);
 DEFINE_string(VPU_NUMBER_OF_SHAVES, "", number_of_shaves_message);
 DEFINE_string(VPU_NUMBER_OF_CMX_SLICES, "", number_of_cmx_slices_message);
 DEFINE_string(VPU_TILING_CMX_LIMIT_KB, "", tiling_cmx_limit_message);
@@ -120,6 +152,12 @@ static void showUsage() {
     std::cout << "    -ol                          <value>     "   << outputs_layout_message       << std::endl;
     std::cout << "    -iol                        \"<value>\"    "   << iol_message                << std::endl;
     std::cout                                                                                      << std::endl;
+    std::cout << " Batch compilation options:                  "                                   << std::endl;
+    std::cout << "    -manifest                    <value>     "   << manifest_message             << std::endl;
+    std::cout << "    -cache_dir                   <value>     "   << cache_dir_message            << std::endl;
+    std::cout << "    -j                           <value>     "   << jobs_message                 << std::endl;
+    std::cout << "    -report                      <value>     "   << report_message               << std::endl;
+    std::cout                                                                                      << std::endl;
     std::cout << " MYRIAD-specific options:                    "                                   << std::endl;
     std::cout << "      -VPU_NUMBER_OF_SHAVES      <value>     "   << number_of_shaves_message     << std::endl;
     std::cout << "      -VPU_NUMBER_OF_CMX_SLICES  <value>     "   << number_of_cmx_slices_message << std::endl;
@@ -138,12 +176,21 @@ static bool parseCommandLine(int* argc, char*** argv) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
-        throw std::invalid_argument("Path to model xml file is required");
-    }
+    if (!FLAGS_manifest.empty()) {
+        if (!FLAGS_m.empty() || !FLAGS_d.empty()) {
+            throw std::invalid_argument("-m and -d options can't be used together with the manifest");
+        }
+        if (FLAGS_cache_dir.empty()) {
+            throw std::invalid_argument("Path to the cache directory is required for the batch mode");
+        }
+    } else {
+        if (FLAGS_m.empty()) {
+            throw std::invalid_argument("Path to model xml file is required");
+        }
 
-    if (FLAGS_d.empty()) {
-        throw std::invalid_argument("Target device name is required");
+        if (FLAGS_d.empty()) {
+            throw std::invalid_argument("Target device name is required");
+        }
     }
 
     if (1 < *argc) {
@@ -161,10 +208,10 @@ static bool parseCommandLine(int* argc, char*** argv) {
     return true;
 }
 
-static std::map<std::string, std::string> parseConfigFile(char comment = '#') {
+static std::map<std::string, std::string> parseConfigFile(const std::string& configFile, char comment = '#') {
     std::map<std::string, std::string> config;
 
-    std::ifstream file(FLAGS_c);
+    std::ifstream file(configFile);
     if (file.is_open()) {
         std::string key, value;
         while (file >> key >> value) {
@@ -177,11 +224,11 @@ static std::map<std::string, std::string> parseConfigFile(char comment = '#') {
     return config;
 }
 
-static std::map<std::string, std::string> configure() {
-    const bool isMYRIAD = FLAGS_d.find("MYRIAD") != std::string::npos;
-    const bool isFPGA = FLAGS_d.find("FPGA") != std::string::npos;
+static std::map<std::string, std::string> configure(const std::string& device, const std::string& configFile) {
+    const bool isMYRIAD = device.find("MYRIAD") != std::string::npos;
+    const bool isFPGA = device.find("FPGA") != std::string::npos;
 
-    auto config = parseConfigFile();
+    auto config = parseConfigFile(configFile);
 
     if (isMYRIAD) {
 IE_SUPPRESS_DEPRECATED_START
@@ -222,9 +269,9 @@ bool isFloat(InferenceEngine::Precision precision) {
     return isFP16(precision) || isFP32(precision);
 }
 
-static void setDefaultIO(InferenceEngine::CNNNetwork& network) {
-    const bool isMYRIAD = FLAGS_d.find("MYRIAD") != std::string::npos;
-    const bool isVPUX = FLAGS_d.find("VPUX") != std::string::npos;
+static void setDefaultIO(InferenceEngine::CNNNetwork& network, const std::string& device) {
+    const bool isMYRIAD = device.find("MYRIAD") != std::string::npos;
+    const bool isVPUX = device.find("VPUX") != std::string::npos;
 
     if (isMYRIAD) {
         const InferenceEngine::Precision fp16 = InferenceEngine::Precision::FP16;
@@ -272,6 +319,216 @@ std::string getFileNameFromPath(const std::string& path,
 
 using TimeDiff = std::chrono::milliseconds;
 
+struct ManifestEntry {
+    std::string model;
+    std::string device;
+    std::string config;
+    std::string shape;
+    std::string ip, op, iop;
+    std::string il, ol, iol;
+};
+
+struct CompileResult {
+    bool succeeded = false;
+    TimeDiff time {0};
+    long peakMemoryKb = -1;
+    std::string error;
+};
+
+static std::vector<ManifestEntry> parseManifest(const std::string& manifestFile) {
+    std::ifstream file(manifestFile);
+    if (!file.is_open()) {
+        throw std::invalid_argument("Manifest file " + manifestFile + " can't be opened for reading");
+    }
+
+    std::vector<ManifestEntry> entries;
+    std::string line;
+    for (std::size_t lineNumber = 1; std::getline(file, line); ++lineNumber) {
+        std::istringstream tokens(line);
+        ManifestEntry entry;
+        if (!(tokens >> entry.model) || entry.model[0] == '#') {
+            continue;
+        }
+        if (!(tokens >> entry.device)) {
+            throw std::invalid_argument("Manifest line " + std::to_string(lineNumber) + ": target device name is required");
+        }
+
+        const std::map<std::string, std::string ManifestEntry::*> options = {
+            {"config", &ManifestEntry::config}, {"shape", &ManifestEntry::shape},
+            {"ip", &ManifestEntry::ip}, {"op", &ManifestEntry::op}, {"iop", &ManifestEntry::iop},
+            {"il", &ManifestEntry::il}, {"ol", &ManifestEntry::ol}, {"iol", &ManifestEntry::iol},
+        };
+        std::string option;
+        while (tokens >> option) {
+            const auto pos = option.find('=');
+            const auto it = options.find(option.substr(0, pos));
+            if (pos == std::string::npos || it == options.end()) {
+                throw std::invalid_argument("Manifest line " + std::to_string(lineNumber) + ": unknown option " + option);
+            }
+            entry.*(it->second) = option.substr(pos + 1);
+        }
+        entries.push_back(entry);
+    }
+    return entries;
+}
+
+// Parses shapes in "input1[1,3,224,224],input2[1,4]" format
+static InferenceEngine::ICNNNetwork::InputShapes parseShapes(const std::string& shapes) {
+    InferenceEngine::ICNNNetwork::InputShapes result;
+    std::size_t begin = 0;
+    while (begin < shapes.size()) {
+        const auto open = shapes.find('[', begin);
+        const auto close = shapes.find(']', open);
+        if (open == std::string::npos || close == std::string::npos) {
+            throw std::invalid_argument("Can't parse shape " + shapes + ". Expected <input_name>[<dims>]");
+        }
+        auto& dims = result[shapes.substr(begin, open - begin)];
+        std::istringstream dimsStream(shapes.substr(open + 1, close - open - 1));
+        std::string dim;
+        while (std::getline(dimsStream, dim, ',')) {
+            dims.push_back(std::stoul(dim));
+        }
+        begin = close + 1;
+        if (begin < shapes.size() && shapes[begin] == ',') {
+            ++begin;
+        }
+    }
+    return result;
+}
+
+// Peak resident memory of the whole process (the high water mark), -1 if it can't be retrieved
+static long getPeakMemoryKb() {
+#if defined(__linux__)
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) {
+            return std::stol(line.substr(6));
+        }
+    }
+#endif
+    return -1;
+}
+
+// Resets the peak resident memory to the current value, so the next compilation is measured separately
+static void resetPeakMemory() {
+#if defined(__linux__)
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5";
+#endif
+}
+
+static CompileResult compileEntry(InferenceEngine::Core& ie, const ManifestEntry& entry) {
+    CompileResult result;
+    try {
+        auto network = ie.ReadNetwork(entry.model);
+        if (!entry.shape.empty()) {
+            network.reshape(parseShapes(entry.shape));
+        }
+
+        setDefaultIO(network, entry.device);
+        processPrecision(network, entry.ip, entry.op, entry.iop);
+        processLayout(network, entry.il, entry.ol, entry.iol);
+
+        // The Core stores the compiled network to the cache directory under the same hash
+        // as the application computes for this network, device and configuration
+        auto timeBeforeLoadNetwork = std::chrono::steady_clock::now();
+        ie.LoadNetwork(network, entry.device, configure(entry.device, entry.config));
+        result.time = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeLoadNetwork);
+        result.succeeded = true;
+    } catch (const std::exception& error) {
+        result.error = error.what();
+    } catch (...) {
+        result.error = "Unknown/internal exception happened.";
+    }
+    result.peakMemoryKb = getPeakMemoryKb();
+    return result;
+}
+
+static int compileManifest() {
+    const auto entries = parseManifest(FLAGS_manifest);
+
+    InferenceEngine::Core ie;
+    ie.SetConfig({{CONFIG_KEY(CACHE_DIR), FLAGS_cache_dir}});
+
+    std::set<std::string> devices;
+    for (auto&& entry : entries) {
+        devices.insert(entry.device);
+    }
+    for (auto&& device : devices) {
+        const auto deviceName = device.substr(0, device.find_first_of(":."));
+        if (!FLAGS_log_level.empty()) {
+            ie.SetConfig({{CONFIG_KEY(LOG_LEVEL), FLAGS_log_level}}, deviceName);
+        }
+        // MULTI and AUTO store the networks compiled for the underlying devices
+        if (deviceName == "MULTI" || deviceName == "AUTO") {
+            continue;
+        }
+        std::vector<std::string> supportedMetrics = ie.GetMetric(deviceName, METRIC_KEY(SUPPORTED_METRICS));
+        const bool supportsImportExport =
+            std::find(supportedMetrics.begin(), supportedMetrics.end(), METRIC_KEY(IMPORT_EXPORT_SUPPORT)) != supportedMetrics.end() &&
+            ie.GetMetric(deviceName, METRIC_KEY(IMPORT_EXPORT_SUPPORT)).as<bool>();
+        if (!supportsImportExport) {
+            std::cout << "[ WARNING ] " << device << " device doesn't support import/export, "
+                      << "networks compiled for it are not stored to the cache directory" << std::endl;
+        }
+    }
+
+    // With a single job the peak memory is measured for every network separately,
+    // otherwise it is the peak of the whole process while the network was compiled
+    const auto jobs = std::min<std::size_t>(FLAGS_j != 0 ? FLAGS_j : std::max(1u, std::thread::hardware_concurrency()),
+                                            entries.size());
+    std::vector<CompileResult> results(entries.size());
+    std::atomic<std::size_t> nextEntry{0};
+    std::mutex coutMutex;
+    auto worker = [&] {
+        for (auto index = nextEntry++; index < entries.size(); index = nextEntry++) {
+            if (jobs == 1) {
+                resetPeakMemory();
+            }
+            results[index] = compileEntry(ie, entries[index]);
+            std::lock_guard<std::mutex> lock{coutMutex};
+            std::cout << "[" << index + 1 << "/" << entries.size() << "] " << entries[index].model
+                      << " (" << entries[index].device << "): "
+                      << (results[index].succeeded ? "compiled in " + std::to_string(results[index].time.count()) + " ms"
+                                                   : "FAILED: " + results[index].error) << std::endl;
+        }
+    };
+    std::vector<std::thread> workers;
+    for (std::size_t i = 1; i < jobs; ++i) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto&& thread : workers) {
+        thread.join();
+    }
+
+    std::string reportName = FLAGS_report;
+    if (reportName.empty()) {
+        reportName = FLAGS_cache_dir + "/compile_report.csv";
+    }
+    std::ofstream report{reportName};
+    if (!report.is_open()) {
+        std::cout << "Report file " << reportName << " can't be opened for writing" << std::endl;
+        return EXIT_FAILURE;
+    }
+    report << "model,device,status,compile_time_ms,peak_memory_kb,error" << std::endl;
+    std::size_t failed = 0;
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        auto error = results[i].error;
+        std::replace(error.begin(), error.end(), '\n', ' ');
+        std::replace(error.begin(), error.end(), '"', '\'');
+        report << entries[i].model << ',' << entries[i].device << ','
+               << (results[i].succeeded ? "OK" : "FAILED") << ','
+               << results[i].time.count() << ',' << results[i].peakMemoryKb << ",\"" << error << '"' << std::endl;
+        failed += results[i].succeeded ? 0 : 1;
+    }
+
+    std::cout << "Done. Compiled " << entries.size() - failed << " of " << entries.size() << " networks to "
+              << FLAGS_cache_dir << ", report: " << reportName << std::endl;
+    return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
 int main(int argc, char* argv[]) {
     TimeDiff loadNetworkTimeElapsed {0};
 
@@ -283,6 +540,10 @@ int main(int argc, char* argv[]) {
             return EXIT_SUCCESS;
         }
 
+        if (!FLAGS_manifest.empty()) {
+            return compileManifest();
+        }
+
         InferenceEngine::Core ie;
         if (!FLAGS_log_level.empty()) {
             ie.SetConfig({{CONFIG_KEY(LOG_LEVEL), FLAGS_log_level}}, FLAGS_d);
@@ -290,14 +551,14 @@ int main(int argc, char* argv[]) {
 
         auto network = ie.ReadNetwork(FLAGS_m);
 
-        setDefaultIO(network);
+        setDefaultIO(network, FLAGS_d);
         processPrecision(network, FLAGS_ip, FLAGS_op, FLAGS_iop);
         processLayout(network, FLAGS_il, FLAGS_ol, FLAGS_iol);
 
         printInputAndOutputsInfo(network);
 
         auto timeBeforeLoadNetwork = std::chrono::steady_clock::now();
-        auto executableNetwork = ie.LoadNetwork(network, FLAGS_d, configure());
+        auto executableNetwork = ie.LoadNetwork(network, FLAGS_d, configure(FLAGS_d, FLAGS_c));
         loadNetworkTimeElapsed = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeLoadNetwork);
 
         std::string outputName = FLAGS_o;
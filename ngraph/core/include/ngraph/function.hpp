@@ -5,10 +5,13 @@
 #pragma once
 
 #include <atomic>
+#include <functional>
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "ngraph/ngraph_visibility.hpp"
@@ -113,7 +116,15 @@ public:
     const std::string& get_friendly_name() const;
 
     std::vector<std::shared_ptr<Node>> get_ops() const;
+    /// \brief Returns the operations in the topological order. The order is cached by the
+    /// function and sorted again only when the graph was changed since the previous call.
     std::vector<std::shared_ptr<Node>> get_ordered_ops() const;
+    /// \brief Returns the operations of the types accepted by the filter in the topological
+    /// order. The operations are indexed by type, so the filter is called once for one
+    /// operation of each type and the operations of the rejected types are not visited.
+    /// \param type_filter Returns true if the operations of the same type as the given one are
+    /// selected.
+    std::vector<std::shared_ptr<Node>> get_ordered_ops(const std::function<bool(const Node&)>& type_filter) const;
     void map_unordered_ops(std::function<void(Node*)> f) const;
 
     friend std::ostream& operator<<(std::ostream&, const Function&);
@@ -250,12 +261,23 @@ private:
     /// function and registers them, otherwise checks all the Parameters are registered.
     void prerequirements(bool detect_variables, bool detect_parameters);
 
+    /// \brief Sorts the operations again if the graph was changed since the cached order was
+    /// built. Called under m_ordered_ops_mutex.
+    void update_ordered_ops() const;
+
     static std::atomic<size_t> m_next_instance_id;
     std::string m_name;
     const std::string m_unique_name;
     size_t m_placement{0};
     topological_sort_t m_topological_sorter;
 
+    // The nodes are not owned by the cache, so the nodes removed from the graph are released
+    // without waiting for the next get_ordered_ops call.
+    mutable std::mutex m_ordered_ops_mutex;
+    mutable size_t m_ordered_ops_version{0};
+    mutable std::vector<std::weak_ptr<Node>> m_ordered_ops;
+    mutable std::unordered_map<Node::type_info_t, std::vector<size_t>> m_ordered_ops_by_type;
+
     ResultVector m_results;
     // List of the nodes with side effect in graph.
     // These nodes are not outputs of graph but should not be removed even if have no children.
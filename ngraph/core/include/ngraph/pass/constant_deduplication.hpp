@@ -0,0 +1,23 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph {
+namespace pass {
+/**
+ * @brief Constant deduplication merges the Constants of the same element type, shape and content,
+ *        so the consumers share one Constant and its data is kept once. The Constants are compared
+ *        by the hash of the content first. The Constants producing the outputs of the function and
+ *        the Constants with different runtime info keys are not merged.
+ */
+class NGRAPH_API ConstantDeduplication : public FunctionPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+};
+}  // namespace pass
+}  // namespace ngraph
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "ngraph/pass/pass.hpp"
 
 namespace ngraph {
@@ -12,17 +14,34 @@ namespace pass {
  * @brief Constant folding iterates over the function and tries to evaluate nodes
  *        with constant inputs. Such nodes are then replaced with new Constants containing
  *        the result of a folded operation.
+ *
+ *        The nodes are folded level by level: the nodes of a level depend on the previous levels only,
+ *        so the nodes with constant inputs are evaluated in parallel with ngraph::runtime::parallel_for.
+ *        The nodes of a level are released when the level is folded, so the intermediate constants
+ *        are freed as soon as their consumers are folded.
  */
 class NGRAPH_API ConstantFolding : public FunctionPass {
 public:
     NGRAPH_RTTI_DECLARATION;
+
+    static constexpr size_t default_memory_budget = 256 * 1024 * 1024;
+
+    /// \param memory_budget  The maximal total size in bytes of the outputs of the nodes evaluated
+    ///                       in parallel, the nodes with the larger outputs are evaluated one by one
+    explicit ConstantFolding(size_t memory_budget = default_memory_budget);
+
     bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
 private:
     void copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node, const Output<Node>& replacement);
+    /// \brief Runs constant_fold() of the nodes, the ones with constant inputs are evaluated in parallel.
+    /// \return Marks of the folded nodes
+    std::vector<bool> fold_nodes(const NodeVector& nodes, std::vector<OutputVector>& replacements) const;
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ngraph::Function>& f);
+
+    size_t m_memory_budget;
 };
 }  // namespace pass
 }  // namespace ngraph
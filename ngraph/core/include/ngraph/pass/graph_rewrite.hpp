@@ -35,6 +35,8 @@ namespace pass {
 /// takes registered nodes and put them to execution queue. If multiple nodes were register
 /// make
 /// sure that they were registered in topological order.
+/// In this case only the nodes of the root types and the sub-graph operations are taken
+/// from the operation index of the Function, so the other nodes are not visited at all.
 /// Note: when implementing pattern for Matcher make sure that root node is an operation
 /// from opset
 /// or has ngraph::pattern::op::WrapType. That will help GraphRewrite to execute matcher
@@ -111,6 +113,8 @@ private:
 /// root node in Matcher pattern then efficient mechanism is used to execute them.
 /// Matcher pattern root is type based if it's operation from opset or
 /// pattern::op::WrapType.
+/// In this case only the nodes of the root types and the sub-graph operations are taken
+/// from the operation index of the Function, so the other nodes are not visited at all.
 /// Note: when implementing pattern for Matcher make sure that root node is an operation
 /// from opset
 /// or has ngraph::pattern::op::WrapType. That will help GraphRewrite to execute matcher
@@ -207,7 +211,20 @@ public:
 
     void set_pass_config(const std::shared_ptr<PassConfig>& pass_config) override;
 
+    /// \brief Returns the number of nodes taken from the execution queues by all GraphRewrite
+    /// passes of the process
+    static size_t get_visited_nodes_count();
+
+    /// \brief Returns the number of MatcherPass applications made by all GraphRewrite passes
+    /// of the process
+    static size_t get_matcher_calls_count();
+
 protected:
+    /// \brief Returns the nodes in topological order the registered matchers may be applied
+    /// to: the nodes of the matcher root types if all of the roots are type based or all the
+    /// nodes otherwise
+    std::vector<std::shared_ptr<Node>> get_nodes_to_run(const std::shared_ptr<Function>& f);
+
     bool apply_matcher_passes(std::shared_ptr<Function> f, std::deque<std::weak_ptr<Node>> nodes_to_run);
 
     bool m_enable_shape_inference = false;
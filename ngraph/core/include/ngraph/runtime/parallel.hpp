@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph {
+namespace runtime {
+/// \brief Processes the iterations [begin, end) of a parallel loop
+using ParallelForBody = std::function<void(size_t begin, size_t end)>;
+
+/// \brief Splits the iterations [0, work_amount) into the chunks and runs the body for every chunk,
+/// the call returns when all the chunks are processed
+using ParallelForBackend = std::function<void(size_t work_amount, const ParallelForBody& body)>;
+
+/// \brief Sets the threading backend of the reference kernels, e.g. the one of the Inference Engine
+/// runtime. The kernels are sequential until a backend is set, the empty backend makes them sequential again.
+NGRAPH_API
+void set_parallel_for_backend(ParallelForBackend backend);
+
+/// \brief Runs the body over the iterations [0, work_amount) with the threading backend.
+///
+/// \param work_amount  The number of the iterations
+/// \param body         The function processing a chunk of the iterations, must be thread safe
+/// \param min_chunk    The minimal number of the iterations worth to be run by a separate thread,
+///                     the smaller loops are processed by the calling thread
+NGRAPH_API
+void parallel_for(size_t work_amount, const ParallelForBody& body, size_t min_chunk = 1);
+}  // namespace runtime
+}  // namespace ngraph
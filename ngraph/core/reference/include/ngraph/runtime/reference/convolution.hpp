@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <cfenv>
 #include <cmath>
@@ -13,6 +14,7 @@
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/runtime/reference/concat.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/runtime/reference/helpers.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/runtime/reference/split.hpp"
@@ -234,15 +236,21 @@ void convolution(const T* in,
     const Shape filter_shape(++filters_shape.begin(), filters_shape.end());
     const size_t filter_size = shape_size(filter_shape);
 
-    auto batch = in;
-    for (size_t batch_idx = 0; batch_idx < batches_count; ++batch_idx) {
-        auto filter = f;
-        for (size_t f_idx = 0; f_idx < filters_count; ++f_idx) {
-            convolve_3D_channels(params, batch, batch_shape, filter, filter_shape, out);
-            filter += filter_size;
+    // the output channels of the batches are computed in parallel
+    const size_t out_channel_size = shape_size(out_shape) / std::max<size_t>(batches_count * filters_count, 1);
+    runtime::parallel_for(batches_count * filters_count, [&](size_t begin, size_t end) {
+        for (size_t idx = begin; idx < end; ++idx) {
+            const size_t batch_idx = idx / filters_count;
+            const size_t f_idx = idx % filters_count;
+            T* out_channel = out + idx * out_channel_size;
+            convolve_3D_channels(params,
+                                 in + batch_idx * batch_size,
+                                 batch_shape,
+                                 f + f_idx * filter_size,
+                                 filter_shape,
+                                 out_channel);
         }
-        batch += batch_size;
-    }
+    });
 }
 }  // namespace reference
 }  // namespace runtime
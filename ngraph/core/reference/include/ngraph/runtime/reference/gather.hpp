@@ -4,14 +4,19 @@
 
 #pragma once
 
+#include <algorithm>
 #include <numeric>
 
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/shape.hpp"
 #include "utils/span.hpp"
 
 namespace ngraph {
 namespace runtime {
 namespace reference {
+// the number of the elements worth to be gathered by a separate thread
+constexpr int64_t gather_min_elements_per_thread = 16 * 1024;
+
 template <typename T, typename U>
 void gather(const T* const data,
             const U* const indices,
@@ -32,28 +37,36 @@ void gather(const T* const data,
     int64_t batch_indices_mul = shape_size(span(indices_shape).subspan(batch_dims));
 
     int64_t axis_size = data_shape[axis];
-    int64_t data_offset, out_offset, idx;
-
-    for (int64_t batch = 0; batch < batch_size; batch++)
-        for (int64_t outer_idx = 0; outer_idx < outer_size; outer_idx++) {
-            data_offset = batch_data_mul * batch + inner_size * axis_size * outer_idx;
-            out_offset = batch_out_mul * batch + indices_size * inner_size * outer_idx;
-            for (int64_t i = 0; i < indices_size; i++) {
-                idx = indices[i + batch_indices_mul * batch];
-                // clang-format off
-                            // todo: check if bound check is needed
-                            // if (idx >= axis_size || (idx < 0 && -idx >= axis_size))
-                            //    throw std::domain_error{"indices values of Gather exceed size along axis"};
-                // clang-format on
-                if (idx < 0)
-                    idx += axis_size;
-
-                const auto src_begin = std::next(data, data_offset + inner_size * idx);
-                const auto src_end = std::next(src_begin, inner_size);
-                const auto out_ptr = std::next(out, out_offset + inner_size * i);
-                std::copy(src_begin, src_end, out_ptr);
+
+    // the outer slices of the batches are gathered to the separate parts of the output in parallel
+    const size_t min_slices_per_thread =
+        std::max<int64_t>(1, gather_min_elements_per_thread / std::max<int64_t>(1, indices_size * inner_size));
+    runtime::parallel_for(
+        batch_size * outer_size,
+        [&](size_t begin, size_t end) {
+            for (size_t slice = begin; slice < end; slice++) {
+                const int64_t batch = slice / outer_size;
+                const int64_t outer_idx = slice % outer_size;
+                const int64_t data_offset = batch_data_mul * batch + inner_size * axis_size * outer_idx;
+                const int64_t out_offset = batch_out_mul * batch + indices_size * inner_size * outer_idx;
+                for (int64_t i = 0; i < indices_size; i++) {
+                    int64_t idx = indices[i + batch_indices_mul * batch];
+                    // clang-format off
+                    // todo: check if bound check is needed
+                    // if (idx >= axis_size || (idx < 0 && -idx >= axis_size))
+                    //    throw std::domain_error{"indices values of Gather exceed size along axis"};
+                    // clang-format on
+                    if (idx < 0)
+                        idx += axis_size;
+
+                    const auto src_begin = std::next(data, data_offset + inner_size * idx);
+                    const auto src_end = std::next(src_begin, inner_size);
+                    const auto out_ptr = std::next(out, out_offset + inner_size * i);
+                    std::copy(src_begin, src_end, out_ptr);
+                }
             }
-        }
+        },
+        min_slices_per_thread);
 }
 
 }  // namespace reference
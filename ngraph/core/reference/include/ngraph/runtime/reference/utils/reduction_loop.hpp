@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/parallel.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+/// \brief Calls f(out_idx, in_idx) for every element of the input reduced by the axes. The output elements
+/// are split between the threads with runtime::parallel_for, the input elements of an output element are
+/// visited in the row major order by the same thread, so the result doesn't depend on the number of the threads.
+template <typename F>
+void reduction_loop(const Shape& in_shape, const AxisSet& reduction_axes, F&& f) {
+    const auto in_strides = row_major_strides(in_shape);
+    Shape kept_shape, reduced_shape;
+    std::vector<int64_t> kept_strides, reduced_strides;
+    for (size_t i = 0; i < in_shape.size(); ++i) {
+        if (reduction_axes.count(i)) {
+            reduced_shape.push_back(in_shape[i]);
+            reduced_strides.push_back(in_strides[i]);
+        } else {
+            kept_shape.push_back(in_shape[i]);
+            kept_strides.push_back(in_strides[i]);
+        }
+    }
+
+    const size_t out_size = shape_size(kept_shape);
+    const size_t reduced_size = shape_size(reduced_shape);
+    if (reduced_size == 0) {
+        return;
+    }
+
+    constexpr size_t min_elements_per_thread = 16 * 1024;
+    runtime::parallel_for(
+        out_size,
+        [&](size_t begin, size_t end) {
+            std::vector<size_t> counter(reduced_shape.size());
+            for (size_t out_idx = begin; out_idx < end; ++out_idx) {
+                int64_t in_idx = 0;
+                for (size_t d = kept_shape.size(), rest = out_idx; d-- > 0;) {
+                    in_idx += static_cast<int64_t>(rest % kept_shape[d]) * kept_strides[d];
+                    rest /= kept_shape[d];
+                }
+                for (size_t r = 0; r < reduced_size; ++r) {
+                    f(out_idx, static_cast<size_t>(in_idx));
+                    for (size_t d = reduced_shape.size(); d-- > 0;) {
+                        in_idx += reduced_strides[d];
+                        if (++counter[d] < reduced_shape[d]) {
+                            break;
+                        }
+                        in_idx -= reduced_strides[d] * static_cast<int64_t>(reduced_shape[d]);
+                        counter[d] = 0;
+                    }
+                }
+            }
+        },
+        std::max<size_t>(1, min_elements_per_thread / reduced_size));
+}
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
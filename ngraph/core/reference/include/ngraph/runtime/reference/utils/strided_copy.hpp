@@ -0,0 +1,33 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "ngraph/shape.hpp"
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+/// \brief Fills the output in the row major order from the strided input. The element of the output
+/// coordinate c is read at the input element offset in_offset + sum(c[i] * in_strides[i]).
+/// The rows of the output are copied in parallel with runtime::parallel_for.
+///
+/// \param in          The input data
+/// \param out         The output data of the out_shape
+/// \param out_shape   The output shape
+/// \param in_strides  The input strides of the output dimensions in elements, zero repeats the input
+/// \param in_offset   The input offset of the first output element in elements
+/// \param elem_size   The size of the element in bytes
+void strided_copy(const char* in,
+                  char* out,
+                  const Shape& out_shape,
+                  const std::vector<int64_t>& in_strides,
+                  int64_t in_offset,
+                  size_t elem_size);
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
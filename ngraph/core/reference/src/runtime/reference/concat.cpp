@@ -4,12 +4,18 @@
 
 #include "ngraph/runtime/reference/concat.hpp"
 
+#include <algorithm>
 #include <cstring>
 
+#include "ngraph/runtime/parallel.hpp"
+
 namespace ngraph {
 namespace runtime {
 namespace reference {
 namespace {
+// the number of the elements worth to be copied by a separate thread
+constexpr size_t min_elements_per_thread = 16 * 1024;
+
 std::vector<size_t> calculate_shape_sizes(const std::vector<Shape>& in_shapes) {
     std::vector<size_t> sizes;
     sizes.reserve(in_shapes.size());
@@ -33,17 +39,25 @@ void concat(const std::vector<const char*>& args,
 
     const auto& shape_sizes = calculate_shape_sizes(in_shapes);
 
-    size_t out_offset = 0;
-    for (size_t step = 0; step < steps; ++step) {
-        for (size_t in_index = 0; in_index < args.size(); ++in_index) {
-            const size_t size = shape_sizes[in_index] / steps;
-            const size_t in_offset = step * size;
+    const size_t step_size = shape_size(out_shape) / std::max<size_t>(steps, 1);
 
-            std::memcpy(&out[out_offset * elem_size], &args[in_index][in_offset * elem_size], size * elem_size);
+    // the steps write the separate parts of the output, so they are copied in parallel
+    runtime::parallel_for(
+        steps,
+        [&](size_t begin, size_t end) {
+            size_t out_offset = begin * step_size;
+            for (size_t step = begin; step < end; ++step) {
+                for (size_t in_index = 0; in_index < args.size(); ++in_index) {
+                    const size_t size = shape_sizes[in_index] / steps;
+                    const size_t in_offset = step * size;
 
-            out_offset += size;
-        }
-    }
+                    std::memcpy(&out[out_offset * elem_size], &args[in_index][in_offset * elem_size], size * elem_size);
+
+                    out_offset += size;
+                }
+            }
+        },
+        std::max<size_t>(1, min_elements_per_thread / std::max<size_t>(step_size, 1)));
 }
 }  // namespace reference
 }  // namespace runtime
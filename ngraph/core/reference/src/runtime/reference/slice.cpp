@@ -4,10 +4,8 @@
 
 #include "ngraph/runtime/reference/slice.hpp"
 
-#include <cstring>
-
 #include "ngraph/check.hpp"
-#include "ngraph/coordinate_range.hpp"
+#include "ngraph/runtime/reference/utils/strided_copy.hpp"
 
 namespace ngraph {
 namespace runtime {
@@ -20,24 +18,29 @@ void slice(const char* arg,
            const Strides& strides,
            const Shape& out_shape,
            size_t elem_size) {
-    NGRAPH_SUPPRESS_DEPRECATED_START
-    const CoordinateTransform input_transform(arg_shape, lower_bounds, upper_bounds, strides);
-
-    const CoordinateTransform output_transform(out_shape);
-
-    NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) == shape_size(output_transform.get_target_shape()));
+    const size_t rank = arg_shape.size();
+    NGRAPH_CHECK(lower_bounds.size() == rank && upper_bounds.size() == rank && strides.size() == rank,
+                 "Slice bounds and strides are not defined for all the input dimensions");
+
+    // the output dimension walks the input axis with the slice stride from the lower bound
+    const auto arg_strides = row_major_strides(arg_shape);
+    Shape slice_shape(rank);
+    std::vector<int64_t> in_strides(rank);
+    int64_t in_offset = 0;
+    for (size_t i = 0; i < rank; ++i) {
+        NGRAPH_CHECK(upper_bounds[i] <= arg_shape[i] && strides[i] > 0,
+                     "Slice bounds are out of the input shape ",
+                     arg_shape);
+        slice_shape[i] = upper_bounds[i] > lower_bounds[i]
+                             ? (upper_bounds[i] - lower_bounds[i] + strides[i] - 1) / strides[i]
+                             : 0;
+        in_strides[i] = arg_strides[i] * strides[i];
+        in_offset += lower_bounds[i] * arg_strides[i];
+    }
 
-    auto dst_mem = out;
+    NGRAPH_CHECK(shape_size(slice_shape) == shape_size(out_shape));
 
-    for (auto range : coordinates::slice(arg_shape, lower_bounds, upper_bounds, strides)) {
-        auto src_index = range.begin_index;
-        for (size_t i = 0; i < range.element_number; src_index += range.step, ++i) {
-            const auto src_mem = arg + src_index * elem_size;
-            std::memcpy(dst_mem, src_mem, elem_size);
-            std::advance(dst_mem, elem_size);
-        }
-    }
-    NGRAPH_SUPPRESS_DEPRECATED_END
+    strided_copy(arg, out, slice_shape, in_strides, in_offset, elem_size);
 }
 }  // namespace reference
 }  // namespace runtime
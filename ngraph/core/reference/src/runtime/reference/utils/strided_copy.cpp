@@ -0,0 +1,146 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/runtime/reference/utils/strided_copy.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/parallel.hpp"
+
+using namespace ngraph;
+
+namespace {
+// the number of the elements worth to be copied by a separate thread
+constexpr size_t min_elements_per_thread = 16 * 1024;
+
+// drops the dimensions of the size 1 and merges the dimensions contiguous in the input, so the rows are
+// as long as possible
+void simplify(Shape& shape, std::vector<int64_t>& strides) {
+    Shape simple_shape;
+    std::vector<int64_t> simple_strides;
+    for (size_t i = 0; i < shape.size(); ++i) {
+        if (shape[i] == 1) {
+            continue;
+        }
+        if (!simple_shape.empty() && simple_strides.back() == strides[i] * static_cast<int64_t>(shape[i])) {
+            simple_shape.back() *= shape[i];
+            simple_strides.back() = strides[i];
+        } else {
+            simple_shape.push_back(shape[i]);
+            simple_strides.push_back(strides[i]);
+        }
+    }
+    if (simple_shape.empty()) {
+        simple_shape.push_back(1);
+        simple_strides.push_back(1);
+    }
+    shape.swap(simple_shape);
+    strides.swap(simple_strides);
+}
+
+template <typename T>
+void copy_row(const T* in, T* out, size_t size, int64_t step) {
+    if (step == 1) {
+        std::memcpy(out, in, size * sizeof(T));
+    } else if (step == 0) {
+        std::fill(out, out + size, *in);
+    } else {
+        for (size_t i = 0; i < size; ++i, in += step) {
+            out[i] = *in;
+        }
+    }
+}
+
+template <typename T>
+void copy_rows(const T* in, T* out, const Shape& shape, const std::vector<int64_t>& strides) {
+    const size_t rank = shape.size();
+    const size_t row_size = shape.back();
+    const int64_t step = strides.back();
+
+    if (rank == 1 && step == 1) {
+        // the contiguous copy is split between the threads
+        runtime::parallel_for(
+            row_size,
+            [&](size_t begin, size_t end) {
+                std::memcpy(out + begin, in + begin, (end - begin) * sizeof(T));
+            },
+            min_elements_per_thread);
+        return;
+    }
+
+    const size_t rows = shape_size(shape) / row_size;
+    runtime::parallel_for(
+        rows,
+        [&](size_t begin, size_t end) {
+            // the coordinate of the first row of the chunk, the next ones are computed incrementally
+            std::vector<size_t> counter(rank - 1);
+            int64_t offset = 0;
+            for (size_t d = rank - 1, row = begin; d-- > 0;) {
+                counter[d] = row % shape[d];
+                row /= shape[d];
+                offset += static_cast<int64_t>(counter[d]) * strides[d];
+            }
+            T* dst = out + begin * row_size;
+            for (size_t row = begin; row < end; ++row, dst += row_size) {
+                copy_row(in + offset, dst, row_size, step);
+                for (size_t d = rank - 1; d-- > 0;) {
+                    offset += strides[d];
+                    if (++counter[d] < shape[d]) {
+                        break;
+                    }
+                    offset -= strides[d] * static_cast<int64_t>(shape[d]);
+                    counter[d] = 0;
+                }
+            }
+        },
+        std::max<size_t>(1, min_elements_per_thread / row_size));
+}
+
+template <typename T>
+void copy_elements(const char* in, char* out, Shape shape, std::vector<int64_t> strides, int64_t in_offset) {
+    simplify(shape, strides);
+    copy_rows(reinterpret_cast<const T*>(in) + in_offset, reinterpret_cast<T*>(out), shape, strides);
+}
+}  // namespace
+
+void runtime::reference::strided_copy(const char* in,
+                                      char* out,
+                                      const Shape& out_shape,
+                                      const std::vector<int64_t>& in_strides,
+                                      int64_t in_offset,
+                                      size_t elem_size) {
+    NGRAPH_CHECK(out_shape.size() == in_strides.size(), "Strides are not defined for all the output dimensions");
+    if (shape_size(out_shape) == 0) {
+        return;
+    }
+
+    switch (elem_size) {
+    case 1:
+        copy_elements<uint8_t>(in, out, out_shape, in_strides, in_offset);
+        break;
+    case 2:
+        copy_elements<uint16_t>(in, out, out_shape, in_strides, in_offset);
+        break;
+    case 4:
+        copy_elements<uint32_t>(in, out, out_shape, in_strides, in_offset);
+        break;
+    case 8:
+        copy_elements<uint64_t>(in, out, out_shape, in_strides, in_offset);
+        break;
+    default: {
+        // the element is copied as the innermost dimension of bytes
+        Shape shape = out_shape;
+        std::vector<int64_t> strides = in_strides;
+        for (auto& stride : strides) {
+            stride *= elem_size;
+        }
+        shape.push_back(elem_size);
+        strides.push_back(1);
+        copy_elements<uint8_t>(in, out, shape, strides, in_offset * elem_size);
+        break;
+    }
+    }
+}
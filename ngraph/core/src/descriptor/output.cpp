@@ -6,6 +6,7 @@
 
 #include <algorithm>
 
+#include "graph_version.hpp"
 #include "ngraph/descriptor/input.hpp"
 #include "ngraph/node.hpp"
 
@@ -22,6 +23,7 @@ void descriptor::Output::add_input(Input* input) {
     // Keep the inputs in insertion order to keep sorts deterministic
     if (find(m_inputs.begin(), m_inputs.end(), input) == m_inputs.end()) {
         m_inputs.push_back(input);
+        internal::graph_changed();
     }
 }
 
@@ -29,6 +31,7 @@ void descriptor::Output::remove_input(Input* input) {
     auto it = find(m_inputs.begin(), m_inputs.end(), input);
     if (it != m_inputs.end()) {
         m_inputs.erase(it);
+        internal::graph_changed();
     }
 }
 
@@ -9,6 +9,7 @@
 #include <memory>
 #include <ngraph/ops.hpp>
 
+#include "graph_version.hpp"
 #include "itt.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
@@ -25,6 +26,12 @@ constexpr DiscreteTypeInfo Function::type_info;
 
 atomic<size_t> Function::m_next_instance_id(0);
 
+std::atomic<size_t>& ngraph::internal::graph_version() {
+    // starts from 1, so the version of the empty cache is never current
+    static std::atomic<size_t> version(1);
+    return version;
+}
+
 void check_all_variables_registered(const std::vector<shared_ptr<Node>>& ordered_ops, const VariableVector& variables) {
     OV_ITT_SCOPED_TASK(ngraph::itt::domains::nGraphPass_LT, "Function::check_all_variables_registered");
     std::stringstream unregistered_variables;
@@ -222,8 +229,11 @@ void Function::validate_nodes_and_infer_types() const {
                            "network.");
 }
 
-std::vector<shared_ptr<Node>> Function::get_ordered_ops() const {
-    OV_ITT_SCOPED_TASK(itt::domains::nGraph, "Function::get_ordered_ops");
+void Function::update_ordered_ops() const {
+    // the version is taken before the sort, so a change made meanwhile triggers the next sort
+    const size_t version = internal::graph_version().load();
+    if (version == m_ordered_ops_version)
+        return;
 
     vector<shared_ptr<Node>> nodes;
     for (auto& r : get_results()) {
@@ -236,7 +246,47 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const {
         nodes.push_back(param);
     }
 
-    return m_topological_sorter(nodes);
+    const auto ordered_ops = m_topological_sorter(nodes);
+    m_ordered_ops.assign(ordered_ops.begin(), ordered_ops.end());
+    m_ordered_ops_by_type.clear();
+    for (size_t i = 0; i < ordered_ops.size(); i++) {
+        m_ordered_ops_by_type[ordered_ops[i]->get_type_info()].push_back(i);
+    }
+    m_ordered_ops_version = version;
+}
+
+std::vector<shared_ptr<Node>> Function::get_ordered_ops() const {
+    OV_ITT_SCOPED_TASK(itt::domains::nGraph, "Function::get_ordered_ops");
+
+    std::lock_guard<std::mutex> lock(m_ordered_ops_mutex);
+    update_ordered_ops();
+    vector<shared_ptr<Node>> ordered_ops;
+    ordered_ops.reserve(m_ordered_ops.size());
+    for (const auto& weak_node : m_ordered_ops) {
+        ordered_ops.push_back(weak_node.lock());
+    }
+    return ordered_ops;
+}
+
+std::vector<shared_ptr<Node>> Function::get_ordered_ops(const std::function<bool(const Node&)>& type_filter) const {
+    OV_ITT_SCOPED_TASK(itt::domains::nGraph, "Function::get_ordered_ops");
+
+    std::lock_guard<std::mutex> lock(m_ordered_ops_mutex);
+    update_ordered_ops();
+    vector<size_t> selected;
+    for (const auto& type_ops : m_ordered_ops_by_type) {
+        if (type_filter(*m_ordered_ops[type_ops.second.front()].lock())) {
+            selected.insert(selected.end(), type_ops.second.begin(), type_ops.second.end());
+        }
+    }
+    std::sort(selected.begin(), selected.end());
+
+    vector<shared_ptr<Node>> ordered_ops;
+    ordered_ops.reserve(selected.size());
+    for (size_t index : selected) {
+        ordered_ops.push_back(m_ordered_ops[index].lock());
+    }
+    return ordered_ops;
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const {
@@ -369,10 +419,12 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    internal::graph_changed();
 }
 
 void Function::set_topological_sort(topological_sort_t sorter) {
     m_topological_sorter = sorter;
+    internal::graph_changed();
 }
 
 int64_t Function::get_parameter_index(const std::shared_ptr<op::Parameter>& parameter) const {
@@ -433,11 +485,13 @@ bool Function::evaluate(const HostTensorVector& output_tensors,
 bool Function::visit_attributes(AttributeVisitor& visitor) {
     visitor.on_attribute("parameters", m_parameters);
     visitor.on_attribute("results", m_results);
+    internal::graph_changed();
     return true;
 }
 
 void Function::add_sinks(const SinkVector& sinks) {
     m_sinks.insert(m_sinks.end(), sinks.begin(), sinks.end());
+    internal::graph_changed();
     for (const auto& sink : sinks) {
         if (const auto& variable_op = dynamic_pointer_cast<VariableExtension>(sink)) {
             if (find(m_variables.begin(), m_variables.end(), variable_op->get_variable()) == m_variables.end()) {
@@ -454,10 +508,12 @@ void Function::remove_sink(const std::shared_ptr<op::Sink>& sink) {
                                      return s == sink;
                                  }),
                   m_sinks.end());
+    internal::graph_changed();
 }
 
 void Function::add_results(const ResultVector& results) {
     m_results.insert(m_results.end(), results.begin(), results.end());
+    internal::graph_changed();
 }
 
 void Function::remove_result(const std::shared_ptr<op::Result>& result) {
@@ -467,6 +523,7 @@ void Function::remove_result(const std::shared_ptr<op::Result>& result) {
                                        return r == result;
                                    }),
                     m_results.end());
+    internal::graph_changed();
 }
 
 void Function::add_parameters(const ParameterVector& params) {
@@ -480,6 +537,7 @@ void Function::add_parameters(const ParameterVector& params) {
         }
     }
     m_parameters.insert(m_parameters.end(), params.begin(), params.end());
+    internal::graph_changed();
 }
 
 void Function::remove_parameter(const std::shared_ptr<op::Parameter>& param) {
@@ -489,6 +547,7 @@ void Function::remove_parameter(const std::shared_ptr<op::Parameter>& param) {
                                           return r == param;
                                       }),
                        m_parameters.end());
+    internal::graph_changed();
 }
 
 void Function::add_variables(const VariableVector& variables) {
@@ -0,0 +1,22 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace ngraph {
+namespace internal {
+/// \brief Counter incremented by every change of the graph connections: the inputs, the control
+/// dependencies and the parameters, results and sinks of the functions. The nodes do not know the
+/// functions they belong to, so the counter is shared by all graphs and a function rebuilds its
+/// cached topological order when the counter differs from the value the order was built at.
+std::atomic<size_t>& graph_version();
+
+inline void graph_changed() {
+    graph_version().fetch_add(1, std::memory_order_relaxed);
+}
+}  // namespace internal
+}  // namespace ngraph
@@ -28,9 +28,10 @@ OV_ITT_DOMAIN(SIMPLE_ngraph_pass);
 
 #if defined(SELECTIVE_BUILD_ANALYZER)
 #    define NGRAPH_OP_SCOPE(region) OV_SCOPE(ngraph_op, region)
-#    define NGRAPH_PASS_CALLBACK(matcher)                               \
-        openvino::itt::handle_t m_callback_handle;                      \
-        m_callback_handle = openvino::itt::handle(matcher->get_name()); \
+#    define NGRAPH_PASS_CALLBACK(matcher)                                                                        \
+        openvino::cc::internal::profile::instance().record(OV_PP_TOSTRING(SIMPLE_ngraph_pass), matcher->get_name()); \
+        openvino::itt::handle_t m_callback_handle;                                                               \
+        m_callback_handle = openvino::itt::handle(matcher->get_name());                                          \
         OV_ITT_SCOPED_TASK(SIMPLE_ngraph_pass, m_callback_handle)
 #elif defined(SELECTIVE_BUILD)
 #    define NGRAPH_OP_SCOPE(region)                                        \
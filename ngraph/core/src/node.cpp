@@ -10,6 +10,7 @@
 #include <typeindex>
 #include <typeinfo>
 
+#include "graph_version.hpp"
 #include "itt.hpp"
 #include "ngraph/descriptor/input.hpp"
 #include "ngraph/graph_util.hpp"
@@ -395,6 +396,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node) {
             node->m_control_dependents.end()) {
             node->m_control_dependents.push_back(this);
         }
+        internal::graph_changed();
     }
 }
 
@@ -420,6 +422,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node) {
         auto it = find(m_control_dependencies.begin(), m_control_dependencies.end(), node);
         if (it != m_control_dependencies.end()) {
             m_control_dependencies.erase(it);
+            internal::graph_changed();
         }
     }
     {
@@ -438,6 +441,7 @@ void Node::clear_control_dependencies() {
         }
     }
     m_control_dependencies.clear();
+    internal::graph_changed();
 }
 
 void Node::clear_control_dependents() {
@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/pass/constant_deduplication.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <ngraph/op/constant.hpp>
+#include <unordered_map>
+
+#include "ngraph/op/result.hpp"
+#include "ngraph/op/util/sub_graph_base.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::ConstantDeduplication, "ConstantDeduplication", 0);
+
+namespace {
+size_t get_byte_size(const op::Constant& constant) {
+    const auto& type = constant.get_element_type();
+    const size_t size = shape_size(constant.get_shape());
+    if (type.bitwidth() < 8) {
+        return (size * type.bitwidth() + 7) / 8;
+    }
+    return size * type.size();
+}
+
+// FNV-1a over the 8 bytes words
+size_t hash_data(const char* data, size_t size) {
+    uint64_t hash = 14695981039346656037ULL;
+    const uint64_t prime = 1099511628211ULL;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(uint64_t));
+        hash = (hash ^ word) * prime;
+    }
+    for (; i < size; ++i) {
+        hash = (hash ^ static_cast<unsigned char>(data[i])) * prime;
+    }
+    return static_cast<size_t>(hash);
+}
+
+bool produces_result(const Node& node) {
+    for (const auto& input : node.output(0).get_target_inputs()) {
+        if (is_type<op::v0::Result>(input.get_node())) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool same_rt_info_keys(const Node& a, const Node& b) {
+    const auto& a_info = a.get_rt_info();
+    const auto& b_info = b.get_rt_info();
+    return a_info.size() == b_info.size() &&
+           std::equal(a_info.begin(), a_info.end(), b_info.begin(), [](const Node::RTMap::value_type& a_item,
+                                                                       const Node::RTMap::value_type& b_item) {
+               return a_item.first == b_item.first;
+           });
+}
+
+bool same_constants(const op::Constant& a, const op::Constant& b, size_t byte_size) {
+    return a.get_element_type() == b.get_element_type() && a.get_shape() == b.get_shape() &&
+           same_rt_info_keys(a, b) &&
+           (byte_size == 0 || std::memcmp(a.get_data_ptr(), b.get_data_ptr(), byte_size) == 0);
+}
+}  // namespace
+
+bool ngraph::pass::ConstantDeduplication::run_on_function(std::shared_ptr<ngraph::Function> f) {
+    bool rewritten = false;
+    unordered_map<size_t, vector<shared_ptr<op::Constant>>> constants;
+
+    for (const auto& node : f->get_ordered_ops()) {
+        // the bodies are deduplicated separately, the Constants of a body are not connected to the outer graph
+        if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node)) {
+            if (const auto& sub_graph = sub_graph_node->get_function()) {
+                rewritten |= run_on_function(sub_graph);
+            }
+            continue;
+        }
+
+        auto constant = as_type_ptr<op::Constant>(node);
+        if (!constant || produces_result(*constant)) {
+            continue;
+        }
+
+        const size_t byte_size = get_byte_size(*constant);
+        const char* data = static_cast<const char*>(constant->get_data_ptr());
+        auto& same_hash = constants[hash_data(data, byte_size)];
+        auto found = std::find_if(same_hash.begin(), same_hash.end(), [&](const shared_ptr<op::Constant>& candidate) {
+            return same_constants(*candidate, *constant, byte_size);
+        });
+        if (found == same_hash.end()) {
+            same_hash.push_back(constant);
+            continue;
+        }
+
+        constant->output(0).replace((*found)->output(0));
+        rewritten = true;
+    }
+
+    return rewritten;
+}
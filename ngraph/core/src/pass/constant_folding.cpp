@@ -4,10 +4,15 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 
+#include <algorithm>
+#include <exception>
 #include <ngraph/op/constant.hpp>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/rt_info.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/validation_util.hpp"
 
 using namespace std;
@@ -15,50 +20,170 @@ using namespace ngraph;
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::ConstantFolding, "ConstantFolding", 0);
 
+constexpr size_t ngraph::pass::ConstantFolding::default_memory_budget;
+
+namespace {
+// the size of the outputs of the node evaluated by the default constant folding, 0 if the node is not evaluated
+// in parallel: it has non-constant inputs (e.g. ShapeOf is folded by the shape of its input), contains a subgraph
+// or has dynamic outputs
+size_t parallel_folding_size(const Node& node) {
+    if (node.get_input_size() == 0 || is_type<op::util::SubGraphOp>(&node) ||
+        node.get_rt_info().count("DISABLED_CONSTANT_FOLDING")) {
+        return 0;
+    }
+    for (const auto& input : node.input_values()) {
+        if (!is_type<op::Constant>(input.get_node())) {
+            return 0;
+        }
+    }
+    size_t size = 0;
+    for (const auto& output : node.outputs()) {
+        if (output.get_partial_shape().is_dynamic() || output.get_element_type().is_dynamic()) {
+            return 0;
+        }
+        size += shape_size(output.get_shape()) * output.get_element_type().size();
+    }
+    return std::max<size_t>(size, 1);
+}
+}  // namespace
+
+ngraph::pass::ConstantFolding::ConstantFolding(size_t memory_budget) : m_memory_budget(memory_budget) {}
+
 bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Function> f) {
     bool rewritten = pre_calculated_values_folding(f);
 
-    for (const auto& node : f->get_ordered_ops()) {
+    // the level of a node is the length of the longest path from the sources to the node
+    std::vector<NodeVector> levels;
+    {
+        std::unordered_map<const Node*, size_t> node_levels;
+        for (const auto& node : f->get_ordered_ops()) {
+            size_t level = 0;
+            for (const auto& input : node->input_values()) {
+                level = std::max(level, node_levels[input.get_node()] + 1);
+            }
+            for (const auto& dependency : node->get_control_dependencies()) {
+                level = std::max(level, node_levels[dependency.get()] + 1);
+            }
+            node_levels[node.get()] = level;
+            if (levels.size() <= level) {
+                levels.resize(level + 1);
+            }
+            levels[level].push_back(node);
+        }
+    }
+
+    for (auto& level : levels) {
         if (rewritten) {
-            node->validate_and_infer_types();
+            for (const auto& node : level) {
+                node->validate_and_infer_types();
+            }
         }
 
-        OutputVector replacements(node->get_output_size());
-        if (node->constant_fold(replacements, node->input_values())) {
-            NGRAPH_CHECK(replacements.size() == node->get_output_size(),
-                         "constant_fold_default returned incorrect number of replacements for ",
-                         node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
-                    if (replacements.size() == 1) {
-                        replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
-                    } else {
-                        replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name() + "." +
-                                                                             std::to_string(i));
+        std::vector<OutputVector> level_replacements(level.size());
+        const auto folded = fold_nodes(level, level_replacements);
+
+        for (size_t n = 0; n < level.size(); ++n) {
+            const auto& node = level[n];
+            const auto& replacements = level_replacements[n];
+            if (folded[n]) {
+                NGRAPH_CHECK(replacements.size() == node->get_output_size(),
+                             "constant_fold_default returned incorrect number of replacements for ",
+                             node);
+
+                for (size_t i = 0; i < replacements.size(); ++i) {
+                    auto node_output = node->output(i);
+                    auto replacement = replacements.at(i);
+                    if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
+                        if (replacements.size() == 1) {
+                            replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
+                        } else {
+                            replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name() + "." +
+                                                                                 std::to_string(i));
+                        }
+                        node_output.replace(replacement);
+                        // Propagate runtime info attributes to replacement consumer nodes
+                        copy_runtime_info_to_target_inputs(node, replacement);
+
+                        rewritten = true;
                     }
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
-
-                    rewritten = true;
                 }
-            }
-        } else {
-            // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
-            if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node)) {
-                if (const auto& sub_graph = sub_graph_node->get_function()) {
-                    rewritten |= run_on_function(sub_graph);
+            } else {
+                // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
+                if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node)) {
+                    if (const auto& sub_graph = sub_graph_node->get_function()) {
+                        rewritten |= run_on_function(sub_graph);
+                    }
                 }
             }
         }
+
+        // the folded nodes and the constants consumed by them only are released
+        NodeVector().swap(level);
     }
 
     return rewritten;
 }
 
+std::vector<bool> ngraph::pass::ConstantFolding::fold_nodes(const NodeVector& nodes,
+                                                            std::vector<OutputVector>& replacements) const {
+    std::vector<bool> folded(nodes.size(), false);
+    // the nodes of a batch don't share the inputs: constant_fold() may connect the temporary nodes to the inputs
+    // (e.g. ConvertLike), the consumers of an output are not thread safe
+    std::vector<size_t> batch;
+    std::unordered_set<const Node*> batch_inputs;
+    size_t batch_size = 0;
+
+    auto fold_batch = [&]() {
+        std::vector<char> batch_folded(batch.size(), false);
+        std::vector<std::exception_ptr> errors(batch.size());
+        runtime::parallel_for(batch.size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const auto& node = nodes[batch[i]];
+                try {
+                    batch_folded[i] = node->constant_fold(replacements[batch[i]], node->input_values());
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            }
+        });
+        for (size_t i = 0; i < batch.size(); ++i) {
+            if (errors[i]) {
+                std::rethrow_exception(errors[i]);
+            }
+            folded[batch[i]] = batch_folded[i] != 0;
+        }
+        batch.clear();
+        batch_inputs.clear();
+        batch_size = 0;
+    };
+
+    for (size_t n = 0; n < nodes.size(); ++n) {
+        const auto& node = nodes[n];
+        replacements[n].resize(node->get_output_size());
+        const size_t size = parallel_folding_size(*node);
+        if (size == 0) {
+            folded[n] = node->constant_fold(replacements[n], node->input_values());
+            continue;
+        }
+        const auto inputs = node->input_values();
+        const bool shares_inputs = std::any_of(inputs.begin(), inputs.end(), [&](const Output<Node>& input) {
+            return batch_inputs.count(input.get_node()) != 0;
+        });
+        if (!batch.empty() && (shares_inputs || batch_size + size > m_memory_budget)) {
+            fold_batch();
+        }
+        batch.push_back(n);
+        for (const auto& input : inputs) {
+            batch_inputs.insert(input.get_node());
+        }
+        batch_size += size;
+    }
+    if (!batch.empty()) {
+        fold_batch();
+    }
+    return folded;
+}
+
 void ngraph::pass::ConstantFolding::copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node,
                                                                        const Output<Node>& replacement) {
     for (auto& input : replacement.get_target_inputs()) {
@@ -5,6 +5,7 @@
 #include "ngraph/pass/graph_rewrite.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
 #include <iostream>
 #include <ngraph/pattern/op/wrap_type.hpp>
@@ -70,42 +71,23 @@ PerfCounters& perf_counters_graph_rewrite() {
 }  // namespace pass
 }  // namespace ngraph
 
-bool pass::BackwardGraphRewrite::run_on_function(std::shared_ptr<ngraph::Function> f) {
-    // Initialize execution queue with nodes in topological order
-    deque<std::weak_ptr<Node>> nodes_to_run;
-    for (auto& node : f->get_ordered_ops()) {
-        nodes_to_run.emplace_front(node);
-    }
-    return apply_matcher_passes(f, std::move(nodes_to_run));
-}
-
-bool pass::GraphRewrite::run_on_function(std::shared_ptr<ngraph::Function> f) {
-    // Initialize execution queue with nodes in topological order
-    deque<std::weak_ptr<Node>> nodes_to_run;
-    for (auto& node : f->get_ordered_ops()) {
-        nodes_to_run.emplace_back(node);
-    }
-    return apply_matcher_passes(f, std::move(nodes_to_run));
-}
-
-bool pass::GraphRewrite::apply_matcher_passes(shared_ptr<Function> f, deque<std::weak_ptr<Node>> nodes_to_run) {
-    OV_ITT_SCOPED_TASK(itt::domains::nGraph, "pass::GraphRewrite::run_on_function");
-
-    bool rewritten = false;
-    const auto& pass_config = get_pass_config();
+namespace {
+std::atomic<size_t> visited_nodes_count{0};
+std::atomic<size_t> matcher_calls_count{0};
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
-    std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
-    for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
+// Collects the root types of the enabled matchers. Returns false if the root type of some matcher
+// is unknown, so every node has to be offered to every matcher.
+bool get_root_types(const std::vector<std::shared_ptr<pass::MatcherPass>>& matchers,
+                    const pass::PassConfig& pass_config,
+                    std::unordered_map<NodeTypeInfo, std::vector<size_t>>& type_to_matcher) {
+    for (size_t matcher_index = 0; matcher_index < matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
-        if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
+        if (pass_config.is_disabled(matchers[matcher_index]->get_type_info()))
             continue;
 
-        auto matcher = m_matchers[matcher_index]->get_matcher();
+        auto matcher = matchers[matcher_index]->get_matcher();
         if (!matcher) {
-            all_roots_has_type = false;
-            break;
+            return false;
         }
 
         auto root = matcher->get_pattern_value().get_node_shared_ptr();
@@ -125,8 +107,7 @@ bool pass::GraphRewrite::apply_matcher_passes(shared_ptr<Function> f, deque<std:
                     type_to_matcher[root_type_info].push_back(matcher_index);
                 }
             } else {
-                all_roots_has_type = false;
-                break;
+                return false;
             }
         } else {
             type_to_matcher[root->get_type_info()].push_back(matcher_index);
@@ -135,6 +116,67 @@ bool pass::GraphRewrite::apply_matcher_passes(shared_ptr<Function> f, deque<std:
         // TODO: traverse parents for root_type_info in order to register complete list of matchers
         // including ones triggered by parent type info.
     }
+    return true;
+}
+}  // namespace
+
+size_t pass::GraphRewrite::get_visited_nodes_count() {
+    return visited_nodes_count.load();
+}
+
+size_t pass::GraphRewrite::get_matcher_calls_count() {
+    return matcher_calls_count.load();
+}
+
+std::vector<std::shared_ptr<Node>> pass::GraphRewrite::get_nodes_to_run(const std::shared_ptr<Function>& f) {
+    std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    // the shape inference is applied to all the nodes
+    if (m_enable_shape_inference || !get_root_types(m_matchers, *get_pass_config(), type_to_matcher)) {
+        return f->get_ordered_ops();
+    }
+
+    // the nodes no matcher can be applied to are skipped, except the sub-graph operations
+    // which bodies are processed recursively
+    return f->get_ordered_ops([&type_to_matcher](const Node& node) {
+        if (dynamic_cast<const op::util::SubGraphOp*>(&node)) {
+            return true;
+        }
+        for (auto type_info = &node.get_type_info(); type_info; type_info = type_info->parent) {
+            if (type_to_matcher.count(*type_info)) {
+                return true;
+            }
+        }
+        return false;
+    });
+}
+
+bool pass::BackwardGraphRewrite::run_on_function(std::shared_ptr<ngraph::Function> f) {
+    // Initialize execution queue with nodes in topological order
+    deque<std::weak_ptr<Node>> nodes_to_run;
+    for (auto& node : get_nodes_to_run(f)) {
+        nodes_to_run.emplace_front(node);
+    }
+    return apply_matcher_passes(f, std::move(nodes_to_run));
+}
+
+bool pass::GraphRewrite::run_on_function(std::shared_ptr<ngraph::Function> f) {
+    // Initialize execution queue with nodes in topological order
+    deque<std::weak_ptr<Node>> nodes_to_run;
+    for (auto& node : get_nodes_to_run(f)) {
+        nodes_to_run.emplace_back(node);
+    }
+    return apply_matcher_passes(f, std::move(nodes_to_run));
+}
+
+bool pass::GraphRewrite::apply_matcher_passes(shared_ptr<Function> f, deque<std::weak_ptr<Node>> nodes_to_run) {
+    OV_ITT_SCOPED_TASK(itt::domains::nGraph, "pass::GraphRewrite::run_on_function");
+
+    bool rewritten = false;
+    const auto& pass_config = get_pass_config();
+
+    // Check that all Matchers in MatcherPasses has type bases root node
+    std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    const bool all_roots_has_type = get_root_types(m_matchers, *pass_config, type_to_matcher);
 
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
@@ -152,6 +194,7 @@ bool pass::GraphRewrite::apply_matcher_passes(shared_ptr<Function> f, deque<std:
 
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
+        matcher_calls_count++;
         bool status = m_pass->apply(node);
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
@@ -178,6 +221,7 @@ bool pass::GraphRewrite::apply_matcher_passes(shared_ptr<Function> f, deque<std:
         auto node = weak_node.lock();
         if (!node)
             continue;
+        visited_nodes_count++;
 
         // Recursive apply Matchers for sub-graph based nodes
         if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node)) {
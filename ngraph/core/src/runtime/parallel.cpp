@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/runtime/parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+using namespace ngraph;
+
+namespace {
+std::shared_ptr<const runtime::ParallelForBackend>& parallel_for_backend() {
+    static std::shared_ptr<const runtime::ParallelForBackend> backend;
+    return backend;
+}
+}  // namespace
+
+void runtime::set_parallel_for_backend(ParallelForBackend backend) {
+    std::shared_ptr<const ParallelForBackend> new_backend;
+    if (backend) {
+        new_backend = std::make_shared<const ParallelForBackend>(std::move(backend));
+    }
+    std::atomic_store(&parallel_for_backend(), new_backend);
+}
+
+void runtime::parallel_for(size_t work_amount, const ParallelForBody& body, size_t min_chunk) {
+    if (work_amount == 0) {
+        return;
+    }
+    min_chunk = std::max<size_t>(min_chunk, 1);
+    const auto backend = std::atomic_load(&parallel_for_backend());
+    if (!backend || work_amount < 2 * min_chunk) {
+        body(0, work_amount);
+        return;
+    }
+    // the backend splits the blocks of min_chunk iterations, so a thread doesn't get less than min_chunk of them
+    const size_t blocks = (work_amount + min_chunk - 1) / min_chunk;
+    (*backend)(blocks, [&](size_t begin, size_t end) {
+        body(begin * min_chunk, std::min(end * min_chunk, work_amount));
+    });
+}
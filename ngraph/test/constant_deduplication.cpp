@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/pass/constant_deduplication.hpp"
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+TEST(constant_deduplication, merge_identical_constants) {
+    auto data = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto add = make_shared<op::v1::Add>(data, op::Constant::create(element::f32, Shape{3}, {1, 2, 3}));
+    auto mul = make_shared<op::v1::Multiply>(add, op::Constant::create(element::f32, Shape{3}, {1, 2, 3}));
+    // the same content of the other element type or shape
+    auto sub = make_shared<op::v1::Subtract>(mul, op::Constant::create(element::f32, Shape{1, 3}, {1, 2, 3}));
+    auto reshape = make_shared<op::v1::Reshape>(sub, op::Constant::create(element::i64, Shape{2}, {3, 2}), false);
+    auto shape = make_shared<op::v1::Reshape>(reshape, op::Constant::create(element::i64, Shape{2}, {3, 2}), false);
+    auto f = make_shared<Function>(shape, ParameterVector{data});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantDeduplication>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 3);
+    ASSERT_EQ(add->get_input_node_ptr(1), mul->get_input_node_ptr(1));
+    ASSERT_NE(add->get_input_node_ptr(1), sub->get_input_node_ptr(1));
+    ASSERT_EQ(reshape->get_input_node_ptr(1), shape->get_input_node_ptr(1));
+}
+
+TEST(constant_deduplication, keep_different_constants) {
+    auto data = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto add = make_shared<op::v1::Add>(data, op::Constant::create(element::f32, Shape{3}, {1, 2, 3}));
+    auto mul = make_shared<op::v1::Multiply>(add, op::Constant::create(element::f32, Shape{3}, {1, 2, 4}));
+    auto disabled = op::Constant::create(element::f32, Shape{3}, {1, 2, 3});
+    disabled->get_rt_info()["DISABLED_CONSTANT_FOLDING"] = make_shared<VariantWrapper<string>>("");
+    auto sub = make_shared<op::v1::Subtract>(mul, disabled);
+    // the outputs of the function are not merged
+    auto output_0 = op::Constant::create(element::f32, Shape{3}, {1, 2, 3});
+    auto output_1 = op::Constant::create(element::f32, Shape{3}, {1, 2, 3});
+    auto f = make_shared<Function>(OutputVector{sub, output_0, output_1}, ParameterVector{data});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantDeduplication>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 5);
+}
+
+TEST(constant_deduplication, sub_graph_body) {
+    auto x = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto body_x = make_shared<op::Parameter>(element::f32, Shape{1});
+    auto body_add = make_shared<op::v1::Add>(body_x, op::Constant::create(element::f32, Shape{1}, {2}));
+    auto body_mul = make_shared<op::v1::Multiply>(body_add, op::Constant::create(element::f32, Shape{1}, {2}));
+    auto body = make_shared<Function>(OutputVector{body_mul}, ParameterVector{body_x});
+
+    auto ti = make_shared<op::TensorIterator>();
+    ti->set_body(body);
+    ti->set_sliced_input(body_x, x, 0, 1, 1, -1, 0);
+    auto out = ti->get_iter_value(body_mul, -1);
+    auto f = make_shared<Function>(OutputVector{out}, ParameterVector{x});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantDeduplication>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Constant>(body), 1);
+    ASSERT_EQ(body_add->get_input_node_ptr(1), body_mul->get_input_node_ptr(1));
+}
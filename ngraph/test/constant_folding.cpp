@@ -4,10 +4,13 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 
+#include <thread>
+
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/opsets/opset5.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_tools.hpp"
 
@@ -3220,3 +3223,59 @@ TEST(constant_folding, constant_loop) {
     range_test_check(result_node_0->cast_vector<float>(), expected_0);
     range_test_check(result_node_1->cast_vector<float>(), expected_1);
 }
+
+TEST(constant_folding, parallel_levels) {
+    // every branch is the chain Add -> Multiply -> ConvertLike of its own constants, the branches are folded
+    // in parallel and the intermediate constants are released level by level
+    runtime::set_parallel_for_backend([](size_t work_amount, const runtime::ParallelForBody& body) {
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < work_amount; ++i) {
+            threads.emplace_back([&body, i]() {
+                body(i, i + 1);
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    });
+
+    const size_t branches = 8;
+    const Shape shape{4, 16};
+    ResultVector results;
+    std::vector<std::weak_ptr<Node>> intermediates;
+    for (size_t i = 0; i < branches; ++i) {
+        auto a = op::Constant::create(element::f32, shape, {static_cast<float>(i)});
+        auto b = op::Constant::create(element::f32, shape, {1.f});
+        auto add = make_shared<op::v1::Add>(a, b);
+        auto multiply = make_shared<op::v1::Multiply>(add, op::Constant::create(element::f32, shape, {2.f}));
+        auto like = op::Constant::create(element::i32, Shape{}, {0});
+        auto convert = make_shared<op::v1::ConvertLike>(multiply, like);
+        convert->set_friendly_name("convert_" + std::to_string(i));
+        results.push_back(make_shared<op::Result>(convert));
+        intermediates.push_back(add);
+        intermediates.push_back(multiply);
+    }
+    auto f = make_shared<Function>(results, ParameterVector{});
+
+    pass::Manager pass_manager;
+    // the budget fits two branches at once
+    pass_manager.register_pass<pass::ConstantFolding>(2 * shape_size(shape) * sizeof(float));
+    pass_manager.run_passes(f);
+    runtime::set_parallel_for_backend(nullptr);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::Add>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::ConvertLike>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), branches);
+    for (const auto& node : intermediates) {
+        ASSERT_TRUE(node.expired());
+    }
+    for (size_t i = 0; i < branches; ++i) {
+        auto folded = as_type_ptr<op::Constant>(f->get_results().at(i)->input_value(0).get_node_shared_ptr());
+        ASSERT_TRUE(folded);
+        ASSERT_EQ(folded->get_friendly_name(), "convert_" + std::to_string(i));
+        ASSERT_EQ(folded->get_element_type(), element::i32);
+        ASSERT_EQ(folded->cast_vector<int32_t>(),
+                  std::vector<int32_t>(shape_size(shape), static_cast<int32_t>((i + 1) * 2)));
+    }
+}
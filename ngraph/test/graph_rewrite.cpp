@@ -7,6 +7,7 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 #include <util/test_tools.hpp>
 
 NGRAPH_SUPPRESS_DEPRECATED_START
@@ -442,3 +443,58 @@ TEST(GraphRewriteTest, nodes_use_count) {
     m.register_pass<CheckConsumers>();
     ASSERT_NO_THROW(m.run_passes(f));
 }
+
+class CountDividesPass : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    CountDividesPass(size_t& matched) : MatcherPass() {
+        ngraph::matcher_pass_callback callback = [&matched](pattern::Matcher&) {
+            matched++;
+            return false;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(pattern::wrap_type<opset3::Divide>(), "CountDividesPass");
+        this->register_matcher(m, callback);
+    }
+};
+
+NGRAPH_RTTI_DEFINITION(CountDividesPass, "CountDividesPass", 0);
+
+TEST(GraphRewriteTest, pipeline_matcher_visits) {
+    // a chain of Relu operations with a Divide after every 100th of them
+    const size_t chain_length = 1000;
+    const size_t divides = chain_length / 100;
+    auto data = std::make_shared<opset3::Parameter>(element::f32, Shape{3, 1, 2});
+    auto divide_constant = opset3::Constant::create(element::f32, Shape{1}, {1.5});
+    Output<Node> last = data;
+    for (size_t i = 1; i <= chain_length; i++) {
+        last = std::make_shared<opset3::Relu>(last);
+        if (i % 100 == 0) {
+            last = std::make_shared<opset3::Divide>(last, divide_constant);
+        }
+    }
+    auto f = std::make_shared<Function>(OutputVector{last}, ParameterVector{data});
+
+    const size_t passes = 20;
+    size_t matched = 0;
+    pass::Manager manager;
+    for (size_t i = 0; i < passes; i++) {
+        manager.register_pass<CountDividesPass>(matched);
+    }
+
+    size_t sorts = 0;
+    f->set_topological_sort([&sorts](const std::vector<std::shared_ptr<Node>>& root_nodes) {
+        sorts++;
+        return topological_sort(root_nodes);
+    });
+    const size_t visited_nodes = pass::GraphRewrite::get_visited_nodes_count();
+    const size_t matcher_calls = pass::GraphRewrite::get_matcher_calls_count();
+    manager.run_passes(f);
+
+    ASSERT_EQ(passes * divides, matched);
+    // the walk over all the nodes would visit passes * (chain_length + divides + 3) of them
+    ASSERT_EQ(passes * divides, pass::GraphRewrite::get_visited_nodes_count() - visited_nodes);
+    ASSERT_EQ(passes * divides, pass::GraphRewrite::get_matcher_calls_count() - matcher_calls);
+    // the graph is not changed by the passes, so it is sorted once
+    ASSERT_EQ(1, sorts);
+}
@@ -0,0 +1,334 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/parallel.hpp"
+#include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/reference/concat.hpp"
+#include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/gather.hpp"
+#include "ngraph/runtime/reference/max.hpp"
+#include "ngraph/runtime/reference/mean.hpp"
+#include "ngraph/runtime/reference/slice.hpp"
+#include "ngraph/runtime/reference/sum.hpp"
+#include "ngraph/runtime/reference/tile.hpp"
+#include "ngraph/shape.hpp"
+
+using namespace ngraph;
+
+namespace {
+// splits the work between the threads of its own to run the kernels in parallel without the IE runtime
+void thread_backend(size_t work_amount, const runtime::ParallelForBody& body) {
+    const size_t nthr = std::min<size_t>(work_amount, 4);
+    std::vector<std::thread> threads;
+    for (size_t ithr = 0; ithr < nthr; ++ithr) {
+        const size_t begin = work_amount * ithr / nthr;
+        const size_t end = work_amount * (ithr + 1) / nthr;
+        threads.emplace_back([&body, begin, end]() { body(begin, end); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+class ReferenceParallel : public ::testing::Test {
+protected:
+    void TearDown() override {
+        runtime::set_parallel_for_backend(nullptr);
+    }
+
+    // runs the kernel sequentially and with the threading backend, the results must be the same
+    template <typename T>
+    std::vector<T> run(size_t out_size, const std::function<void(T*)>& kernel) {
+        std::vector<T> sequential(out_size);
+        std::vector<T> parallel(out_size);
+        runtime::set_parallel_for_backend(nullptr);
+        kernel(sequential.data());
+        runtime::set_parallel_for_backend(thread_backend);
+        kernel(parallel.data());
+        runtime::set_parallel_for_backend(nullptr);
+        EXPECT_EQ(sequential, parallel);
+        return parallel;
+    }
+
+    template <typename T>
+    static std::vector<T> iota(size_t size) {
+        std::vector<T> v(size);
+        std::iota(v.begin(), v.end(), T(0));
+        return v;
+    }
+};
+
+template <typename T>
+std::vector<T> naive_transpose(const std::vector<T>& in, const Shape& in_shape, const AxisVector& order) {
+    Shape out_shape(in_shape.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        out_shape[i] = in_shape[order[i]];
+    }
+    std::vector<T> out(in.size());
+    const auto in_strides = row_major_strides(in_shape);
+    for (size_t out_idx = 0; out_idx < out.size(); ++out_idx) {
+        size_t in_idx = 0;
+        size_t rest = out_idx;
+        for (size_t i = order.size(); i-- > 0;) {
+            in_idx += (rest % out_shape[i]) * in_strides[order[i]];
+            rest /= out_shape[i];
+        }
+        out[out_idx] = in[in_idx];
+    }
+    return out;
+}
+
+double measure_ms(const std::function<void()>& f) {
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+}  // namespace
+
+TEST_F(ReferenceParallel, transpose) {
+    const Shape in_shape{2, 3, 64, 65};
+    const auto in = iota<int32_t>(shape_size(in_shape));
+    for (const AxisVector& order : std::vector<AxisVector>{{0, 1, 2, 3}, {3, 2, 1, 0}, {0, 2, 3, 1}, {1, 0, 3, 2}}) {
+        Shape out_shape(in_shape.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            out_shape[i] = in_shape[order[i]];
+        }
+        const auto out = run<int32_t>(in.size(), [&](int32_t* out) {
+            runtime::opt_kernel::reshape(reinterpret_cast<const char*>(in.data()),
+                                         reinterpret_cast<char*>(out),
+                                         in_shape,
+                                         order,
+                                         out_shape,
+                                         sizeof(int32_t));
+        });
+        EXPECT_EQ(naive_transpose(in, in_shape, order), out);
+    }
+}
+
+TEST_F(ReferenceParallel, transpose_elem_size_3) {
+    const Shape in_shape{5, 7};
+    const auto in = iota<uint8_t>(shape_size(in_shape) * 3);
+    const auto out = run<uint8_t>(in.size(), [&](uint8_t* out) {
+        runtime::opt_kernel::reshape(reinterpret_cast<const char*>(in.data()),
+                                     reinterpret_cast<char*>(out),
+                                     in_shape,
+                                     AxisVector{1, 0},
+                                     Shape{7, 5},
+                                     3);
+    });
+    for (size_t i = 0; i < 7; ++i) {
+        for (size_t j = 0; j < 5; ++j) {
+            for (size_t b = 0; b < 3; ++b) {
+                EXPECT_EQ(in[(j * 7 + i) * 3 + b], out[(i * 5 + j) * 3 + b]);
+            }
+        }
+    }
+}
+
+TEST_F(ReferenceParallel, slice) {
+    const Shape in_shape{4, 70, 300};
+    const auto in = iota<float>(shape_size(in_shape));
+    const Coordinate lower{1, 3, 2};
+    const Coordinate upper{4, 70, 299};
+    const Strides strides{2, 1, 3};
+    const Shape out_shape{2, 67, 99};
+    const auto out = run<float>(shape_size(out_shape), [&](float* out) {
+        runtime::reference::slice(reinterpret_cast<const char*>(in.data()),
+                                  reinterpret_cast<char*>(out),
+                                  in_shape,
+                                  lower,
+                                  upper,
+                                  strides,
+                                  out_shape,
+                                  sizeof(float));
+    });
+    size_t i = 0;
+    for (size_t n = lower[0]; n < upper[0]; n += strides[0]) {
+        for (size_t h = lower[1]; h < upper[1]; h += strides[1]) {
+            for (size_t w = lower[2]; w < upper[2]; w += strides[2]) {
+                EXPECT_EQ(in[(n * 70 + h) * 300 + w], out[i++]);
+            }
+        }
+    }
+    EXPECT_EQ(shape_size(out_shape), i);
+}
+
+TEST_F(ReferenceParallel, tile) {
+    const Shape in_shape{3, 1, 5};
+    const auto in = iota<int64_t>(shape_size(in_shape));
+    const std::vector<int64_t> repeats{2, 2, 4, 3};
+    const Shape out_shape{2, 6, 4, 15};
+    const auto out = run<int64_t>(shape_size(out_shape), [&](int64_t* out) {
+        runtime::reference::tile(reinterpret_cast<const char*>(in.data()),
+                                 reinterpret_cast<char*>(out),
+                                 in_shape,
+                                 out_shape,
+                                 sizeof(int64_t),
+                                 repeats);
+    });
+    for (size_t i = 0; i < out.size(); ++i) {
+        const size_t h = (i / (4 * 15)) % 6;
+        const size_t w = i % 15;
+        EXPECT_EQ(in[(h % 3) * 5 + w % 5], out[i]);
+    }
+}
+
+TEST_F(ReferenceParallel, broadcast) {
+    const Shape in_shape{16};
+    const auto in = iota<float>(shape_size(in_shape));
+    const Shape out_shape{3, 16, 1000};
+    const auto out = run<float>(shape_size(out_shape), [&](float* out) {
+        runtime::reference::broadcast(reinterpret_cast<const char*>(in.data()),
+                                      reinterpret_cast<char*>(out),
+                                      in_shape,
+                                      out_shape,
+                                      AxisSet{0, 2},
+                                      sizeof(float));
+    });
+    for (size_t i = 0; i < out.size(); ++i) {
+        EXPECT_EQ(in[(i / 1000) % 16], out[i]);
+    }
+}
+
+TEST_F(ReferenceParallel, concat) {
+    const std::vector<Shape> in_shapes{{64, 3, 100}, {64, 5, 100}};
+    const auto in0 = iota<float>(shape_size(in_shapes[0]));
+    const auto in1 = iota<float>(shape_size(in_shapes[1]));
+    const Shape out_shape{64, 8, 100};
+    const auto out = run<float>(shape_size(out_shape), [&](float* out) {
+        runtime::reference::concat({reinterpret_cast<const char*>(in0.data()), reinterpret_cast<const char*>(in1.data())},
+                                   reinterpret_cast<char*>(out),
+                                   in_shapes,
+                                   out_shape,
+                                   1,
+                                   sizeof(float));
+    });
+    for (size_t n = 0; n < 64; ++n) {
+        EXPECT_TRUE(std::equal(in0.begin() + n * 300, in0.begin() + (n + 1) * 300, out.begin() + n * 800));
+        EXPECT_TRUE(std::equal(in1.begin() + n * 500, in1.begin() + (n + 1) * 500, out.begin() + n * 800 + 300));
+    }
+}
+
+TEST_F(ReferenceParallel, gather) {
+    const Shape data_shape{300, 10, 64};
+    const auto data = iota<float>(shape_size(data_shape));
+    const std::vector<int32_t> indices{9, 0, 4, -1};
+    const Shape out_shape{300, 4, 64};
+    const auto out = run<float>(shape_size(out_shape), [&](float* out) {
+        runtime::reference::gather(data.data(), indices.data(), out, data_shape, Shape{4}, out_shape, 1);
+    });
+    for (size_t n = 0; n < 300; ++n) {
+        for (size_t i = 0; i < indices.size(); ++i) {
+            const size_t index = indices[i] < 0 ? indices[i] + 10 : indices[i];
+            EXPECT_TRUE(std::equal(data.begin() + (n * 10 + index) * 64,
+                                   data.begin() + (n * 10 + index + 1) * 64,
+                                   out.begin() + (n * 4 + i) * 64));
+        }
+    }
+}
+
+TEST_F(ReferenceParallel, reductions) {
+    const Shape in_shape{8, 33, 17, 5};
+    std::vector<float> in(shape_size(in_shape));
+    for (size_t i = 0; i < in.size(); ++i) {
+        in[i] = static_cast<float>((i * 7919) % 1000) / 37.f;
+    }
+    for (const AxisSet& axes : std::vector<AxisSet>{{}, {0}, {1, 3}, {3}, {0, 1, 2, 3}}) {
+        const size_t out_size = shape_size(reduce(in_shape, axes, false));
+        const auto sum = run<float>(out_size, [&](float* out) {
+            runtime::reference::sum(in.data(), out, in_shape, axes);
+        });
+        run<float>(out_size, [&](float* out) {
+            runtime::reference::max(in.data(), out, in_shape, axes);
+        });
+        const auto mean = run<float>(out_size, [&](float* out) {
+            runtime::reference::mean(in.data(), out, in_shape, axes);
+        });
+        const size_t count = in.size() / out_size;
+        for (size_t i = 0; i < out_size; ++i) {
+            EXPECT_FLOAT_EQ(sum[i] / count, mean[i]);
+        }
+    }
+}
+
+TEST_F(ReferenceParallel, convolution) {
+    const Shape in_shape{2, 3, 20, 20};
+    const Shape f_shape{8, 3, 3, 3};
+    const Shape out_shape{2, 8, 18, 18};
+    const auto in = iota<float>(shape_size(in_shape));
+    const auto f = iota<float>(shape_size(f_shape));
+    run<float>(shape_size(out_shape), [&](float* out) {
+        runtime::reference::convolution(in.data(),
+                                        f.data(),
+                                        out,
+                                        in_shape,
+                                        f_shape,
+                                        out_shape,
+                                        Strides{1, 1},
+                                        Strides{1, 1},
+                                        CoordinateDiff{0, 0},
+                                        CoordinateDiff{0, 0});
+    });
+}
+
+// The benchmark of the kernels: run with --gtest_also_run_disabled_tests
+TEST_F(ReferenceParallel, DISABLED_benchmark) {
+    const Shape in_shape{8, 64, 128, 128};
+    const auto in = iota<float>(shape_size(in_shape));
+    std::vector<float> out(in.size());
+
+    const std::vector<std::pair<std::string, std::function<void()>>> kernels{
+        {"transpose",
+         [&]() {
+             runtime::opt_kernel::reshape(reinterpret_cast<const char*>(in.data()),
+                                          reinterpret_cast<char*>(out.data()),
+                                          in_shape,
+                                          AxisVector{0, 2, 3, 1},
+                                          Shape{8, 128, 128, 64},
+                                          sizeof(float));
+         }},
+        {"slice",
+         [&]() {
+             runtime::reference::slice(reinterpret_cast<const char*>(in.data()),
+                                       reinterpret_cast<char*>(out.data()),
+                                       in_shape,
+                                       Coordinate{0, 0, 0, 0},
+                                       in_shape,
+                                       Strides{1, 2, 1, 2},
+                                       Shape{8, 32, 128, 64},
+                                       sizeof(float));
+         }},
+        {"sum", [&]() { runtime::reference::sum(in.data(), out.data(), in_shape, AxisSet{1}); }},
+        {"gather",
+         [&]() {
+             const std::vector<int32_t> indices{3, 1, 2, 0};
+             runtime::reference::gather(in.data(),
+                                        indices.data(),
+                                        out.data(),
+                                        in_shape,
+                                        Shape{4},
+                                        Shape{8, 64, 4, 128},
+                                        2);
+         }},
+    };
+
+    for (const auto& kernel : kernels) {
+        runtime::set_parallel_for_backend(nullptr);
+        const double sequential = measure_ms(kernel.second);
+        runtime::set_parallel_for_backend(thread_backend);
+        const double parallel = measure_ms(kernel.second);
+        std::cout << kernel.first << ": sequential " << sequential << " ms, parallel " << parallel << " ms"
+                  << std::endl;
+    }
+}
@@ -670,6 +670,42 @@ TEST(util, topological_sort_replace) {
     EXPECT_TRUE(custom_sorter_used);
 }
 
+TEST(util, topological_sort_cached) {
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = make_shared<op::v1::Add>(A, B);
+    auto multiply = make_shared<op::v1::Multiply>(add, B);
+    auto f = make_shared<Function>(multiply, ParameterVector{A, B});
+    size_t sorts = 0;
+    f->set_topological_sort([&sorts](const std::vector<std::shared_ptr<Node>>& root_nodes) {
+        sorts++;
+        return topological_sort(root_nodes);
+    });
+
+    auto ordered_ops = f->get_ordered_ops();
+    EXPECT_EQ(ordered_ops, f->get_ordered_ops());
+    EXPECT_EQ(1, sorts);
+
+    // the cache does not keep the replaced node alive
+    std::weak_ptr<Node> weak_add = add;
+    auto subtract = make_shared<op::v1::Subtract>(A, B);
+    replace_node(add, subtract);
+    add.reset();
+    ordered_ops.clear();
+    EXPECT_TRUE(weak_add.expired());
+
+    ordered_ops = f->get_ordered_ops();
+    EXPECT_EQ(2, sorts);
+    EXPECT_NE(std::find(ordered_ops.begin(), ordered_ops.end(), subtract), ordered_ops.end());
+
+    auto binary_ops = f->get_ordered_ops([](const Node& node) {
+        return is_type<op::v1::Subtract>(&node) || is_type<op::v1::Multiply>(&node);
+    });
+    EXPECT_EQ((NodeVector{subtract, multiply}), binary_ops);
+    EXPECT_EQ(2, sorts);
+}
+
 TEST(util, double_to_int_limits) {
     auto round_func = [](double x) {
         return std::round(x);
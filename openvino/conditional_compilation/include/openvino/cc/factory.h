@@ -52,12 +52,16 @@ public:
     }
 
 #elif defined(SELECTIVE_BUILD_ANALYZER)
-    #define registerNodeIfRequired(Module, Name, key, Impl) registerImpl<OV_PP_CAT(FACTORY_, Module), Impl>(key, OV_PP_TOSTRING(Name))
-    #define createNodeIfRegistered(Module, key, ...) createImpl<OV_PP_CAT(FACTORY_, Module)>(key, __VA_ARGS__)
+    #define registerNodeIfRequired(Module, Name, key, Impl)                                                   \
+        registerImpl<OV_PP_CAT(FACTORY_, Module), Impl>(OV_PP_TOSTRING(OV_PP_CAT(FACTORY_, Module)), key,   \
+                                                        OV_PP_TOSTRING(Name))
+    #define createNodeIfRegistered(Module, key, ...)                                                          \
+        createImpl<OV_PP_CAT(FACTORY_, Module)>(OV_PP_TOSTRING(OV_PP_CAT(FACTORY_, Module)), key, __VA_ARGS__)
 
     template<openvino::itt::domain_t(*domain)(), typename Impl>
-    void registerImpl(const Key & key, const char *typeName) {
+    void registerImpl(const char *domainName, const Key & key, const char *typeName) {
         const std::string task_name = "REG$" + name + "$" + to_string(key) + "$" + typeName;
+        internal::profile::instance().record(domainName, task_name);
         openvino::itt::ScopedTask<domain> task(openvino::itt::handle(task_name));
         builders[key] = [](Args... args) -> T {
             Impl *impl = new Impl(args...);
@@ -66,10 +70,11 @@ public:
     }
 
     template<openvino::itt::domain_t(*domain)()>
-    T createImpl(const Key & key, Args... args) {
+    T createImpl(const char *domainName, const Key & key, Args... args) {
         auto builder = builders.find(key);
         if (builder != builders.end()) {
             const std::string task_name = "CREATE$" + name + "$" + to_string(key);
+            internal::profile::instance().record(domainName, task_name);
             openvino::itt::ScopedTask<domain> task(openvino::itt::handle(task_name));
             return builder->second(args...);
         }
@@ -12,6 +12,11 @@
     *                           When the process completes, a new C++ header file is created
     *                           that contains macros for enabling active regions. This file
     *                           should be included in all analysed C++ files.
+    *                           The active regions are reported as ITT tasks and, if the
+    *                           OPENVINO_CC_PROFILE environment variable is set, appended to
+    *                           the file it points to at the process exit. The file has the
+    *                           CSV format of the collected statistics, so it is passed to the
+    *                           build as is: -DSELECTIVE_BUILD_STAT=/path/profile.csv
     *
     * SELECTIVE_BUILD           This mode disables inactive areas of the code using the result
     *                           of the analysis step.
@@ -63,6 +68,11 @@
 #define OV_CC_TOSTRING OV_PP_TOSTRING
 
 #ifdef SELECTIVE_BUILD_ANALYZER
+# include <cstdlib>
+# include <fstream>
+# include <mutex>
+# include <ostream>
+# include <set>
 # include <string>
 #endif
 
@@ -119,6 +129,65 @@ bool match(Ctx && ctx, T && val, Case && cs, Cases&&... cases) {
 
 namespace internal {
 
+/**
+ * @brief The regions entered by the process. Every module built with the analysis mode has its own
+ * profile, so the profiles of the modules are appended to the same file one by one.
+ */
+class profile {
+    profile() = default;
+    profile(const profile&) = delete;
+    profile& operator=(const profile&) = delete;
+
+public:
+    static profile& instance() {
+        static profile p;
+        return p;
+    }
+
+    ~profile() {
+        const char *path = std::getenv("OPENVINO_CC_PROFILE");
+        if (path && *path && !regions.empty()) {
+            std::ofstream out(path, std::ios::app);
+            write(out);
+        }
+    }
+
+    void record(char const *domain, const std::string &region) {
+        std::lock_guard<std::mutex> lock(guard);
+        regions.emplace(domain, region);
+    }
+
+    // writes the "domain,region" rows read by scripts/ccheader.py
+    void write(std::ostream &out) const {
+        std::lock_guard<std::mutex> lock(guard);
+        for (const auto &region : regions) {
+            out << region.first << ',';
+            if (region.second.find_first_of(",\"") == std::string::npos) {
+                out << region.second;
+            } else {
+                out << '"';
+                for (char c : region.second) {
+                    if (c == '"')
+                        out << '"';
+                    out << c;
+                }
+                out << '"';
+            }
+            out << '\n';
+        }
+    }
+
+private:
+    std::set<std::pair<std::string, std::string>> regions;
+    mutable std::mutex guard;
+};
+
+// the static regions are recorded once per call site
+inline bool record(char const *domain, char const *region) {
+    profile::instance().record(domain, region);
+    return true;
+}
+
 template<typename C, typename T>
 struct case_wrapper {
     using type = T;
@@ -141,12 +210,12 @@ template<openvino::itt::domain_t(*domain)(),
         typename Ctx,
         typename T,
         typename Case>
-bool match(char const *region, Ctx && ctx, T && val, Case && cs) {
+bool match(char const *domain_name, char const *region, Ctx && ctx, T && val, Case && cs) {
     const bool is_matched = val == cs.value;
     if (is_matched) {
-        openvino::itt::ScopedTask<domain> task(
-            openvino::itt::handle(
-                std::string(region) + "$" + cs.name));
+        const std::string task_name = std::string(region) + "$" + cs.name;
+        profile::instance().record(domain_name, task_name);
+        openvino::itt::ScopedTask<domain> task(openvino::itt::handle(task_name));
         Fn<typename Case::type>()(std::forward<Ctx>(ctx));
     }
     return is_matched;
@@ -157,20 +226,25 @@ template<openvino::itt::domain_t(*domain)(),
         typename Ctx,
         typename T,
         typename Case, typename ...Cases>
-bool match(char const *region, Ctx && ctx, T && val, Case && cs, Cases&&... cases) {
-    if (match<domain, Fn>(region, std::forward<Ctx>(ctx), std::forward<T>(val), std::forward<Case>(cs)))
+bool match(char const *domain_name, char const *region, Ctx && ctx, T && val, Case && cs, Cases&&... cases) {
+    if (match<domain, Fn>(domain_name, region, std::forward<Ctx>(ctx), std::forward<T>(val), std::forward<Case>(cs)))
         return true;
-    return match<domain, Fn>(region, std::forward<Ctx>(ctx), std::forward<T>(val), std::forward<Cases>(cases)...);
+    return match<domain, Fn>(domain_name, region, std::forward<Ctx>(ctx), std::forward<T>(val),
+                             std::forward<Cases>(cases)...);
 }
 
 }  // namespace internal
 
 #define OV_SCOPE(Module, region)                                                            \
+    static const bool OV_PP_CAT(ovCCRegionRecorded, __LINE__) =                             \
+        openvino::cc::internal::record(OV_PP_TOSTRING(OV_PP_CAT(SIMPLE_, Module)),          \
+                                       OV_PP_TOSTRING(region));                             \
+    (void)OV_PP_CAT(ovCCRegionRecorded, __LINE__);                                          \
     OV_ITT_SCOPED_TASK(OV_PP_CAT(SIMPLE_, Module), OV_PP_TOSTRING(region));
 
 #define OV_SWITCH(Module, fn, ctx, val, ...)                                                \
     openvino::cc::internal::match<OV_PP_CAT(SWITCH_, Module), fn>                           \
-        (OV_PP_TOSTRING(fn), ctx, val, __VA_ARGS__);
+        (OV_PP_TOSTRING(OV_PP_CAT(SWITCH_, Module)), OV_PP_TOSTRING(fn), ctx, val, __VA_ARGS__);
 
 #define OV_CC_LBR (
 #define OV_CC_RBR )
@@ -5,6 +5,8 @@
 
 #     The main purpose of this script is code generation for conditional compilation.
 # After collecting statistics using IntelSEAPI, several CSV files are generated.
+# The analysis build also writes the same CSV rows to the file set by the
+# OPENVINO_CC_PROFILE environment variable, so the collector is not required.
 # This script can read these files and can produce header file which will contain
 # definitions for enabled OpenVINO parts.
 #
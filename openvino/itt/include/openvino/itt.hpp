@@ -13,6 +13,26 @@
 #include <string>
 #include <utility>
 
+/**
+ * @cond
+ */
+#ifdef OPENVINO_ITT_SHARED
+#   if defined(_WIN32)
+#       ifdef itt_EXPORTS
+#           define OPENVINO_ITT_API __declspec(dllexport)
+#       else
+#           define OPENVINO_ITT_API __declspec(dllimport)
+#       endif
+#   else
+#       define OPENVINO_ITT_API __attribute__((visibility("default")))
+#   endif
+#else
+#   define OPENVINO_ITT_API
+#endif
+/**
+ * @endcond
+ */
+
 namespace openvino
 {
     namespace itt
@@ -36,11 +56,12 @@ namespace openvino
  */
         namespace internal
         {
-            domain_t domain(char const* name);
-            handle_t handle(char const* name);
-            void taskBegin(domain_t d, handle_t t);
-            void taskEnd(domain_t d);
-            void threadName(const char* name);
+            OPENVINO_ITT_API domain_t domain(char const* name);
+            OPENVINO_ITT_API handle_t handle(char const* name);
+            OPENVINO_ITT_API void taskBegin(domain_t d, handle_t t);
+            OPENVINO_ITT_API void taskEnd(domain_t d);
+            OPENVINO_ITT_API void threadName(const char* name);
+            OPENVINO_ITT_API bool dumpTrace(const char* path);
         }
 /**
  * @endcond
@@ -62,6 +83,26 @@ namespace openvino
             internal::threadName(name.c_str());
         }
 
+        /**
+         * @fn bool dumpTrace(const char* path)
+         * @ingroup ie_dev_profiling
+         * @brief Writes the tasks recorded by the built-in tracing in the Chrome trace format.
+         * @details The tasks are recorded only if OpenVINO is built with ENABLE_PROFILING_TRACE.
+         * Only the last tasks of every thread are kept, the size of the thread buffers is set by
+         * the OPENVINO_TRACE_BUFFER_SIZE environment variable.
+         * @param path [in] The output file. If it is empty, the OPENVINO_TRACE_FILE environment variable is used.
+         * @return false if the tracing is not built in or the file cannot be written
+         */
+        inline bool dumpTrace(const char* path = nullptr)
+        {
+            return internal::dumpTrace(path);
+        }
+
+        inline bool dumpTrace(const std::string &path)
+        {
+            return internal::dumpTrace(path.c_str());
+        }
+
         inline handle_t handle(char const *name)
         {
             return internal::handle(name);
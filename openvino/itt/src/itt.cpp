@@ -48,7 +48,9 @@ void threadName(const char* name) {
     __itt_thread_set_name(name);
 }
 
-#else
+bool dumpTrace(const char *) { return false; }
+
+#elif !defined(ENABLE_PROFILING_TRACE)  // the built-in tracing is implemented in trace.cpp
 
 domain_t domain(char const *) { return nullptr; }
 
@@ -60,6 +62,8 @@ void taskEnd(domain_t) { }
 
 void threadName(const char *) { }
 
+bool dumpTrace(const char *) { return false; }
+
 #endif  // ENABLE_PROFILING_ITT
 
 }  // namespace internal
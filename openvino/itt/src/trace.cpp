@@ -0,0 +1,387 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifdef ENABLE_PROFILING_TRACE
+
+#include <openvino/itt.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace openvino {
+namespace itt {
+namespace internal {
+
+namespace {
+
+/*
+    The built-in tracing records the tasks of every thread into its own ring buffer, so a task costs
+    two clock reads and a few stores and there are no locks on the hot path. Only the last tasks of
+    the threads are kept: the buffers are overwritten when they are full, so the tracing may stay
+    enabled under load. The buffers are written as the Chrome trace JSON, which Perfetto and
+    chrome://tracing open, by dumpTrace(), at the process exit or on SIGUSR1 if the
+    OPENVINO_TRACE_FILE environment variable is set.
+*/
+
+// The fields are atomic because the dump reads the buffer while the thread overwrites it
+struct Event {
+    std::atomic<const char*> name {nullptr};
+    std::atomic<const char*> category {nullptr};
+    std::atomic<int64_t> begin {0};
+    std::atomic<int64_t> duration {0};
+    std::atomic<uint32_t> tid {0};
+};
+
+struct OpenTask {
+    const char* name;
+    const char* category;
+    int64_t begin;
+};
+
+constexpr uint32_t maxOpenTasks = 256;
+constexpr size_t defaultBufferSize = 8192;
+
+// Only the owner thread writes the buffer, the completed tasks are published by the written counter.
+// The extra event is the one the thread may overwrite while the dump copies the kept ones
+struct ThreadBuffer {
+    explicit ThreadBuffer(size_t size) : events(size + 1) {}
+
+    std::vector<Event> events;
+    std::atomic<uint64_t> written {0};
+    uint32_t tid = 0;
+    uint32_t depth = 0;     // the nesting level including the tasks which are not recorded
+    OpenTask open[maxOpenTasks];
+};
+
+size_t envValue(const char* name, size_t defaultValue) {
+    const char* env = std::getenv(name);
+    const size_t value = env ? std::strtoul(env, nullptr, 10) : 0;
+    return value ? value : defaultValue;
+}
+
+void writeString(std::ostream& out, const char* str) {
+    static const char hex[] = "0123456789abcdef";
+    out << '"';
+    for (; str && *str; ++str) {
+        const unsigned char c = static_cast<unsigned char>(*str);
+        if (c == '"' || c == '\\') {
+            out << '\\' << *str;
+        } else if (c < 0x20) {
+            out << "\\u00" << hex[c >> 4] << hex[c & 0xf];
+        } else {
+            out << *str;
+        }
+    }
+    out << '"';
+}
+
+// the trace timestamps are microseconds
+void writeTime(std::ostream& out, int64_t ns) {
+    const int64_t fraction = ns % 1000;
+    out << ns / 1000 << '.' << fraction / 100 << fraction / 10 % 10 << fraction % 10;
+}
+
+int processId() {
+#ifdef _WIN32
+    return _getpid();
+#else
+    return static_cast<int>(getpid());
+#endif
+}
+
+class Trace {
+    Trace()
+        : bufferSize(envValue("OPENVINO_TRACE_BUFFER_SIZE", defaultBufferSize))
+        , depthLimit(std::min<size_t>(envValue("OPENVINO_TRACE_DEPTH", maxOpenTasks), maxOpenTasks))
+        , start(std::chrono::steady_clock::now()) {
+        const char* file = std::getenv("OPENVINO_TRACE_FILE");
+        if (file && *file) {
+            std::atexit([] { instance().dump(nullptr); });
+            dumpOnSignal();
+        }
+    }
+
+public:
+    Trace(const Trace&) = delete;
+    Trace& operator=(const Trace&) = delete;
+
+    // The trace is never destroyed: the threads may record the tasks while the process exits
+    static Trace& instance() {
+        static Trace* trace = new Trace();
+        return *trace;
+    }
+
+    int64_t now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // the names live as long as the process, so the handles are pointers to the interned strings
+    const char* intern(const char* name) {
+        std::lock_guard<std::mutex> lock(namesMutex);
+        return names.emplace(name ? name : "").first->c_str();
+    }
+
+    ThreadBuffer* acquire() {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        ThreadBuffer* buffer = nullptr;
+        if (freeBuffers.empty()) {
+            buffers.emplace_back(new ThreadBuffer(bufferSize));
+            buffer = buffers.back().get();
+        } else {
+            // the tasks of the finished thread are kept until they are overwritten
+            buffer = freeBuffers.back();
+            freeBuffers.pop_back();
+        }
+        buffer->tid = nextTid++;
+        buffer->depth = 0;
+        return buffer;
+    }
+
+    void release(ThreadBuffer* buffer) {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        freeBuffers.push_back(buffer);
+    }
+
+    void threadName(uint32_t tid, const char* name) {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        threadNames[tid] = name ? name : "";
+    }
+
+    bool dump(const char* path);
+
+    const size_t bufferSize;
+    const size_t depthLimit;
+
+private:
+    void dumpOnSignal();
+
+    const std::chrono::steady_clock::time_point start;
+
+    std::mutex namesMutex;
+    std::unordered_set<std::string> names;
+
+    std::mutex buffersMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    std::vector<ThreadBuffer*> freeBuffers;
+    std::unordered_map<uint32_t, std::string> threadNames;
+    uint32_t nextTid = 1;
+
+    std::mutex dumpMutex;
+};
+
+bool Trace::dump(const char* path) {
+    std::string file = path && *path ? path : "";
+    if (file.empty()) {
+        const char* env = std::getenv("OPENVINO_TRACE_FILE");
+        file = env ? env : "";
+    }
+    if (file.empty())
+        return false;
+
+    std::lock_guard<std::mutex> dumpLock(dumpMutex);
+    std::ofstream out(file);
+    if (!out)
+        return false;
+
+    const int pid = processId();
+    const char* separator = "\n";
+    out << "{\"traceEvents\":[";
+
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    for (const auto& threadName : threadNames) {
+        out << separator << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid
+            << ",\"tid\":" << threadName.first << ",\"args\":{\"name\":";
+        writeString(out, threadName.second.c_str());
+        out << "}}";
+        separator = ",\n";
+    }
+
+    struct Task {
+        uint64_t index;
+        const char* name;
+        const char* category;
+        int64_t begin;
+        int64_t duration;
+        uint32_t tid;
+    };
+    std::vector<Task> tasks;
+    tasks.reserve(bufferSize);
+
+    for (const auto& buffer : buffers) {
+        const uint64_t written = buffer->written.load(std::memory_order_acquire);
+        const uint64_t size = buffer->events.size();
+        tasks.clear();
+        for (uint64_t i = written > bufferSize ? written - bufferSize : 0; i < written; ++i) {
+            const Event& event = buffer->events[i % size];
+            tasks.push_back({i,
+                             event.name.load(std::memory_order_relaxed),
+                             event.category.load(std::memory_order_relaxed),
+                             event.begin.load(std::memory_order_relaxed),
+                             event.duration.load(std::memory_order_relaxed),
+                             event.tid.load(std::memory_order_relaxed)});
+        }
+        // the tasks overwritten by the thread while they were copied are skipped
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint64_t overwritten = buffer->written.load(std::memory_order_relaxed);
+        for (const auto& task : tasks) {
+            if (task.index + size <= overwritten)
+                continue;
+            out << separator << "{\"name\":";
+            writeString(out, task.name);
+            out << ",\"cat\":";
+            writeString(out, task.category);
+            out << ",\"ph\":\"X\",\"ts\":";
+            writeTime(out, task.begin);
+            out << ",\"dur\":";
+            writeTime(out, task.duration);
+            out << ",\"pid\":" << pid << ",\"tid\":" << task.tid << "}";
+            separator = ",\n";
+        }
+    }
+
+    out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    return static_cast<bool>(out);
+}
+
+#ifdef _WIN32
+
+void Trace::dumpOnSignal() {}
+
+#else
+
+int signalPipe[2] = {-1, -1};
+struct sigaction previousAction;
+
+void onSignal(int signal, siginfo_t* info, void* context) {
+    const int savedErrno = errno;
+    const char request = 1;
+    // the pipe is full only if the previous requests are not handled yet
+    const ssize_t written = write(signalPipe[1], &request, 1);
+    (void)written;
+    errno = savedErrno;
+
+    if (previousAction.sa_flags & SA_SIGINFO) {
+        if (previousAction.sa_sigaction)
+            previousAction.sa_sigaction(signal, info, context);
+    } else if (previousAction.sa_handler != SIG_DFL && previousAction.sa_handler != SIG_IGN) {
+        previousAction.sa_handler(signal);
+    }
+}
+
+// The signal handler only wakes up the thread which writes the trace
+void Trace::dumpOnSignal() {
+    if (pipe(signalPipe) != 0)
+        return;
+    fcntl(signalPipe[1], F_SETFL, fcntl(signalPipe[1], F_GETFL) | O_NONBLOCK);
+
+    std::thread([this] {
+        char request = 0;
+        for (;;) {
+            const ssize_t size = read(signalPipe[0], &request, 1);
+            if (size > 0)
+                dump(nullptr);
+            else if (size == 0 || errno != EINTR)
+                break;
+        }
+    }).detach();
+
+    struct sigaction action = {};
+    action.sa_sigaction = onSignal;
+    action.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGUSR1, &action, &previousAction);
+}
+
+#endif  // _WIN32
+
+struct ThreadBufferHolder {
+    ThreadBuffer* buffer = nullptr;
+
+    ~ThreadBufferHolder() {
+        if (buffer)
+            Trace::instance().release(buffer);
+    }
+};
+
+thread_local ThreadBufferHolder threadBufferHolder;
+
+ThreadBuffer& threadBuffer() {
+    if (!threadBufferHolder.buffer)
+        threadBufferHolder.buffer = Trace::instance().acquire();
+    return *threadBufferHolder.buffer;
+}
+
+}  // namespace
+
+domain_t domain(char const* name) {
+    return reinterpret_cast<domain_t>(const_cast<char*>(Trace::instance().intern(name)));
+}
+
+handle_t handle(char const* name) {
+    return reinterpret_cast<handle_t>(const_cast<char*>(Trace::instance().intern(name)));
+}
+
+void taskBegin(domain_t d, handle_t t) {
+    ThreadBuffer& buffer = threadBuffer();
+    const Trace& trace = Trace::instance();
+    if (buffer.depth++ < trace.depthLimit) {
+        buffer.open[buffer.depth - 1] = {reinterpret_cast<const char*>(t),
+                                         reinterpret_cast<const char*>(d),
+                                         trace.now()};
+    }
+}
+
+void taskEnd(domain_t) {
+    ThreadBuffer& buffer = threadBuffer();
+    const Trace& trace = Trace::instance();
+    if (!buffer.depth || --buffer.depth >= trace.depthLimit)
+        return;
+
+    const OpenTask& task = buffer.open[buffer.depth];
+    const int64_t end = trace.now();
+    const uint64_t index = buffer.written.load(std::memory_order_relaxed);
+    Event& event = buffer.events[index % buffer.events.size()];
+    // orders the overwriting of the event after the publishing of the previous one for the dump
+    std::atomic_thread_fence(std::memory_order_release);
+    event.name.store(task.name, std::memory_order_relaxed);
+    event.category.store(task.category, std::memory_order_relaxed);
+    event.begin.store(task.begin, std::memory_order_relaxed);
+    event.duration.store(end - task.begin, std::memory_order_relaxed);
+    event.tid.store(buffer.tid, std::memory_order_relaxed);
+    buffer.written.store(index + 1, std::memory_order_release);
+}
+
+void threadName(const char* name) {
+    Trace::instance().threadName(threadBuffer().tid, name);
+}
+
+bool dumpTrace(const char* path) {
+    return Trace::instance().dump(path);
+}
+
+}  // namespace internal
+}  // namespace itt
+}  // namespace openvino
+
+#endif  // ENABLE_PROFILING_TRACE